@@ -0,0 +1,372 @@
+/**
+* @file AStar.h
+ * @brief A* search: Dijkstra's algorithm guided by an estimate of the distance left to the target.
+ */
+
+#pragma once
+#include "Algorithm.h"
+#include "PriorityQueues.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace Algorithms {
+
+/**
+ * @brief Metrics of the built-in coordinate heuristics.
+ */
+enum class HeuristicMetric {
+    Euclidean,  ///< Straight-line distance between layout positions.
+    Manhattan   ///< Sum of the horizontal and vertical offsets between layout positions.
+};
+
+/**
+ * @brief Estimate of the shortest distance from a vertex to the target, used to order the A* frontier.
+ * * Called as heuristic(graph, vertex, target) with the graph being searched, which may be a snapshot
+ * of the one the heuristic was made for.
+ * @tparam TVertex The vertex type used in the graph.
+ * @tparam TWeight The arithmetic type of edge weights.
+ */
+template<typename TVertex = Core::Vertex, typename TWeight = double>
+using Heuristic = std::function<double(const Core::Graph<TVertex, TWeight>&, int, int)>;
+
+/**
+ * @brief Measures the distance between the stored layout positions of two vertices.
+ * * @param a The first vertex, may be null.
+ * @param b The second vertex, may be null.
+ * @param metric The metric to use.
+ * @return The distance, or 0 if either vertex is missing or has no position.
+ */
+template<typename TVertex>
+double layoutDistance(const TVertex* a, const TVertex* b, HeuristicMetric metric) {
+    if (!a || !b || !a->hasPosition() || !b->hasPosition()) return 0.0;
+    double dx = a->getX() - b->getX();
+    double dy = a->getY() - b->getY();
+    return metric == HeuristicMetric::Euclidean ? std::hypot(dx, dy) : std::abs(dx) + std::abs(dy);
+}
+
+/**
+ * @brief Makes a heuristic from the layout distance between a vertex and the target.
+ * * With a scale from consistentScale() the heuristic never overestimates, and A* returns shortest paths.
+ * It is 0 for vertices without a position, so every vertex should have one.
+ * @param metric The metric to use.
+ * @param scale The factor converting layout units into edge weight units.
+ * @return The heuristic.
+ */
+template<typename TVertex = Core::Vertex, typename TWeight = double>
+Heuristic<TVertex, TWeight> makeCoordinateHeuristic(HeuristicMetric metric, double scale = 1.0) {
+    return [metric, scale](const Core::Graph<TVertex, TWeight>& graph, int vertex, int target) {
+        return scale * layoutDistance(graph.getVertex(vertex), graph.getVertex(target), metric);
+    };
+}
+
+/**
+ * @brief Finds the largest scale for which a coordinate heuristic is consistent with the edge weights.
+ * * A scaled layout distance s * d(v, target) is consistent if s * d(u, target) <= w(u, v) + s * d(v, target)
+ * for every edge. By the triangle inequality this holds whenever s * d(u, v) <= w(u, v), so the answer is
+ * the smallest ratio of weight to layout length over all edges. Runs in O(V + E).
+ * @param graph The graph whose vertices have positions.
+ * @param metric The metric of the heuristic.
+ * @return The scale, 0 if an edge of positive length has no positive weight, or 1 if no edge has a positive length.
+ */
+template<typename TVertex, typename TWeight>
+double consistentScale(const Core::Graph<TVertex, TWeight>& graph, HeuristicMetric metric) {
+    double scale = std::numeric_limits<double>::infinity();
+    graph.forEachEdge([&](const Core::BasicEdge<TWeight>& edge) {
+        double length = layoutDistance(graph.getVertex(edge.m_source), graph.getVertex(edge.m_destination), metric);
+        if (length > 0) scale = std::min(scale, std::max(0.0, static_cast<double>(edge.m_weight)) / length);
+    });
+    return scale == std::numeric_limits<double>::infinity() ? 1.0 : scale;
+}
+
+/**
+ * @brief Checks that a heuristic is consistent for a target: it is 0 there and drops by at most the weight of any edge.
+ * * A consistent heuristic lets A* settle every vertex at most once. Runs in O(V + E) heuristic evaluations.
+ * @param graph The graph to check.
+ * @param heuristic The heuristic.
+ * @param target The target vertex.
+ * @param tolerance Relative slack allowed for floating-point rounding.
+ * @return true If the heuristic is consistent.
+ */
+template<typename TVertex, typename TWeight>
+bool isConsistent(const Core::Graph<TVertex, TWeight>& graph, const Heuristic<TVertex, TWeight>& heuristic,
+                  int target, double tolerance = 1e-9) {
+    if (!graph.hasVertex(target) || std::abs(heuristic(graph, target, target)) > tolerance) return false;
+    bool consistent = true;
+    for (int u = 0; u < graph.getVertexCount() && consistent; ++u) {
+        if (!graph.hasVertex(u)) continue;
+        double hu = heuristic(graph, u, target);
+        graph.forEachEdgeFrom(u, [&](int v, TWeight weight) {
+            double bound = static_cast<double>(weight) + heuristic(graph, v, target);
+            if (hu > bound + tolerance * (1.0 + std::abs(hu))) consistent = false;
+        });
+    }
+    return consistent;
+}
+
+/**
+ * @brief Implements A* search for a shortest path to a target vertex.
+ * * Vertices are settled in order of f = g + h, the distance from the start plus the heuristic
+ * estimate of the distance left, so a good estimate steers the search towards the target and
+ * settles far fewer vertices than Dijkstra's algorithm. The heuristic is evaluated once per reached
+ * vertex. With an admissible heuristic (never overestimating) the path found is a shortest one;
+ * a settled vertex whose distance later improves is queued again, so consistency is not required
+ * for correctness, only for settling each vertex once.
+ * * Without a target, or with the default zero heuristic, the search is plain Dijkstra.
+ * Besides the Dijkstra events, every f-score change is reported as an Estimate event.
+ * For integer weights the estimate is rounded down, which keeps it admissible and consistent.
+ * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+ * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+ * @tparam TQueue The vertex priority queue (see PriorityQueues.h), keyed on the distance type. The default
+ * indexed heap accepts any key order; monotone bucket queues need a consistent heuristic.
+ */
+template<typename TVertex = Core::Vertex, typename TWeight = double,
+         typename TQueue = IndexedDaryHeap<typename Core::WeightTraits<TWeight>::Distance>>
+class AStar : public Algorithm<TVertex, TWeight> {
+private:
+    using Traits = Core::WeightTraits<TWeight>;
+    using Distance = typename Traits::Distance;
+
+    static_assert(std::is_same_v<typename TQueue::Key, Distance>, "The queue must be keyed on the distance type");
+
+public:
+    /**
+     * @brief Constructs an A* search with the zero heuristic, which behaves like Dijkstra's algorithm.
+     */
+    AStar() = default;
+
+    /**
+     * @brief Constructs an A* search with a heuristic.
+     * @param heuristic The estimate of the distance to the target; an empty function counts as zero.
+     */
+    explicit AStar(Heuristic<TVertex, TWeight> heuristic) : m_heuristic(std::move(heuristic)) {}
+
+    /**
+     * @brief Replaces the heuristic used by the next runs.
+     * * @param heuristic The estimate of the distance to the target; an empty function counts as zero.
+     */
+    void setHeuristic(Heuristic<TVertex, TWeight> heuristic) { m_heuristic = std::move(heuristic); }
+
+    /**
+     * @brief Runs A* on the given graph, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. The search stops once its shortest path is known.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Runs A* on the given graph, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. The search stops once its shortest path is known.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable A* run, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable A* run, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Settles the queued vertex with the smallest f-score, reporting through a type-erased sink.
+     * * The step that finishes the run also reports the shortest path to the target, if any.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    bool advance(EventSinkRef sink) override { return settle(sink); }
+
+    /**
+     * @brief Settles the queued vertex with the smallest f-score, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    template <typename Sink = NullSink>
+    bool advance(Sink&& sink = {}) { return settle(sink); }
+
+    /**
+     * @brief Checks if A* has completed execution.
+     * * @return true If the execution has finished.
+     * @return false Otherwise.
+     */
+    bool isFinished() const override { return m_finished; }
+
+    /**
+     * @brief Gets the number of vertices settled by the last run, counting repeated settlements.
+     * * @return The number of expanded vertices.
+     */
+    std::size_t getSettledCount() const { return m_settled; }
+
+private:
+    /**
+     * @brief The search shared by both run() overloads: a begin() followed by advance() until done.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     */
+    template <typename Sink>
+    bool search(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!initialize(graph, startId, endId, sink)) return false;
+        while (settle(sink));
+        return true;
+    }
+
+    /**
+     * @brief Resets the distances and queues the start vertex with its estimate.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     */
+    template <typename Sink>
+    bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!graph || !graph->hasVertex(startId)) return false;
+
+        m_graph = graph;
+        m_startId = startId;
+        m_endId = graph->hasVertex(endId) ? endId : -1;
+        m_finished = false;
+        m_settled = 0;
+        m_workspace = &this->getWorkspace();
+        m_workspace->reset(graph->getVertexCount());
+        m_queue.reset(graph->getVertexCount());
+        if (m_estimates.size() < static_cast<std::size_t>(graph->getVertexCount())) {
+            m_estimates.resize(graph->getVertexCount());
+        }
+
+        m_workspace->setDistance(startId, 0, -1);
+        m_estimates[startId] = estimate(startId);
+        m_queue.push(startId, m_estimates[startId]);
+
+        emitVertex(sink, EventType::Distance, startId, 0.0);
+        emitVertex(sink, EventType::Estimate, startId, static_cast<double>(m_estimates[startId]));
+        emitVertex(sink, EventType::Frontier, startId);
+        return true;
+    }
+
+    /**
+     * @brief Pops the queued vertex with the smallest f-score and relaxes its outgoing edges.
+     * * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     */
+    template <typename Sink>
+    bool settle(Sink& sink) {
+        if (m_finished || !m_graph) return false;
+        TraversalWorkspace<TWeight>& workspace = *m_workspace;
+
+        while (!m_queue.empty()) {
+            auto current = m_queue.pop();
+
+            int u = current.id;
+            if (!m_graph->hasVertex(u)) continue;
+            Distance g = workspace.getDistance(u);
+            if (current.key > g + m_estimates[u]) continue;
+
+            ++m_settled;
+            emitVertex(sink, EventType::Visiting, u);
+
+            if (u == m_endId) {
+                emitVertex(sink, EventType::Visited, u);
+                break;
+            }
+
+            m_graph->forEachEdgeFrom(u, [&](int v, TWeight weight) {
+                Distance newDist = g + static_cast<Distance>(weight);
+
+                if (newDist < workspace.getDistance(v)) {
+                    if (!workspace.isReached(v)) m_estimates[v] = estimate(v);
+                    workspace.setDistance(v, newDist, u);
+                    Distance f = newDist + m_estimates[v];
+                    m_queue.push(v, f);
+
+                    emitEdge(sink, EventType::Tree, u, v);
+                    emitVertex(sink, EventType::Distance, v, static_cast<double>(newDist));
+                    emitVertex(sink, EventType::Estimate, v, static_cast<double>(f));
+                    emitVertex(sink, EventType::Frontier, v);
+                }
+            });
+            emitVertex(sink, EventType::Visited, u);
+            if (!m_queue.empty()) return true;
+        }
+
+        if (m_endId != -1 && workspace.getDistance(m_endId) != Traits::infinity()) {
+            int curr = m_endId;
+            while (curr != m_startId && curr != -1) {
+                int prev = workspace.getPrevious(curr);
+                if (prev != -1) emitEdge(sink, EventType::Path, prev, curr);
+                curr = prev;
+            }
+        }
+
+        m_finished = true;
+        return false;
+    }
+
+    /**
+     * @brief Evaluates the heuristic for a vertex of the current run.
+     * * @param id The vertex ID.
+     * @return The estimate in the distance type, 0 without a target or heuristic, never negative.
+     */
+    Distance estimate(int id) const {
+        if (m_endId == -1 || !m_heuristic) return 0;
+        double h = m_heuristic(*m_graph, id, m_endId);
+        if (!(h > 0)) return 0;
+        if constexpr (Traits::isIntegral) return static_cast<Distance>(std::floor(h));
+        else return static_cast<Distance>(h);
+    }
+
+    Heuristic<TVertex, TWeight> m_heuristic;  ///< Estimate of the distance to the target; empty means zero.
+    const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+    int m_startId = -1;                ///< Start vertex of the current run.
+    int m_endId = -1;                  ///< Target vertex of the current run, -1 to settle every reachable vertex.
+    bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
+    std::size_t m_settled = 0;         ///< Number of vertices settled in the current run.
+    TraversalWorkspace<TWeight>* m_workspace = nullptr; ///< Tentative distances and predecessors of the current run.
+    std::vector<Distance> m_estimates; ///< Heuristic value of each vertex, valid for vertices reached in the current run.
+    TQueue m_queue;                    ///< Vertices waiting to be settled, keyed on f-score and reused between runs.
+};
+}
\ No newline at end of file
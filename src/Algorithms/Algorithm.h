@@ -5,33 +5,19 @@
 
 #pragma once
 #include "Graph.h"
-#include <functional>
-#include <string>
+#include "AlgorithmEvent.h"
+#include "TraversalWorkspace.h"
 
 namespace Algorithms {
 
     /**
      * @brief Abstract base class for graph traversal and pathfinding algorithms.
      * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
      */
-    template<typename TVertex = Core::Vertex>
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
     class Algorithm {
     public:
-        /**
-         * @brief Callback function type invoked when a vertex's state changes.
-         * * @param vertexId The ID of the vertex whose state changed.
-         * @param state A string describing the new state (e.g., "visiting", "visited", "frontier").
-         */
-        using VertexCallback = std::function<void(int vertexId, const std::string& state)>;
-
-        /**
-         * @brief Callback function type invoked when an edge's state changes.
-         * * @param fromId The ID of the source vertex.
-         * @param toId The ID of the destination vertex.
-         * @param state A string describing the edge state (e.g., "tree", "path").
-         */
-        using EdgeCallback = std::function<void(int fromId, int toId, const std::string& state)>;
-
         /**
          * @brief Virtual destructor for proper cleanup of derived classes.
          */
@@ -39,17 +25,40 @@ namespace Algorithms {
 
         /**
          * @brief Executes the algorithm on the provided graph.
+         * * Concrete algorithms also provide a template overload taking any sink type by reference,
+         * which avoids the indirect call per event and removes reporting entirely for a NullSink.
          * * @param graph Pointer to the graph to run the algorithm on.
          * @param startId The ID of the starting vertex.
          * @param endId The ID of the target vertex. Defaults to -1, which typically means traverse the whole graph.
-         * @param vertexCb Callback invoked during vertex state changes. Defaults to nullptr.
-         * @param edgeCb Callback invoked during edge state changes. Defaults to nullptr.
+         * @param sink Receiver of the progress events. Defaults to an empty sink.
          * @return true If the algorithm was successfully initiated/completed.
          * @return false If the inputs are invalid (e.g., null graph, invalid startId).
          */
-        virtual bool run(const Core::Graph<TVertex>* graph, int startId, int endId = -1,
-                         VertexCallback vertexCb = nullptr,
-                         EdgeCallback edgeCb = nullptr) = 0;
+        virtual bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1,
+                         EventSinkRef sink = {}) = 0;
+
+        /**
+         * @brief Prepares a resumable run without processing any vertex.
+         * * Reports the initial events (the start vertex entering the frontier). The run then proceeds
+         * one vertex at a time through advance(). The graph must stay alive and unmodified until the
+         * run is finished or a new one is begun.
+         * * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. Defaults to -1, which typically means traverse the whole graph.
+         * @param sink Receiver of the initial events. Defaults to an empty sink.
+         * @return true If the run was set up.
+         * @return false If the inputs are invalid (e.g., null graph, invalid startId).
+         */
+        virtual bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1,
+                           EventSinkRef sink = {}) = 0;
+
+        /**
+         * @brief Resumes a run started with begin() by processing the next vertex.
+         * * @param sink Receiver of the events produced by this step. Defaults to an empty sink.
+         * @return true If there is more work left.
+         * @return false If the run has finished (or was never begun); further calls do nothing.
+         */
+        virtual bool advance(EventSinkRef sink = {}) = 0;
 
         /**
          * @brief Checks if the algorithm has finished its execution.
@@ -57,5 +66,26 @@ namespace Algorithms {
          * @return false If the algorithm is still running or has not started.
          */
         virtual bool isFinished() const = 0;
+
+        /**
+         * @brief Makes the algorithm keep its per-vertex state in an external workspace.
+         * * Useful to share one workspace between many algorithm objects issuing short queries on
+         * the same large graph. Takes effect at the next begin() or run().
+         * * @param workspace The workspace to use, or nullptr to go back to the algorithm's own one.
+         * It must outlive every run that uses it.
+         */
+        void setWorkspace(TraversalWorkspace<TWeight>* workspace) { m_externalWorkspace = workspace; }
+
+        /**
+         * @brief Gives access to the per-vertex state of the last run (reached flags, distances, predecessors).
+         * * @return The external workspace if one was set, otherwise the algorithm's own.
+         */
+        TraversalWorkspace<TWeight>& getWorkspace() {
+            return m_externalWorkspace ? *m_externalWorkspace : m_ownWorkspace;
+        }
+
+    private:
+        TraversalWorkspace<TWeight> m_ownWorkspace;                    ///< Workspace used when none was set; kept between runs.
+        TraversalWorkspace<TWeight>* m_externalWorkspace = nullptr;    ///< Workspace set by setWorkspace(), or nullptr.
     };
 }
\ No newline at end of file
@@ -8,27 +8,61 @@
 #include "BFS.h"
 #include "DFS.h"
 #include "Dijkstra.h"
+#include "BidirectionalBFS.h"
+#include "BidirectionalDijkstra.h"
+#include "AStar.h"
+#include "DeltaStepping.h"
 #include "AlgorithmStep.h"
+#include "AlgorithmTrace.h"
+#include "AlgorithmWorker.h"
 #include <memory>
 #include <vector>
-#include <string>
 #include <algorithm>
 #include <limits>
+#include <optional>
 
 namespace Algorithms {
 
     /**
      * @brief Enumeration of available graph algorithms.
      */
-    enum class AlgorithmType {BFS, DFS, Dijkstra};
+    enum class AlgorithmType {BFS, DFS, Dijkstra, BidirectionalBFS, BidirectionalDijkstra, AStar, DeltaStepping};
+
+    /**
+     * @brief Checks if an algorithm searches for a specific target vertex.
+     * * @param type The algorithm type.
+     * @return true If the algorithm takes an end vertex.
+     */
+    inline bool usesTargetVertex(AlgorithmType type) {
+        return type == AlgorithmType::Dijkstra || type == AlgorithmType::BidirectionalBFS
+            || type == AlgorithmType::BidirectionalDijkstra || type == AlgorithmType::AStar
+            || type == AlgorithmType::DeltaStepping;
+    }
+
+    /**
+     * @brief Checks if an algorithm reports weighted distances.
+     * * @param type The algorithm type.
+     * @return true If its steps carry Distance events worth displaying.
+     */
+    inline bool reportsDistances(AlgorithmType type) {
+        return type == AlgorithmType::Dijkstra || type == AlgorithmType::BidirectionalDijkstra
+            || type == AlgorithmType::AStar || type == AlgorithmType::DeltaStepping;
+    }
 
     /**
      * @brief Controls the execution and state management of graph algorithms.
      * * This class acts as a facade to run algorithms, collect their execution steps,
-     * and allow stepping through the states backwards and forwards.
+     * and allow stepping through the states backwards and forwards or seeking to any step.
+     * Steps are stored as an AlgorithmTrace, so memory grows with O(steps + V) rather than O(steps * V).
+     * * Steps are generated on demand: start() only begins the algorithm, and moving past the last
+     * generated step advances it by one vertex at a time. Generated steps stay in the trace, so
+     * stepping back never re-runs anything. The graph must not be modified until reset() or the next start().
+     * * Alternatively startInBackground() runs the algorithm on a worker thread over a snapshot of the
+     * graph, which may then be edited freely. Its steps become available as poll() collects them.
      * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
      */
-    template<typename TVertex = Core::Vertex>
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
     class AlgorithmController {
     public:
         /**
@@ -40,7 +74,28 @@ namespace Algorithms {
          * @brief Sets the graph instance to be used by the algorithms.
          * * @param graph Pointer to the target graph.
          */
-        void setGraph(const Core::Graph<TVertex>* graph) { m_graph = graph; }
+        void setGraph(const Core::Graph<TVertex, TWeight>* graph) {
+            m_graph = graph;
+            graphChanged();
+        }
+
+        /**
+         * @brief Tells the controller that the edges or vertex positions of its graph have changed.
+         * * Values derived from the whole graph, such as the A* heuristic scale, are cached so that start()
+         * does not scan the graph; this drops them, and they are recomputed once, on their next use.
+         */
+        void graphChanged() { m_heuristicScale.reset(); }
+
+        /**
+         * @brief Gets the factor that makes the layout-distance heuristic of A* consistent with the graph.
+         * * Computed with consistentScale() in O(V + E) the first time it is needed after setGraph() or graphChanged().
+         * @return The cached scale, 1 if no graph is set.
+         */
+        double getHeuristicScale() const {
+            if (!m_graph) return 1.0;
+            if (!m_heuristicScale) m_heuristicScale = consistentScale(*m_graph, HeuristicMetric::Euclidean);
+            return *m_heuristicScale;
+        }
 
         /**
          * @brief Gets the currently selected algorithm type.
@@ -62,75 +117,105 @@ namespace Algorithms {
 
         /**
          * @brief Starts the execution of the selected algorithm.
-         * * This method runs the algorithm entirely and records its states at every step using callbacks.
+         * * This method only begins the algorithm and advances it until the first state exists,
+         * so its cost does not depend on how long the full run is. Values derived from the whole graph, such as
+         * the A* heuristic scale, are reused from earlier starts until graphChanged() is called.
          * * @param startId The ID of the starting vertex.
          * @param endId The ID of the target vertex.
          * @param outInitialState Reference to an AlgoState variable that will receive the very first recorded state.
-         * @return true If the algorithm was successfully executed and at least one state was recorded.
+         * @return true If the algorithm was successfully started and at least one state was recorded.
          * @return false If the setup is invalid or execution failed.
          */
         bool start(int startId, int endId, AlgoState& outInitialState) {
-            m_states.clear();
-            m_currentStep = 0;
+            reset();
             if (!m_graph || !m_graph->hasVertex(startId)) return false;
 
-            AlgoState currentState;
-            currentState.distances.resize(m_graph->getVertexCount(), std::numeric_limits<double>::infinity());
-
-            auto vCb = [&](int v, const std::string& state) {
-                if (state == "visiting") {
-                    currentState.currentVertex = v;
-                    auto it = std::find(currentState.frontier.begin(), currentState.frontier.end(), v);
-                    if (it != currentState.frontier.end()) currentState.frontier.erase(it);
-                } else if (state == "visited") {
-                    currentState.visitedVertices.push_back(v);
-                    currentState.currentVertex = -1;
-                } else if (state == "frontier") {
-                    currentState.frontier.push_back(v);
-                } else if (state.find("dist=") == 0) {
-                    double d = std::stod(state.substr(5));
-                    currentState.distances[v] = d;
-                }
-                m_states.push_back(currentState);
-            };
-
-            auto eCb = [&](int from, int to, const std::string& state) {
-                if (state == "tree") {
-                    currentState.visitedEdges.push_back({from, to});
-                } else if (state == "path") {
-                    currentState.shortestPathEdges.push_back({from, to});
-                }
-                m_states.push_back(currentState);
-            };
-
-            std::unique_ptr<Algorithm<TVertex>> strategy;
-            switch (m_type) {
-                case AlgorithmType::BFS: strategy = std::make_unique<BFS<TVertex>>(); break;
-                case AlgorithmType::DFS: strategy = std::make_unique<DFS<TVertex>>(); break;
-                case AlgorithmType::Dijkstra: strategy = std::make_unique<Dijkstra<TVertex>>(); break;
-                default: return false;
+            m_strategy = makeAlgorithm();
+            if (!m_strategy) return false;
+            m_strategy->setWorkspace(&m_workspace);
+
+            m_trace.reset(m_graph->getVertexCount());
+            auto sink = [this](const AlgorithmEvent& event) { m_trace.record(event); };
+            if (!m_strategy->begin(m_graph, startId, endId, sink)) {
+                m_strategy.reset();
+                return false;
+            }
+            if (generate(0)) {
+                outInitialState = m_trace.seek(0);
             }
+            return true;
+        }
+
+        /**
+         * @brief Starts the selected algorithm on a background thread.
+         * * The graph is snapshotted first, so it may be modified or destroyed during the run. No step is
+         * available until poll() has collected the first events.
+         * * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @return true If the run was started.
+         * @return false If the setup is invalid.
+         */
+        bool startInBackground(int startId, int endId) {
+            reset();
+            if (!m_graph || !m_graph->hasVertex(startId)) return false;
+
+            auto algorithm = makeAlgorithm();
+            if (!algorithm) return false;
+
+            m_trace.reset(m_graph->getVertexCount());
+            m_worker = std::make_unique<AlgorithmWorker<TVertex, TWeight>>(std::move(algorithm), *m_graph, startId, endId);
+            return true;
+        }
+
+        /**
+         * @brief Collects the steps produced by a background run since the last call.
+         * * @return The number of new steps.
+         */
+        std::size_t poll() {
+            if (!m_worker) return 0;
+            std::size_t count = m_worker->drain([this](const AlgorithmEvent& event) { m_trace.record(event); });
+            if (m_worker->isFinished()) m_worker.reset();
+            return count;
+        }
 
-            bool success = strategy->run(m_graph, startId, endId, vCb, eCb);
-            if (success && !m_states.empty()) {
-                outInitialState = m_states.front();
+        /**
+         * @brief Stops generating steps. Steps generated so far stay available.
+         * * Waits for a background run to stop, which takes at most one vertex expansion.
+         */
+        void cancel() {
+            if (m_worker) {
+                m_worker->cancel();
+                poll();
+                m_worker.reset();
             }
-            return success;
+            m_strategy.reset();
         }
 
+        /**
+         * @brief Checks if a background run is still producing steps.
+         * * @return true Between startInBackground() and the poll() that collects its last step.
+         */
+        bool isRunningInBackground() const { return m_worker != nullptr; }
+
+        /**
+         * @brief Estimates the progress of a background run.
+         * * @return A fraction in [0, 1], based on the number of vertices expanded; 1 when no run is in progress.
+         */
+        double getProgress() const { return m_worker ? m_worker->getProgress() : 1.0; }
+
         /**
          * @brief Advances to the next recorded state of the algorithm.
          * * @param outState Reference to an AlgoState variable that will receive the next state.
          * @return true If moved to the next step successfully.
-         * @return false If already at the last step.
+         * @return false If already at the last step, or if a background run has not produced the next step yet.
          */
         bool nextStep(AlgoState& outState) {
-            if (m_currentStep < static_cast<int>(m_states.size()) - 1) {
+            if (generate(m_currentStep + 1)) {
                 m_currentStep++;
-                outState = m_states[m_currentStep];
+                outState = m_trace.seek(m_currentStep);
                 return true;
             }
-            if (!m_states.empty()) outState = m_states.back();
+            if (!m_trace.empty()) outState = m_trace.seek(m_trace.size() - 1);
             return false;
         }
 
@@ -143,24 +228,114 @@ namespace Algorithms {
         bool prevStep(AlgoState& outState) {
             if (m_currentStep > 0) {
                 m_currentStep--;
-                outState = m_states[m_currentStep];
+                outState = m_trace.seek(m_currentStep);
                 return true;
             }
-            if (!m_states.empty()) outState = m_states.front();
+            if (!m_trace.empty()) outState = m_trace.seek(0);
             return false;
         }
 
+        /**
+         * @brief Jumps to an arbitrary step, generating it first if needed.
+         * * Costs one keyframe copy plus at most one keyframe interval of event applications (see AlgorithmTrace)
+         * once the step has been generated.
+         * * @param step The index of the step to show.
+         * @param outState Reference to an AlgoState variable that will receive the state at that step.
+         * @return true If the step exists and is now current.
+         * @return false If the index is out of range; the current step is left unchanged.
+         */
+        bool seek(int step, AlgoState& outState) {
+            if (step < 0 || !generate(step)) return false;
+            m_currentStep = step;
+            outState = m_trace.seek(step);
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of steps generated so far.
+         * * @return int The length of the trace; the total only once isComplete() is true.
+         */
+        int getStepCount() const { return static_cast<int>(m_trace.size()); }
+
+        /**
+         * @brief Checks if the algorithm has run to the end, so that every step is in the trace.
+         * * @return true If no further step can be generated.
+         */
+        bool isComplete() const { return !m_strategy && !m_worker; }
+
+        /**
+         * @brief Generates all remaining steps without moving the current step.
+         * * Has no effect on a background run, whose steps arrive through poll().
+         */
+        void runToEnd() { generate(std::numeric_limits<int>::max()); }
+
+        /**
+         * @brief Gives access to the recorded trace, e.g. to measure its memory footprint.
+         * * @return const AlgorithmTrace& The trace of the last run.
+         */
+        const AlgorithmTrace& getTrace() const { return m_trace; }
+
         /**
          * @brief Resets the controller, clearing all recorded states and resetting the current step.
          */
         void reset() {
-            m_states.clear();
+            m_worker.reset();
+            m_strategy.reset();
+            m_trace.clear();
             m_currentStep = 0;
         }
 
     private:
-        const Core::Graph<TVertex>* m_graph = nullptr; ///< Pointer to the graph instance.
-        std::vector<AlgoState> m_states;               ///< Collection of all states recorded during algorithm execution.
+        /**
+         * @brief Creates an instance of the selected algorithm.
+         * * @return The algorithm, or nullptr for an unknown type.
+         */
+        std::unique_ptr<Algorithm<TVertex, TWeight>> makeAlgorithm() const {
+            switch (m_type) {
+                case AlgorithmType::BFS: return std::make_unique<BFS<TVertex, TWeight>>();
+                case AlgorithmType::DFS: return std::make_unique<DFS<TVertex, TWeight>>();
+                case AlgorithmType::Dijkstra: return std::make_unique<Dijkstra<TVertex, TWeight>>();
+                case AlgorithmType::BidirectionalBFS: return std::make_unique<BidirectionalBFS<TVertex, TWeight>>();
+                case AlgorithmType::BidirectionalDijkstra: return std::make_unique<BidirectionalDijkstra<TVertex, TWeight>>();
+                case AlgorithmType::AStar: return makeAStar();
+                case AlgorithmType::DeltaStepping: return std::make_unique<DeltaStepping<TVertex, TWeight>>();
+                default: return nullptr;
+            }
+        }
+
+        /**
+         * @brief Creates an A* search guided by the Euclidean distance between vertex positions.
+         * * The distance is scaled so that it never exceeds the weight of an edge, which keeps the
+         * heuristic consistent and the paths shortest. Vertices without a position get no guidance.
+         * The scale is cached between runs, see getHeuristicScale().
+         * * @return The algorithm.
+         */
+        std::unique_ptr<Algorithm<TVertex, TWeight>> makeAStar() const {
+            return std::make_unique<AStar<TVertex, TWeight>>(
+                makeCoordinateHeuristic<TVertex, TWeight>(HeuristicMetric::Euclidean, getHeuristicScale()));
+        }
+
+        /**
+         * @brief Advances the running algorithm until a step exists or the run ends.
+         * * A background run is only polled, never waited for.
+         * * @param step The index of the step that is needed.
+         * @return true If the step is in the trace.
+         */
+        bool generate(int step) {
+            if (m_worker && step >= getStepCount()) poll();
+            auto sink = [this](const AlgorithmEvent& event) { m_trace.record(event); };
+            while (m_strategy && step >= getStepCount()) {
+                if (!m_strategy->advance(sink)) m_strategy.reset();
+            }
+            return step < getStepCount();
+        }
+
+        const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< Pointer to the graph instance.
+        mutable std::optional<double> m_heuristicScale; ///< A* heuristic scale of m_graph, empty until needed after a change.
+        std::unique_ptr<Algorithm<TVertex, TWeight>> m_strategy; ///< The running algorithm, nullptr once it has finished.
+        std::unique_ptr<AlgorithmWorker<TVertex, TWeight>> m_worker; ///< The background run, nullptr once all its steps are collected.
+        TraversalWorkspace<TWeight> m_workspace;       ///< Per-vertex state shared by the foreground runs, reset in O(1) by each start().
+        AlgorithmTrace m_trace;                        ///< Events and keyframes recorded during algorithm execution.
         int m_currentStep = 0;                         ///< The current index within the recorded states.
         AlgorithmType m_type = AlgorithmType::BFS;     ///< The selected algorithm type.
     };
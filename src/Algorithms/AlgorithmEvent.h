@@ -0,0 +1,119 @@
+/**
+* @file AlgorithmEvent.h
+ * @brief Typed events reported by graph algorithms and the sinks that receive them.
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Algorithms {
+
+    /**
+     * @brief Kind of progress an algorithm reports.
+     */
+    enum class EventType : std::uint8_t {
+        Frontier,   ///< A vertex was discovered and queued.
+        Visiting,   ///< A vertex is being expanded.
+        Visited,    ///< A vertex has been fully processed.
+        Distance,   ///< The tentative distance of a vertex changed; the new value is in the payload.
+        Tree,       ///< An edge joined the traversal tree.
+        Path,       ///< An edge belongs to the final shortest path.
+        Estimate    ///< The estimated total path length (f-score) through a vertex changed; the new value is in the payload.
+    };
+
+    /**
+     * @brief A single algorithm event with its numeric payload.
+     * * Vertex events (Frontier, Visiting, Visited, Distance, Estimate) only use @c vertex;
+     * edge events (Tree, Path) report the edge from @c vertex to @c target.
+     */
+    struct AlgorithmEvent {
+        EventType type;         ///< The kind of event.
+        int vertex;             ///< The vertex concerned, or the source of the edge.
+        int target = -1;        ///< The destination of the edge, -1 for vertex events.
+        double value = 0.0;     ///< The new distance for Distance and Estimate events, unused otherwise.
+    };
+
+    /**
+     * @brief Sink that discards every event.
+     * * Algorithms check for it at compile time and drop the code that builds events, so running
+     * with a NullSink costs the same as an algorithm without any reporting.
+     */
+    struct NullSink {
+        void operator()(const AlgorithmEvent&) const noexcept {}
+    };
+
+    /**
+     * @brief Checks if a sink type actually consumes events.
+     * @tparam Sink The sink type.
+     */
+    template <typename Sink>
+    inline constexpr bool isEventSink = !std::is_same_v<std::remove_cvref_t<Sink>, NullSink>;
+
+    /**
+     * @brief Non-owning, type-erased reference to an event sink, used across the virtual Algorithm interface.
+     * * A default-constructed reference is empty and ignores events. It must not outlive the sink it refers to.
+     */
+    class EventSinkRef {
+    private:
+        void* m_sink = nullptr;                                         ///< Address of the referenced sink.
+        void (*m_callback)(void*, const AlgorithmEvent&) = nullptr;    ///< Trampoline invoking the sink, nullptr if empty.
+
+    public:
+        /**
+         * @brief Constructs an empty reference.
+         */
+        EventSinkRef() = default;
+
+        /**
+         * @brief Binds the reference to a sink.
+         * @tparam Sink The type of the sink, callable with a const AlgorithmEvent&.
+         * @param sink The sink to refer to.
+         */
+        template <typename Sink>
+            requires (!std::is_same_v<std::remove_cvref_t<Sink>, EventSinkRef>
+                      && std::is_invocable_v<Sink&, const AlgorithmEvent&>)
+        EventSinkRef(Sink& sink) noexcept
+            : m_sink(const_cast<void*>(static_cast<const void*>(std::addressof(sink)))),
+              m_callback([](void* s, const AlgorithmEvent& event) { (*static_cast<Sink*>(s))(event); }) {}
+
+        /**
+         * @brief Checks if the reference is bound to a sink.
+         * @return True if events are forwarded somewhere.
+         */
+        explicit operator bool() const noexcept { return m_callback != nullptr; }
+
+        /**
+         * @brief Forwards an event to the referenced sink, if any.
+         * @param event The event to forward.
+         */
+        void operator()(const AlgorithmEvent& event) const {
+            if (m_callback) m_callback(m_sink, event);
+        }
+    };
+
+    /**
+     * @brief Reports a vertex event to a sink; compiles to nothing for a NullSink.
+     * @param sink The receiving sink.
+     * @param type The kind of event.
+     * @param vertex The vertex concerned.
+     * @param value The numeric payload (the distance for Distance events).
+     */
+    template <typename Sink>
+    inline void emitVertex(Sink& sink, EventType type, int vertex, double value = 0.0) {
+        if constexpr (isEventSink<Sink>) sink(AlgorithmEvent{type, vertex, -1, value});
+    }
+
+    /**
+     * @brief Reports an edge event to a sink; compiles to nothing for a NullSink.
+     * @param sink The receiving sink.
+     * @param type The kind of event.
+     * @param from The source vertex of the edge.
+     * @param to The destination vertex of the edge.
+     */
+    template <typename Sink>
+    inline void emitEdge(Sink& sink, EventType type, int from, int to) {
+        if constexpr (isEventSink<Sink>) sink(AlgorithmEvent{type, from, to, 0.0});
+    }
+}
\ No newline at end of file
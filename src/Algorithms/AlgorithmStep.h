@@ -43,10 +43,11 @@ struct EdgeId {
  */
 struct AlgoState {
     int currentVertex = -1;                 ///< The ID of the vertex currently being processed.
-    std::vector<int> frontier;              ///< The list of vertices discovered but not yet processed (e.g., in the queue or stack).
+    std::vector<int> frontier;              ///< The vertices discovered but not yet processed (e.g., in the queue or stack), in no particular order.
     std::vector<int> visitedVertices;       ///< The list of vertices that have been completely processed.
     std::vector<EdgeId> visitedEdges;       ///< The list of edges that form the traversal tree.
     std::vector<double> distances;          ///< The computed distances from the start vertex to each vertex (used in Dijkstra).
+    std::vector<double> estimates;          ///< The estimated total path length through each vertex (used in A*), empty until one is reported.
     std::vector<EdgeId> shortestPathEdges;  ///< The list of edges that belong to the final shortest path.
     std::string message;                    ///< Optional informational message regarding the current state.
 };
\ No newline at end of file
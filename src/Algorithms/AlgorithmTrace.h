@@ -0,0 +1,252 @@
+/**
+* @file AlgorithmTrace.h
+ * @brief Compact, seekable record of the states an algorithm passes through.
+ */
+
+#pragma once
+#include "AlgorithmEvent.h"
+#include "AlgorithmStep.h"
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+
+namespace Algorithms {
+
+    /**
+     * @brief Stores an algorithm run as a list of events (one per step) plus periodic keyframes.
+     * * Step @c i is the state after applying events 0..i to the initial state. Instead of a full
+     * AlgoState per step, only the event is kept; a full copy of the state (a keyframe) is taken
+     * once the events recorded since the previous keyframe reach the number of entries in that keyframe,
+     * and never more often than every getMinKeyframeInterval() events. Each event adds at most one entry
+     * (apart from the first Estimate event, which sizes the estimates once to V), so keyframe sizes are
+     * bounded by the events between them and the whole trace is O(steps + V).
+     * * seek() restores the closest keyframe at or before the requested step and replays the events after
+     * it, so any step is reconstructed with one state copy and at most one keyframe interval of event
+     * applications. Stepping forward from the current position only applies the next event.
+     */
+    class AlgorithmTrace {
+    private:
+        /**
+         * @brief A full state together with the number of events it includes.
+         */
+        struct Keyframe {
+            std::size_t eventCount;  ///< Number of leading events already applied to @c state.
+            AlgoState state;         ///< The state after those events.
+        };
+
+        std::vector<AlgorithmEvent> m_events;       ///< One event per step; Visiting events store the frontier position in @c target.
+        std::vector<Keyframe> m_keyframes;          ///< Keyframes in increasing eventCount order; the first is the initial state.
+        AlgoState m_recording;                      ///< State after all recorded events, used while recording.
+        AlgoState m_cursor;                         ///< The state last returned by seek().
+        std::size_t m_cursorEvents = 0;             ///< Number of events applied to m_cursor.
+        std::size_t m_minInterval = 64;             ///< Lower bound on the number of events between keyframes.
+
+        /**
+         * @brief Counts the entries held by a state, the cost of copying it.
+         * @param state The state to measure.
+         * @return The total number of vector elements in the state.
+         */
+        static std::size_t stateSize(const AlgoState& state) {
+            return state.frontier.size() + state.visitedVertices.size() + state.visitedEdges.size()
+                 + state.distances.size() + state.estimates.size() + state.shortestPathEdges.size();
+        }
+
+        /**
+         * @brief Estimates the heap memory held by a state.
+         * @param state The state to measure.
+         * @return The bytes of capacity of its vectors.
+         */
+        static std::size_t stateBytes(const AlgoState& state) {
+            return (state.frontier.capacity() + state.visitedVertices.capacity()) * sizeof(int)
+                 + (state.visitedEdges.capacity() + state.shortestPathEdges.capacity()) * sizeof(EdgeId)
+                 + (state.distances.capacity() + state.estimates.capacity()) * sizeof(double);
+        }
+
+        /**
+         * @brief Gets the number of events after the last keyframe at which the next one is due.
+         * @return The current keyframe interval.
+         */
+        std::size_t keyframeInterval() const {
+            return std::max(m_minInterval, stateSize(m_keyframes.back().state));
+        }
+
+        /**
+         * @brief Removes a frontier entry in O(1) by moving the last entry into its place.
+         * @param state The state to update.
+         * @param pos The position of the entry to remove.
+         */
+        static void removeFrontierAt(AlgoState& state, std::size_t pos) {
+            state.frontier[pos] = state.frontier.back();
+            state.frontier.pop_back();
+        }
+
+        /**
+         * @brief Applies a recorded event, using the stored frontier position instead of searching the frontier.
+         * @param state The state to update.
+         * @param event The event as stored in m_events.
+         */
+        static void replay(AlgoState& state, const AlgorithmEvent& event) {
+            if (event.type != EventType::Visiting) {
+                apply(state, event);
+                return;
+            }
+            state.currentVertex = event.vertex;
+            if (event.target >= 0) removeFrontierAt(state, static_cast<std::size_t>(event.target));
+        }
+
+    public:
+        /**
+         * @brief Applies a single event to a state.
+         * * A Visiting vertex leaves the frontier by swapping with its last entry, so the frontier
+         * is kept as an unordered set.
+         * @param state The state to update.
+         * @param event The event to apply.
+         */
+        static void apply(AlgoState& state, const AlgorithmEvent& event) {
+            switch (event.type) {
+                case EventType::Visiting: {
+                    state.currentVertex = event.vertex;
+                    auto it = std::find(state.frontier.begin(), state.frontier.end(), event.vertex);
+                    if (it != state.frontier.end()) removeFrontierAt(state, it - state.frontier.begin());
+                    break;
+                }
+                case EventType::Visited:
+                    state.visitedVertices.push_back(event.vertex);
+                    state.currentVertex = -1;
+                    break;
+                case EventType::Frontier:
+                    state.frontier.push_back(event.vertex);
+                    break;
+                case EventType::Distance:
+                    if (event.vertex >= 0 && event.vertex < static_cast<int>(state.distances.size())) {
+                        state.distances[event.vertex] = event.value;
+                    }
+                    break;
+                case EventType::Tree:
+                    state.visitedEdges.push_back({event.vertex, event.target});
+                    break;
+                case EventType::Path:
+                    state.shortestPathEdges.push_back({event.vertex, event.target});
+                    break;
+                case EventType::Estimate:
+                    if (state.estimates.empty()) {
+                        state.estimates.assign(state.distances.size(), std::numeric_limits<double>::infinity());
+                    }
+                    if (event.vertex >= 0 && event.vertex < static_cast<int>(state.estimates.size())) {
+                        state.estimates[event.vertex] = event.value;
+                    }
+                    break;
+            }
+        }
+
+        /**
+         * @brief Discards the trace and starts a new one.
+         * @param vertexCount The number of vertex IDs, which sizes the distance vector of the initial state.
+         */
+        void reset(std::size_t vertexCount) {
+            m_events.clear();
+            m_keyframes.clear();
+            m_recording = AlgoState();
+            m_recording.distances.assign(vertexCount, std::numeric_limits<double>::infinity());
+            m_keyframes.push_back({0, m_recording});
+            m_cursor = m_recording;
+            m_cursorEvents = 0;
+        }
+
+        /**
+         * @brief Discards the trace and releases its memory.
+         */
+        void clear() {
+            m_events = {};
+            m_keyframes = {};
+            m_recording = AlgoState();
+            m_cursor = AlgoState();
+            m_cursorEvents = 0;
+        }
+
+        /**
+         * @brief Appends an event as the next step.
+         * @param event The event to record.
+         */
+        void record(const AlgorithmEvent& event) {
+            if (m_keyframes.empty()) reset(0);
+            AlgorithmEvent stored = event;
+            if (event.type == EventType::Visiting) {
+                auto it = std::find(m_recording.frontier.begin(), m_recording.frontier.end(), event.vertex);
+                stored.target = it != m_recording.frontier.end() ? static_cast<int>(it - m_recording.frontier.begin()) : -1;
+            }
+            m_events.push_back(stored);
+            replay(m_recording, stored);
+            if (m_events.size() - m_keyframes.back().eventCount >= keyframeInterval()) {
+                m_keyframes.push_back({m_events.size(), m_recording});
+            }
+        }
+
+        /**
+         * @brief Gets the number of recorded steps.
+         * @return The number of events.
+         */
+        std::size_t size() const { return m_events.size(); }
+
+        /**
+         * @brief Checks if no step has been recorded.
+         * @return True if the trace is empty.
+         */
+        bool empty() const { return m_events.empty(); }
+
+        /**
+         * @brief Reconstructs the state at a step.
+         * * Steps forward from the current position when that is no further than from the closest keyframe,
+         * otherwise restores that keyframe first. The returned reference stays valid until the next call.
+         * @param step The step index, clamped to the recorded range.
+         * @return The state after applying events 0..step, or the initial state if nothing was recorded.
+         */
+        const AlgoState& seek(std::size_t step) {
+            if (m_keyframes.empty()) return m_cursor;
+            std::size_t target = m_events.empty() ? 0 : std::min(step, m_events.size() - 1) + 1;
+
+            auto next = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), target,
+                                         [](std::size_t count, const Keyframe& k) { return count < k.eventCount; });
+            const Keyframe& keyframe = *(next - 1);
+            if (m_cursorEvents > target || keyframe.eventCount > m_cursorEvents) {
+                m_cursor = keyframe.state;
+                m_cursorEvents = keyframe.eventCount;
+            }
+            for (; m_cursorEvents < target; ++m_cursorEvents) replay(m_cursor, m_events[m_cursorEvents]);
+            return m_cursor;
+        }
+
+        /**
+         * @brief Sets the minimum number of events between two keyframes.
+         * * Smaller values make seeking faster on small states at the cost of more keyframes.
+         * Applies to keyframes taken after the call.
+         * @param interval The new lower bound, at least 1.
+         */
+        void setMinKeyframeInterval(std::size_t interval) { m_minInterval = std::max<std::size_t>(1, interval); }
+
+        /**
+         * @brief Gets the minimum number of events between two keyframes.
+         * @return The lower bound set by setMinKeyframeInterval().
+         */
+        std::size_t getMinKeyframeInterval() const { return m_minInterval; }
+
+        /**
+         * @brief Gets the number of stored keyframes, including the initial state.
+         * @return The keyframe count.
+         */
+        std::size_t getKeyframeCount() const { return m_keyframes.size(); }
+
+        /**
+         * @brief Estimates the heap memory held by the trace.
+         * @return The bytes used by the events, the keyframes and the two working states.
+         */
+        std::size_t getMemoryFootprint() const {
+            std::size_t bytes = m_events.capacity() * sizeof(AlgorithmEvent)
+                              + m_keyframes.capacity() * sizeof(Keyframe)
+                              + stateBytes(m_recording) + stateBytes(m_cursor);
+            for (const auto& k : m_keyframes) bytes += stateBytes(k.state);
+            return bytes;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+/**
+* @file AlgorithmWorker.h
+ * @brief Runs a graph algorithm on a background thread and streams its events to the owner.
+ */
+
+#pragma once
+#include "Algorithm.h"
+#include "AlgorithmEvent.h"
+#include "CsrGraph.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <stop_token>
+#include <cstddef>
+
+namespace Algorithms {
+
+    /**
+     * @brief Executes one algorithm run on its own thread over a private snapshot of the graph.
+     * * The graph is frozen into a Core::CsrGraph on construction, so the caller may edit or destroy
+     * the source graph while the run is in progress. Events travel to the owning thread through a
+     * Core::SpscQueue that the owner empties with drain(); when the queue is full the worker waits, so
+     * memory stays bounded however fast the algorithm produces events. The run is advanced one vertex
+     * at a time and checks its stop token between vertices, so cancel() returns after at most one
+     * vertex expansion.
+     * * Every public method must be called from the thread that created the worker.
+     * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class AlgorithmWorker {
+    public:
+        /**
+         * @brief Snapshots the graph and starts the run on a new thread.
+         * * @param algorithm The algorithm to run; the worker takes ownership.
+         * @param graph The graph to run on. Only read during construction.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1.
+         * @param queueCapacity The number of events that may wait in the queue before the worker blocks.
+         */
+        AlgorithmWorker(std::unique_ptr<Algorithm<TVertex, TWeight>> algorithm, const Core::Graph<TVertex, TWeight>& graph,
+                        int startId, int endId, std::size_t queueCapacity = 1 << 16)
+            : m_algorithm(std::move(algorithm)), m_snapshot(graph), m_queue(queueCapacity),
+              m_thread([this, startId, endId](std::stop_token token) { work(token, startId, endId); }) {}
+
+        AlgorithmWorker(const AlgorithmWorker&) = delete;
+        AlgorithmWorker& operator=(const AlgorithmWorker&) = delete;
+
+        /**
+         * @brief Cancels the run if still in progress and waits for the thread to exit.
+         */
+        ~AlgorithmWorker() { cancel(); }
+
+        /**
+         * @brief Passes every event received so far to a function.
+         * * @param fn Function invoked with a const AlgorithmEvent& for each event, in order.
+         * @return The number of events passed.
+         */
+        template <typename Fn>
+        std::size_t drain(Fn&& fn) { return m_queue.drain(fn); }
+
+        /**
+         * @brief Asks the run to stop and waits for the thread to exit.
+         * * Events produced before the stop remain in the queue and can still be drained.
+         */
+        void cancel() {
+            if (!m_thread.joinable()) return;
+            m_thread.request_stop();
+            m_thread.join();
+        }
+
+        /**
+         * @brief Checks if the run has ended and every event has been drained.
+         * * @return true If no further event will arrive.
+         */
+        bool isFinished() const {
+            return m_done.load(std::memory_order_acquire) && m_queue.empty();
+        }
+
+        /**
+         * @brief Checks if the run was stopped before the algorithm finished.
+         * * @return true If cancel() interrupted the run.
+         */
+        bool wasCancelled() const { return m_cancelled.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Gets the number of vertices the algorithm has expanded so far.
+         * * @return The count of completed advance() calls.
+         */
+        std::size_t getExpandedCount() const { return m_expanded.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Estimates how far the run has progressed.
+         * * @return The expanded vertices divided by the vertices of the snapshot, capped at 1.
+         * The run may end below 1 when not every vertex is reachable or a target is found early.
+         */
+        double getProgress() const {
+            int count = m_snapshot.getVertexCount();
+            if (count <= 0) return 1.0;
+            double progress = static_cast<double>(getExpandedCount()) / count;
+            return progress < 1.0 ? progress : 1.0;
+        }
+
+    private:
+        /**
+         * @brief The body of the worker thread.
+         * * @param token Stop token of the thread, set by cancel().
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1.
+         */
+        void work(std::stop_token token, int startId, int endId) {
+            auto sink = [&](const AlgorithmEvent& event) {
+                while (!m_queue.tryPush(event)) {
+                    if (token.stop_requested()) return;
+                    std::this_thread::yield();
+                }
+            };
+            if (m_algorithm->begin(&m_snapshot, startId, endId, sink)) {
+                while (!token.stop_requested() && m_algorithm->advance(sink)) {
+                    m_expanded.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (token.stop_requested()) m_cancelled.store(true, std::memory_order_release);
+            m_done.store(true, std::memory_order_release);
+        }
+
+        std::unique_ptr<Algorithm<TVertex, TWeight>> m_algorithm;  ///< The algorithm, used only by the worker thread.
+        Core::CsrGraph<TVertex, TWeight> m_snapshot;               ///< Private immutable copy of the graph.
+        Core::SpscQueue<AlgorithmEvent> m_queue;                   ///< Events on their way to the owning thread.
+        std::atomic<std::size_t> m_expanded{0};                    ///< Number of vertices expanded, for progress reporting.
+        std::atomic<bool> m_cancelled{false};                      ///< Set if the run stopped before finishing.
+        std::atomic<bool> m_done{false};                           ///< Set once the worker has pushed its last event.
+        std::jthread m_thread;                                     ///< The worker thread; declared last so it starts after the members above.
+    };
+}
\ No newline at end of file
@@ -5,80 +5,181 @@
 
 #pragma once
 #include "Algorithm.h"
-#include <queue>
 #include <vector>
+#include <cstddef>
 
 namespace Algorithms {
 
     /**
      * @brief Implements the Breadth-First Search (BFS) algorithm.
      * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
      */
-    template<typename TVertex = Core::Vertex>
-    class BFS : public Algorithm<TVertex> {
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class BFS : public Algorithm<TVertex, TWeight> {
     public:
         /**
-         * @brief Runs the BFS algorithm on the given graph.
+         * @brief Runs the BFS algorithm on the given graph, reporting through a type-erased sink.
          * * @param graph Pointer to the graph to traverse.
          * @param startId The ID of the starting vertex.
          * @param endId The ID of the target vertex. Traversal stops early if this is reached.
-         * @param vertexCb Callback invoked during vertex state changes.
-         * @param edgeCb Callback invoked during edge state changes.
+         * @param sink Receiver of the progress events.
          * @return true If the algorithm completed without initialization errors.
          * @return false If the graph is null or startId does not exist.
          */
-        bool run(const Core::Graph<TVertex>* graph, int startId, int endId,
-                 typename Algorithm<TVertex>::VertexCallback vertexCb,
-                 typename Algorithm<TVertex>::EdgeCallback edgeCb) override
-        {
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return traverse(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Runs the BFS algorithm on the given graph, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+         * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return traverse(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable BFS run, reporting through a type-erased sink.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable BFS run, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Dequeues and expands the next vertex, reporting through a type-erased sink.
+         * * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         * @return false If the traversal has finished.
+         */
+        bool advance(EventSinkRef sink) override { return expand(sink); }
+
+        /**
+         * @brief Dequeues and expands the next vertex, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         * @return false If the traversal has finished.
+         */
+        template <typename Sink = NullSink>
+        bool advance(Sink&& sink = {}) { return expand(sink); }
+
+        /**
+         * @brief Checks if the BFS algorithm has completed execution.
+         * * @return true If the execution has finished.
+         * @return false Otherwise.
+         */
+        bool isFinished() const override { return m_finished; }
+
+    private:
+        /**
+         * @brief The traversal shared by both run() overloads: a begin() followed by advance() until done.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         */
+        template <typename Sink>
+        bool traverse(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+            if (!initialize(graph, startId, endId, sink)) return false;
+            while (expand(sink));
+            return true;
+        }
+
+        /**
+         * @brief Resets the traversal state and enqueues the start vertex.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         */
+        template <typename Sink>
+        bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
             if (!graph || !graph->hasVertex(startId)) return false;
 
+            m_graph = graph;
+            m_endId = endId;
             m_finished = false;
-            size_t maxId = graph->getVertexCount();
-            m_visited.assign(maxId, false);
-            m_queue = std::queue<int>();
+            m_workspace = &this->getWorkspace();
+            m_workspace->reset(graph->getVertexCount());
+            m_queue.clear();
+            m_head = 0;
 
-            m_queue.push(startId);
-            m_visited[startId] = true;
+            m_queue.push_back(startId);
+            m_workspace->reach(startId);
+
+            emitVertex(sink, EventType::Frontier, startId);
+            return true;
+        }
 
-            if (vertexCb) vertexCb(startId, "frontier");
+        /**
+         * @brief Expands the vertex at the head of the queue.
+         * * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         */
+        template <typename Sink>
+        bool expand(Sink& sink) {
+            if (m_finished || !m_graph) return false;
 
-            while (!m_queue.empty()) {
-                int current = m_queue.front();
-                m_queue.pop();
+            while (m_head < m_queue.size()) {
+                int current = m_queue[m_head++];
 
-                if (!graph->hasVertex(current)) continue;
+                if (!m_graph->hasVertex(current)) continue;
 
-                if (vertexCb) vertexCb(current, "visiting");
+                emitVertex(sink, EventType::Visiting, current);
 
-                std::vector<int> neighbors = graph->getNeighbors(current);
-                for (int neighbor : neighbors) {
-                    if (graph->hasVertex(neighbor) && !m_visited[neighbor]) {
-                        m_visited[neighbor] = true;
-                        m_queue.push(neighbor);
+                m_graph->forEachNeighbor(current, [&](int neighbor) {
+                    if (m_workspace->reach(neighbor)) {
+                        m_queue.push_back(neighbor);
 
-                        if (edgeCb) edgeCb(current, neighbor, "tree");
-                        if (vertexCb) vertexCb(neighbor, "frontier");
+                        emitEdge(sink, EventType::Tree, current, neighbor);
+                        emitVertex(sink, EventType::Frontier, neighbor);
                     }
-                }
-                if (vertexCb) vertexCb(current, "visited");
-                if (endId != -1 && current == endId) break;
+                });
+                emitVertex(sink, EventType::Visited, current);
+                if (m_endId != -1 && current == m_endId) break;
+                if (m_head < m_queue.size()) return true;
             }
 
             m_finished = true;
-            return true;
+            return false;
         }
 
-        /**
-         * @brief Checks if the BFS algorithm has completed execution.
-         * * @return true If the execution has finished.
-         * @return false Otherwise.
-         */
-        bool isFinished() const override { return m_finished; }
-
-    private:
+        const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+        int m_endId = -1;                  ///< Target vertex of the current run, -1 for a full traversal.
         bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
-        std::vector<bool> m_visited;       ///< Tracks which vertices have been visited to prevent processing duplicates.
-        std::queue<int> m_queue;           ///< Queue used to maintain the BFS frontier.
+        TraversalWorkspace<TWeight>* m_workspace = nullptr; ///< Reached flags of the current run, so duplicates are not queued.
+        std::vector<int> m_queue;          ///< Every vertex discovered so far in FIFO order; reused between runs to avoid reallocating.
+        std::size_t m_head = 0;            ///< Index in m_queue of the next vertex to expand.
     };
 }
\ No newline at end of file
@@ -0,0 +1,320 @@
+/**
+* @file BidirectionalBFS.h
+ * @brief Breadth-First Search from both ends of a point-to-point query.
+ */
+
+#pragma once
+#include "Algorithm.h"
+#include <vector>
+#include <cstddef>
+
+namespace Algorithms {
+
+    /**
+     * @brief Finds a path with the fewest edges by growing BFS levels from the start and from the target.
+     * * The forward search follows outgoing edges from the start; the backward search follows incoming
+     * edges (Core::Graph::forEachEdgeTo) from the target. Each step expands one vertex of the side whose
+     * next level is smaller. When an edge reaches a vertex already reached by the other side, the length of
+     * the path through it is a candidate; the search ends once the level in which the first candidate
+     * appeared is complete, since any shorter path would have met in an earlier level. Both balls then
+     * have about half the radius of a one-sided search, which on sparse graphs touches far fewer vertices.
+     * * Without a target (endId -1) only the forward side runs, as a plain level-by-level BFS.
+     * Tree edges of the backward side are reported in their real direction, and the finishing step
+     * reports the path found as Path events.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class BidirectionalBFS : public Algorithm<TVertex, TWeight> {
+    private:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+    public:
+        /**
+         * @brief Runs the bidirectional BFS on the given graph, reporting through a type-erased sink.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1 for a one-sided traversal.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         * @return false If the graph is null or startId does not exist.
+         */
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return traverse(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Runs the bidirectional BFS on the given graph, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+         * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1 for a one-sided traversal.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return traverse(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable bidirectional BFS run, reporting through a type-erased sink.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1 for a one-sided traversal.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable bidirectional BFS run, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1 for a one-sided traversal.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Expands the next vertex of the smaller side, reporting through a type-erased sink.
+         * * The step that finishes the run also reports the path found, if any.
+         * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         * @return false If the search has finished.
+         */
+        bool advance(EventSinkRef sink) override { return expand(sink); }
+
+        /**
+         * @brief Expands the next vertex of the smaller side, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         * @return false If the search has finished.
+         */
+        template <typename Sink = NullSink>
+        bool advance(Sink&& sink = {}) { return expand(sink); }
+
+        /**
+         * @brief Checks if the bidirectional BFS has completed execution.
+         * * @return true If the execution has finished.
+         * @return false Otherwise.
+         */
+        bool isFinished() const override { return m_finished; }
+
+        /**
+         * @brief Gets the number of edges of the path found by the last run.
+         * * @return The path length, or infinity if the target is unreachable or no target was given.
+         */
+        Distance getPathLength() const { return m_best; }
+
+        /**
+         * @brief Gets the hop counts of the backward side, measured towards the target.
+         * * The forward hop counts are in getWorkspace().
+         * @return The workspace of the backward search.
+         */
+        const TraversalWorkspace<TWeight>& getBackwardWorkspace() const { return m_backward; }
+
+    private:
+        static constexpr int FORWARD = 0;   ///< Index of the side searching from the start.
+        static constexpr int BACKWARD = 1;  ///< Index of the side searching from the target.
+
+        /**
+         * @brief The state of one search direction.
+         */
+        struct Side {
+            TraversalWorkspace<TWeight>* workspace = nullptr; ///< Hop counts and tree parents of this side.
+            std::vector<int> queue;                           ///< Every vertex discovered by this side, in FIFO order.
+            std::size_t head = 0;                             ///< Index in queue of the next vertex to expand.
+            std::size_t levelEnd = 0;                         ///< End in queue of the level being expanded.
+        };
+
+        /**
+         * @brief The search shared by both run() overloads: a begin() followed by advance() until done.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         */
+        template <typename Sink>
+        bool traverse(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+            if (!initialize(graph, startId, endId, sink)) return false;
+            while (expand(sink));
+            return true;
+        }
+
+        /**
+         * @brief Resets both sides and enqueues the start and the target.
+         * * @param graph Pointer to the graph to traverse.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         */
+        template <typename Sink>
+        bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+            if (!graph || !graph->hasVertex(startId)) return false;
+
+            m_graph = graph;
+            m_startId = startId;
+            m_endId = graph->hasVertex(endId) ? endId : -1;
+            m_finished = false;
+            m_best = Traits::infinity();
+            m_meetTail = m_meetHead = -1;
+            m_side = FORWARD;
+            m_sides[FORWARD].workspace = &this->getWorkspace();
+            m_sides[BACKWARD].workspace = &m_backward;
+            for (Side& side : m_sides) {
+                side.workspace->reset(graph->getVertexCount());
+                side.queue.clear();
+                side.head = side.levelEnd = 0;
+            }
+
+            enqueueRoot(FORWARD, startId, sink);
+            if (m_endId == startId) {
+                m_best = 0;
+                m_meetTail = m_meetHead = startId;
+            } else if (m_endId != -1) {
+                enqueueRoot(BACKWARD, m_endId, sink);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Expands the next vertex, or finishes the run.
+         * * @param sink Receiver of the events of this step.
+         * @return true If vertices remain to be expanded.
+         */
+        template <typename Sink>
+        bool expand(Sink& sink) {
+            if (m_finished || !m_graph) return false;
+
+            while (selectSide()) {
+                Side& side = m_sides[m_side];
+                int current = side.queue[side.head++];
+                if (!m_graph->hasVertex(current)) continue;
+
+                emitVertex(sink, EventType::Visiting, current);
+                Distance next = side.workspace->getDistance(current) + 1;
+                auto scan = [&](int neighbor, TWeight) { discover(current, neighbor, next, sink); };
+                if (m_side == FORWARD) m_graph->forEachEdgeFrom(current, scan);
+                else m_graph->forEachEdgeTo(current, scan);
+                emitVertex(sink, EventType::Visited, current);
+
+                if (selectSide()) return true;
+            }
+
+            emitPath(sink);
+            m_finished = true;
+            return false;
+        }
+
+        /**
+         * @brief Records an edge scanned by the current side and checks if it meets the other side.
+         * * @param current The expanded vertex.
+         * @param neighbor The vertex at the other end of the edge.
+         * @param distance The hop count of @p neighbor through @p current.
+         * @param sink Receiver of the events.
+         */
+        template <typename Sink>
+        void discover(int current, int neighbor, Distance distance, Sink& sink) {
+            Side& side = m_sides[m_side];
+            bool forward = m_side == FORWARD;
+            if (!side.workspace->isReached(neighbor)) {
+                side.workspace->setDistance(neighbor, distance, current);
+                side.queue.push_back(neighbor);
+
+                if (forward) emitEdge(sink, EventType::Tree, current, neighbor);
+                else emitEdge(sink, EventType::Tree, neighbor, current);
+                emitVertex(sink, EventType::Frontier, neighbor);
+            }
+
+            const TraversalWorkspace<TWeight>& other = *m_sides[1 - m_side].workspace;
+            if (m_endId != -1 && other.isReached(neighbor) && distance + other.getDistance(neighbor) < m_best) {
+                m_best = distance + other.getDistance(neighbor);
+                m_meetTail = forward ? current : neighbor;
+                m_meetHead = forward ? neighbor : current;
+            }
+        }
+
+        /**
+         * @brief Makes sure m_side has a vertex to expand, starting a new level when one is complete.
+         * * A new level goes to the side with fewer queued vertices. The search stops at the end of a
+         * level once a path is known, or when one side runs out, since the ends are then disconnected.
+         * @return true If the search goes on.
+         */
+        bool selectSide() {
+            Side& current = m_sides[m_side];
+            if (current.head < current.levelEnd) return true;
+            if (m_best != Traits::infinity()) return false;
+
+            std::size_t pending[2];
+            for (int i = 0; i < 2; ++i) pending[i] = m_sides[i].queue.size() - m_sides[i].head;
+            if (m_endId == -1) {
+                if (pending[FORWARD] == 0) return false;
+                m_side = FORWARD;
+            } else {
+                if (pending[FORWARD] == 0 || pending[BACKWARD] == 0) return false;
+                m_side = pending[BACKWARD] < pending[FORWARD] ? BACKWARD : FORWARD;
+            }
+            m_sides[m_side].levelEnd = m_sides[m_side].queue.size();
+            return true;
+        }
+
+        /**
+         * @brief Queues the root of one side.
+         * * @param index FORWARD or BACKWARD.
+         * @param id The start or target vertex.
+         * @param sink Receiver of the events.
+         */
+        template <typename Sink>
+        void enqueueRoot(int index, int id, Sink& sink) {
+            m_sides[index].workspace->setDistance(id, 0, -1);
+            m_sides[index].queue.push_back(id);
+            emitVertex(sink, EventType::Frontier, id);
+        }
+
+        /**
+         * @brief Reports the path through the meeting edge: the forward tree back to the start, then the backward tree to the target.
+         * * @param sink Receiver of the Path events.
+         */
+        template <typename Sink>
+        void emitPath(Sink& sink) {
+            if (m_meetTail == -1) return;
+            for (int curr = m_meetTail; curr != m_startId && curr != -1;) {
+                int prev = m_sides[FORWARD].workspace->getPrevious(curr);
+                if (prev != -1) emitEdge(sink, EventType::Path, prev, curr);
+                curr = prev;
+            }
+            if (m_meetTail != m_meetHead) emitEdge(sink, EventType::Path, m_meetTail, m_meetHead);
+            for (int curr = m_meetHead; curr != m_endId && curr != -1;) {
+                int next = m_sides[BACKWARD].workspace->getPrevious(curr);
+                if (next != -1) emitEdge(sink, EventType::Path, curr, next);
+                curr = next;
+            }
+        }
+
+        const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+        int m_startId = -1;                ///< Start vertex of the current run.
+        int m_endId = -1;                  ///< Target vertex of the current run, -1 for a one-sided traversal.
+        bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
+        Side m_sides[2];                   ///< The forward and backward searches.
+        int m_side = FORWARD;              ///< The side whose level is being expanded.
+        TraversalWorkspace<TWeight> m_backward; ///< State of the backward side; the forward side uses getWorkspace().
+        Distance m_best = Traits::infinity();   ///< Length of the shortest path found so far.
+        int m_meetTail = -1;               ///< Forward-reached end of the edge where the best path meets.
+        int m_meetHead = -1;               ///< Backward-reached end of that edge.
+    };
+}
\ No newline at end of file
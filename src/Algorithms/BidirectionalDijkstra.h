@@ -0,0 +1,328 @@
+/**
+* @file BidirectionalDijkstra.h
+ * @brief Dijkstra's algorithm from both ends of a point-to-point query.
+ */
+
+#pragma once
+#include "Algorithm.h"
+#include "PriorityQueues.h"
+#include <type_traits>
+
+namespace Algorithms {
+
+/**
+ * @brief Finds a shortest path by settling vertices from the start and from the target alternately.
+ * * The forward search relaxes outgoing edges from the start; the backward search relaxes incoming
+ * edges (Core::Graph::forEachEdgeTo) from the target, computing distances to it. Each step settles
+ * the closest queued vertex of either side. Whenever an edge reaches a vertex the other side has a
+ * distance for, the length of the path through that edge is a candidate. The search stops as soon as
+ * the smallest queued keys of the two sides add up to at least the best candidate: every path not yet
+ * seen must be at least that long. The two balls have about half the radius of a one-sided search.
+ * * Without a target (endId -1) only the forward side runs, as a plain Dijkstra.
+ * Distance events carry the distance from the start for forward-reached vertices and to the target
+ * for backward-reached ones, tree edges are reported in their real direction, and the finishing step
+ * reports the shortest path as Path events.
+ * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+ * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+ * @tparam TQueue The vertex priority queue of each side (see PriorityQueues.h), keyed on the distance type.
+ */
+template<typename TVertex = Core::Vertex, typename TWeight = double,
+         typename TQueue = DefaultDistanceQueue<typename Core::WeightTraits<TWeight>::Distance>>
+class BidirectionalDijkstra : public Algorithm<TVertex, TWeight> {
+private:
+    using Traits = Core::WeightTraits<TWeight>;
+    using Distance = typename Traits::Distance;
+    using Entry = typename TQueue::Entry;
+
+    static_assert(std::is_same_v<typename TQueue::Key, Distance>, "The queue must be keyed on the distance type");
+
+public:
+    /**
+     * @brief Runs the bidirectional search on the given graph, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex, or -1 for a one-sided search.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Runs the bidirectional search on the given graph, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex, or -1 for a one-sided search.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable bidirectional search, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex, or -1 for a one-sided search.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable bidirectional search, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex, or -1 for a one-sided search.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Settles the next closest vertex of either side, reporting through a type-erased sink.
+     * * The step that finishes the run also reports the shortest path, if any.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    bool advance(EventSinkRef sink) override { return settle(sink); }
+
+    /**
+     * @brief Settles the next closest vertex of either side, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    template <typename Sink = NullSink>
+    bool advance(Sink&& sink = {}) { return settle(sink); }
+
+    /**
+     * @brief Checks if the bidirectional search has completed execution.
+     * * @return true If the execution has finished.
+     * @return false Otherwise.
+     */
+    bool isFinished() const override { return m_finished; }
+
+    /**
+     * @brief Gets the length of the shortest path found by the last run.
+     * * @return The distance from the start to the target, or infinity if it is unreachable or no target was given.
+     */
+    Distance getPathLength() const { return m_best; }
+
+    /**
+     * @brief Gets the distances to the target computed by the backward side.
+     * * The forward distances are in getWorkspace().
+     * @return The workspace of the backward search.
+     */
+    const TraversalWorkspace<TWeight>& getBackwardWorkspace() const { return m_backward; }
+
+private:
+    static constexpr int FORWARD = 0;   ///< Index of the side searching from the start.
+    static constexpr int BACKWARD = 1;  ///< Index of the side searching from the target.
+
+    /**
+     * @brief The state of one search direction.
+     */
+    struct Side {
+        TraversalWorkspace<TWeight>* workspace = nullptr; ///< Distances and tree parents of this side.
+        TQueue queue;                                     ///< Vertices waiting to be settled, reused between runs.
+        Entry next{};                                     ///< The next vertex to settle, valid if hasNext.
+        bool hasNext = false;                             ///< True if next was popped but not settled yet.
+    };
+
+    /**
+     * @brief The search shared by both run() overloads: a begin() followed by advance() until done.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     */
+    template <typename Sink>
+    bool search(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!initialize(graph, startId, endId, sink)) return false;
+        while (settle(sink));
+        return true;
+    }
+
+    /**
+     * @brief Resets both sides and queues the start and the target.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     */
+    template <typename Sink>
+    bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!graph || !graph->hasVertex(startId)) return false;
+
+        m_graph = graph;
+        m_startId = startId;
+        m_endId = graph->hasVertex(endId) ? endId : -1;
+        m_finished = false;
+        m_best = Traits::infinity();
+        m_meetTail = m_meetHead = -1;
+        m_sides[FORWARD].workspace = &this->getWorkspace();
+        m_sides[BACKWARD].workspace = &m_backward;
+        for (Side& side : m_sides) {
+            side.workspace->reset(graph->getVertexCount());
+            side.queue.reset(graph->getVertexCount());
+            side.hasNext = false;
+        }
+
+        enqueueRoot(FORWARD, startId, sink);
+        if (m_endId == startId) {
+            m_best = 0;
+            m_meetTail = m_meetHead = startId;
+        } else if (m_endId != -1) {
+            enqueueRoot(BACKWARD, m_endId, sink);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Settles the closest vertex of the side with the smaller key, or finishes the run.
+     * * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     */
+    template <typename Sink>
+    bool settle(Sink& sink) {
+        if (m_finished || !m_graph) return false;
+
+        int index = selectSide();
+        if (index >= 0) {
+            Side& side = m_sides[index];
+            side.hasNext = false;
+            int u = side.next.id;
+            Distance du = side.next.key;
+            bool forward = index == FORWARD;
+            TraversalWorkspace<TWeight>& mine = *side.workspace;
+            const TraversalWorkspace<TWeight>& other = *m_sides[1 - index].workspace;
+
+            emitVertex(sink, EventType::Visiting, u);
+            auto relax = [&](int v, TWeight weight) {
+                Distance newDist = du + static_cast<Distance>(weight);
+                if (newDist < mine.getDistance(v)) {
+                    mine.setDistance(v, newDist, u);
+                    side.queue.push(v, newDist);
+
+                    if (forward) emitEdge(sink, EventType::Tree, u, v);
+                    else emitEdge(sink, EventType::Tree, v, u);
+                    emitVertex(sink, EventType::Distance, v, static_cast<double>(newDist));
+                    emitVertex(sink, EventType::Frontier, v);
+                }
+                if (m_endId != -1 && other.isReached(v) && newDist + other.getDistance(v) < m_best) {
+                    m_best = newDist + other.getDistance(v);
+                    m_meetTail = forward ? u : v;
+                    m_meetHead = forward ? v : u;
+                }
+            };
+            if (forward) m_graph->forEachEdgeFrom(u, relax);
+            else m_graph->forEachEdgeTo(u, relax);
+            emitVertex(sink, EventType::Visited, u);
+
+            if (selectSide() >= 0) return true;
+        }
+
+        emitPath(sink);
+        m_finished = true;
+        return false;
+    }
+
+    /**
+     * @brief Picks the side to settle next, or decides that the search is over.
+     * * Peeks at the closest valid entry of each running side, dropping outdated entries and
+     * entries of vertices removed from the graph. The search ends when a running side is empty,
+     * or when the two smallest keys add up to at least the best path found.
+     * @return FORWARD or BACKWARD, or -1 to finish.
+     */
+    int selectSide() {
+        int sides = m_endId == -1 ? 1 : 2;
+        for (int i = 0; i < sides; ++i) {
+            if (!peek(m_sides[i])) return -1;
+        }
+        if (sides == 1) return FORWARD;
+        Distance forwardKey = m_sides[FORWARD].next.key;
+        Distance backwardKey = m_sides[BACKWARD].next.key;
+        if (m_best != Traits::infinity() && forwardKey + backwardKey >= m_best) return -1;
+        return backwardKey < forwardKey ? BACKWARD : FORWARD;
+    }
+
+    /**
+     * @brief Makes sure a side's next entry is known.
+     * * @param side The side to look at.
+     * @return true If the side has a vertex to settle.
+     */
+    bool peek(Side& side) {
+        while (!side.hasNext) {
+            if (side.queue.empty()) return false;
+            Entry entry = side.queue.pop();
+            if (!m_graph->hasVertex(entry.id) || entry.key > side.workspace->getDistance(entry.id)) continue;
+            side.next = entry;
+            side.hasNext = true;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gives a side its root at distance 0.
+     * * @param index FORWARD or BACKWARD.
+     * @param id The start or target vertex.
+     * @param sink Receiver of the events.
+     */
+    template <typename Sink>
+    void enqueueRoot(int index, int id, Sink& sink) {
+        m_sides[index].workspace->setDistance(id, 0, -1);
+        m_sides[index].queue.push(id, 0);
+        emitVertex(sink, EventType::Distance, id, 0.0);
+        emitVertex(sink, EventType::Frontier, id);
+    }
+
+    /**
+     * @brief Reports the path through the meeting edge: the forward tree back to the start, then the backward tree to the target.
+     * * @param sink Receiver of the Path events.
+     */
+    template <typename Sink>
+    void emitPath(Sink& sink) {
+        if (m_meetTail == -1) return;
+        for (int curr = m_meetTail; curr != m_startId && curr != -1;) {
+            int prev = m_sides[FORWARD].workspace->getPrevious(curr);
+            if (prev != -1) emitEdge(sink, EventType::Path, prev, curr);
+            curr = prev;
+        }
+        if (m_meetTail != m_meetHead) emitEdge(sink, EventType::Path, m_meetTail, m_meetHead);
+        for (int curr = m_meetHead; curr != m_endId && curr != -1;) {
+            int next = m_sides[BACKWARD].workspace->getPrevious(curr);
+            if (next != -1) emitEdge(sink, EventType::Path, curr, next);
+            curr = next;
+        }
+    }
+
+    const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+    int m_startId = -1;                ///< Start vertex of the current run.
+    int m_endId = -1;                  ///< Target vertex of the current run, -1 for a one-sided search.
+    bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
+    Side m_sides[2];                   ///< The forward and backward searches.
+    TraversalWorkspace<TWeight> m_backward; ///< State of the backward side; the forward side uses getWorkspace().
+    Distance m_best = Traits::infinity();   ///< Length of the shortest path found so far.
+    int m_meetTail = -1;               ///< Forward-reached end of the edge where the best path meets.
+    int m_meetHead = -1;               ///< Backward-reached end of that edge.
+};
+}
\ No newline at end of file
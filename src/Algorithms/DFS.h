@@ -5,72 +5,94 @@
 
 #pragma once
 #include "Algorithm.h"
-#include <stack>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
 
 namespace Algorithms {
 
 /**
  * @brief Implements the Depth-First Search (DFS) algorithm.
  * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+ * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
  */
-template<typename TVertex = Core::Vertex>
-class DFS : public Algorithm<TVertex> {
+template<typename TVertex = Core::Vertex, typename TWeight = double>
+class DFS : public Algorithm<TVertex, TWeight> {
 public:
     /**
-     * @brief Runs the DFS algorithm on the given graph.
+     * @brief Runs the DFS algorithm on the given graph, reporting through a type-erased sink.
      * * @param graph Pointer to the graph to traverse.
      * @param startId The ID of the starting vertex.
      * @param endId The ID of the target vertex. Traversal stops early if this is reached.
-     * @param vertexCb Callback invoked during vertex state changes.
-     * @param edgeCb Callback invoked during edge state changes.
+     * @param sink Receiver of the progress events.
      * @return true If the algorithm completed without initialization errors.
      * @return false If the graph is null or startId does not exist.
      */
-    bool run(const Core::Graph<TVertex>* graph, int startId, int endId,
-             typename Algorithm<TVertex>::VertexCallback vertexCb,
-             typename Algorithm<TVertex>::EdgeCallback edgeCb) override
-    {
-        if (!graph || !graph->hasVertex(startId)) return false;
-
-        m_finished = false;
-        size_t maxId = graph->getVertexCount();
-        m_visited.assign(maxId, false);
-        m_stack = std::stack<int>();
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return traverse(graph, startId, endId, sink);
+    }
 
-        m_stack.push(startId);
+    /**
+     * @brief Runs the DFS algorithm on the given graph, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+     * @param graph Pointer to the graph to traverse.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return traverse(graph, startId, endId, sink);
+    }
 
-        while (!m_stack.empty()) {
-            int current = m_stack.top();
-            m_stack.pop();
-
-            if (!graph->hasVertex(current)) continue;
-
-            if (!m_visited[current]) {
-                m_visited[current] = true;
-                if (vertexCb) vertexCb(current, "visiting");
-                if (endId != -1 && current == endId) {
-                    if (vertexCb) vertexCb(current, "visited");
-                    break;
-                }
-
-                std::vector<int> neighbors = graph->getNeighbors(current);
-                for (auto it = neighbors.rbegin(); it != neighbors.rend(); ++it) {
-                    int neighbor = *it;
-                    if (graph->hasVertex(neighbor) && !m_visited[neighbor]) {
-                        m_stack.push(neighbor);
-                        if (edgeCb) edgeCb(current, neighbor, "tree");
-                        if (vertexCb) vertexCb(neighbor, "frontier");
-                    }
-                }
-                if (vertexCb) vertexCb(current, "visited");
-            }
-        }
+    /**
+     * @brief Prepares a resumable DFS run, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to traverse.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return initialize(graph, startId, endId, sink);
+    }
 
-        m_finished = true;
-        return true;
+    /**
+     * @brief Prepares a resumable DFS run, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param graph Pointer to the graph to traverse.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. Traversal stops early if this is reached.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return initialize(graph, startId, endId, sink);
     }
 
+    /**
+     * @brief Pops and expands the next unvisited vertex, reporting through a type-erased sink.
+     * * @param sink Receiver of the events of this step.
+     * @return true If vertices remain on the stack.
+     * @return false If the traversal has finished.
+     */
+    bool advance(EventSinkRef sink) override { return expand(sink); }
+
+    /**
+     * @brief Pops and expands the next unvisited vertex, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain on the stack.
+     * @return false If the traversal has finished.
+     */
+    template <typename Sink = NullSink>
+    bool advance(Sink&& sink = {}) { return expand(sink); }
+
     /**
      * @brief Checks if the DFS algorithm has completed execution.
      * * @return true If the execution has finished.
@@ -79,8 +101,88 @@ public:
     bool isFinished() const override { return m_finished; }
 
 private:
+    /**
+     * @brief The traversal shared by both run() overloads: a begin() followed by advance() until done.
+     * * @param graph Pointer to the graph to traverse.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     */
+    template <typename Sink>
+    bool traverse(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!initialize(graph, startId, endId, sink)) return false;
+        while (expand(sink));
+        return true;
+    }
+
+    /**
+     * @brief Resets the traversal state and pushes the start vertex.
+     * * @param graph Pointer to the graph to traverse.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events (none for DFS).
+     * @return true If the run was set up.
+     */
+    template <typename Sink>
+    bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        (void)sink;
+        if (!graph || !graph->hasVertex(startId)) return false;
+
+        m_graph = graph;
+        m_endId = endId;
+        m_finished = false;
+        m_workspace = &this->getWorkspace();
+        m_workspace->reset(graph->getVertexCount());
+        m_stack.clear();
+
+        m_stack.push_back(startId);
+        return true;
+    }
+
+    /**
+     * @brief Expands the first unvisited vertex popped from the stack.
+     * * @param sink Receiver of the events of this step.
+     * @return true If vertices remain on the stack.
+     */
+    template <typename Sink>
+    bool expand(Sink& sink) {
+        if (m_finished || !m_graph) return false;
+
+        while (!m_stack.empty()) {
+            int current = m_stack.back();
+            m_stack.pop_back();
+
+            if (!m_graph->hasVertex(current) || !m_workspace->reach(current)) continue;
+
+            emitVertex(sink, EventType::Visiting, current);
+            if (m_endId != -1 && current == m_endId) {
+                emitVertex(sink, EventType::Visited, current);
+                break;
+            }
+
+            // Push unvisited neighbours, then reverse them so the first neighbour ends on top.
+            std::size_t first = m_stack.size();
+            m_graph->forEachNeighbor(current, [&](int neighbor) {
+                if (!m_workspace->isReached(neighbor)) m_stack.push_back(neighbor);
+            });
+            std::reverse(m_stack.begin() + first, m_stack.end());
+            for (std::size_t i = first; i < m_stack.size(); ++i) {
+                emitEdge(sink, EventType::Tree, current, m_stack[i]);
+                emitVertex(sink, EventType::Frontier, m_stack[i]);
+            }
+            emitVertex(sink, EventType::Visited, current);
+            if (!m_stack.empty()) return true;
+        }
+
+        m_finished = true;
+        return false;
+    }
+
+    const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+    int m_endId = -1;                ///< Target vertex of the current run, -1 for a full traversal.
     bool m_finished = false;         ///< Flag indicating whether the algorithm has completed.
-    std::vector<bool> m_visited;     ///< Tracks which vertices have been visited to prevent processing duplicates.
-    std::stack<int> m_stack;         ///< Stack used to maintain the DFS frontier.
+    TraversalWorkspace<TWeight>* m_workspace = nullptr; ///< Reached flags of the current run, so vertices are expanded once.
+    std::vector<int> m_stack;        ///< Stack (top at the back) used to maintain the DFS frontier; reused between runs.
 };
 }
\ No newline at end of file
@@ -0,0 +1,428 @@
+/**
+ * @file DeltaStepping.h
+ * @brief Delta-stepping shortest paths: Dijkstra relaxed into buckets of width delta, processed one bucket per step.
+ */
+
+#pragma once
+#include "Algorithm.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Picks a bucket width for delta-stepping from the heaviest edge and the average degree.
+     * * A width of about the heaviest weight over the average degree keeps each bucket's light-edge rounds
+     * short while leaving enough vertices per bucket to share between threads (Meyer and Sanders).
+     * @tparam TWeight The arithmetic type of edge weights.
+     * @param maxWeight The heaviest edge weight.
+     * @param averageDegree The average number of out-edges per vertex.
+     * @return A positive width; at least 1 for integer weights.
+     */
+    template <typename TWeight>
+    typename Core::WeightTraits<TWeight>::Distance suggestDelta(TWeight maxWeight, double averageDegree) {
+        using Distance = typename Core::WeightTraits<TWeight>::Distance;
+        double width = static_cast<double>(maxWeight) / std::max(averageDegree, 1.0);
+        if constexpr (Core::WeightTraits<TWeight>::isIntegral) return std::max<Distance>(1, static_cast<Distance>(width));
+        else return width > 0 ? static_cast<Distance>(width) : Distance(1);
+    }
+
+    /**
+     * @brief Gets the bucket of a tentative distance.
+     * @tparam Distance The distance type.
+     * @param distance A finite, non-negative distance.
+     * @param delta The bucket width.
+     * @return floor(distance / delta).
+     */
+    template <typename Distance>
+    std::size_t deltaBucket(Distance distance, Distance delta) {
+        return static_cast<std::size_t>(distance / delta);
+    }
+
+    /**
+     * @brief The largest number of buckets kept in a delta-stepping ring.
+     */
+    inline constexpr std::size_t MAX_DELTA_RING = 4096;
+
+    /**
+     * @brief Gets the number of buckets to keep in a delta-stepping ring.
+     * * A relaxation reaches at most the heaviest edge beyond the current bucket, so that many buckets plus
+     * two always suffice. The count is capped at MAX_DELTA_RING, since a small delta over heavy weights
+     * would otherwise ask for millions of buckets; vertices queued beyond the ring wait in an overflow list.
+     * @tparam Distance The distance type.
+     * @param maxWeight The heaviest edge weight.
+     * @param delta The bucket width.
+     * @return The ring size, between 2 and MAX_DELTA_RING.
+     */
+    template <typename Distance>
+    std::size_t deltaRingSize(Distance maxWeight, Distance delta) {
+        if (maxWeight / delta >= static_cast<Distance>(MAX_DELTA_RING - 2)) return MAX_DELTA_RING;
+        return deltaBucket(maxWeight, delta) + 2;
+    }
+
+    /**
+     * @brief A vertex queued for a bucket beyond the end of the ring.
+     */
+    struct ParkedVertex {
+        std::size_t bucket;  ///< The bucket the vertex was queued for.
+        int vertex;          ///< The vertex ID.
+    };
+
+    /**
+     * @brief Implements delta-stepping single-source shortest paths, one bucket per step.
+     * * Vertices wait in buckets of tentative distance [i * delta, (i + 1) * delta). A step empties the lowest
+     * non-empty bucket: it relaxes the light edges (weight below delta) of its vertices in rounds until no
+     * vertex re-enters the bucket, then relaxes their heavy edges once, since those can only reach later buckets.
+     * With a delta below the lightest edge this is Dijkstra; with an infinite delta it is Bellman-Ford.
+     * Only the buckets between the current one and the heaviest edge beyond it can hold vertices, so they are
+     * kept in a ring of at most MAX_DELTA_RING buckets. Vertices queued further ahead wait in an overflow list
+     * and move into the ring once the current bucket reaches the lowest of them. Distances are exactly those
+     * of Dijkstra for non-negative weights.
+     * * This class reports events for the visualizer; ParallelDeltaStepping runs the same scheme on a thread pool.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class DeltaStepping : public Algorithm<TVertex, TWeight> {
+    private:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+        static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();  ///< Marks a vertex that is in no bucket.
+
+    public:
+        /**
+         * @brief Constructs the search.
+         * * @param delta The bucket width, or 0 to pick one with suggestDelta() at every begin().
+         */
+        explicit DeltaStepping(Distance delta = 0) : m_delta(delta) {}
+
+        /**
+         * @brief Runs delta-stepping on the given graph, reporting through a type-erased sink.
+         * * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. If specified, the algorithm stops once its bucket is settled.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         * @return false If the graph is null or startId does not exist.
+         */
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return search(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Runs delta-stepping on the given graph, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+         * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex. If specified, the algorithm stops once its bucket is settled.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return search(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable run, reporting through a type-erased sink.
+         * * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Prepares a resumable run, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex, or -1.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         * @return false If the graph is null or startId does not exist.
+         */
+        template <typename Sink = NullSink>
+        bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+            return initialize(graph, startId, endId, sink);
+        }
+
+        /**
+         * @brief Settles the next non-empty bucket, reporting through a type-erased sink.
+         * * The step that finishes the run also reports the shortest path to the target, if any.
+         * @param sink Receiver of the events of this step.
+         * @return true If buckets remain to be settled.
+         * @return false If the search has finished.
+         */
+        bool advance(EventSinkRef sink) override { return settleBucket(sink); }
+
+        /**
+         * @brief Settles the next non-empty bucket, reporting to a statically known sink.
+         * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+         * @param sink Receiver of the events of this step.
+         * @return true If buckets remain to be settled.
+         * @return false If the search has finished.
+         */
+        template <typename Sink = NullSink>
+        bool advance(Sink&& sink = {}) { return settleBucket(sink); }
+
+        /**
+         * @brief Checks if delta-stepping has completed execution.
+         * * @return true If the execution has finished.
+         * @return false Otherwise.
+         */
+        bool isFinished() const override { return m_finished; }
+
+        /**
+         * @brief Gets the bucket width of the current or last run.
+         * * @return The width passed to the constructor, or the one picked by begin() if that was 0.
+         */
+        Distance getDelta() const { return m_activeDelta; }
+
+        /**
+         * @brief Gets the number of non-empty buckets settled so far in the current or last run.
+         * * @return The bucket count.
+         */
+        std::size_t getBucketCount() const { return m_bucketCount; }
+
+    private:
+        /**
+         * @brief The search shared by both run() overloads: a begin() followed by advance() until done.
+         * * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the progress events.
+         * @return true If the algorithm completed without initialization errors.
+         */
+        template <typename Sink>
+        bool search(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+            if (!initialize(graph, startId, endId, sink)) return false;
+            while (settleBucket(sink));
+            return true;
+        }
+
+        /**
+         * @brief Resets the distances, sizes the bucket ring and queues the start vertex.
+         * * @param graph Pointer to the graph to run the algorithm on.
+         * @param startId The ID of the starting vertex.
+         * @param endId The ID of the target vertex.
+         * @param sink Receiver of the initial events.
+         * @return true If the run was set up.
+         */
+        template <typename Sink>
+        bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+            if (!graph || !graph->hasVertex(startId)) return false;
+
+            TWeight maxWeight = 0;
+            std::size_t edges = 0, vertices = 0;
+            graph->forEachEdge([&](const Core::BasicEdge<TWeight>& edge) {
+                maxWeight = std::max(maxWeight, edge.m_weight);
+                edges += graph->isDirected() ? 1 : 2;
+            });
+            graph->forEachVertex([&](const TVertex&) { ++vertices; });
+            m_activeDelta = m_delta > 0 ? m_delta : suggestDelta(maxWeight, static_cast<double>(edges) / std::max<std::size_t>(vertices, 1));
+
+            m_graph = graph;
+            m_startId = startId;
+            m_endId = endId;
+            m_finished = false;
+            m_workspace = &this->getWorkspace();
+            m_workspace->reset(graph->getVertexCount());
+
+            for (std::vector<int>& bucket : m_ring) bucket.clear();
+            m_ring.resize(deltaRingSize<Distance>(static_cast<Distance>(maxWeight), m_activeDelta));
+            m_overflow.clear();
+            m_overflowMin = NONE;
+            m_queuedIn.assign(graph->getVertexCount(), NONE);
+            m_expandedIn.assign(graph->getVertexCount(), NONE);
+            m_heavyPass.assign(graph->getVertexCount(), 0);
+            m_pass = 0;
+            m_current = 0;
+            m_pending = 0;
+            m_bucketCount = 0;
+
+            m_workspace->setDistance(startId, 0, -1);
+            enqueue(startId, 0);
+
+            emitVertex(sink, EventType::Distance, startId, 0.0);
+            emitVertex(sink, EventType::Frontier, startId);
+            return true;
+        }
+
+        /**
+         * @brief Empties the lowest non-empty bucket through light-edge rounds and a heavy-edge pass.
+         * * Heavy edges normally reach later buckets, but when rounding puts one back into the current
+         * bucket the light rounds simply resume, so the bucket is only left once it stays empty.
+         * @param sink Receiver of the events of this step.
+         * @return true If buckets remain to be settled.
+         */
+        template <typename Sink>
+        bool settleBucket(Sink& sink) {
+            if (m_finished || !m_graph) return false;
+            if (!findBucket()) return finish(sink);
+
+            std::vector<int>& bucket = m_ring[m_current % m_ring.size()];
+            m_members.clear();
+            ++m_bucketCount;
+
+            while (true) {
+                ++m_pass;
+                m_heavy.clear();
+                while (!bucket.empty()) {
+                    int u = bucket.back();
+                    bucket.pop_back();
+                    --m_pending;
+                    if (m_queuedIn[u] == m_current) m_queuedIn[u] = NONE;
+
+                    Distance du = m_workspace->getDistance(u);
+                    if (!m_graph->hasVertex(u) || deltaBucket(du, m_activeDelta) != m_current) continue;
+                    if (m_expandedIn[u] != m_current) {
+                        m_expandedIn[u] = m_current;
+                        m_members.push_back(u);
+                        emitVertex(sink, EventType::Visiting, u);
+                    }
+                    if (m_heavyPass[u] != m_pass) {
+                        m_heavyPass[u] = m_pass;
+                        m_heavy.push_back(u);
+                    }
+                    relaxFrom(sink, u, du, true);
+                }
+                if (m_heavy.empty()) break;
+                for (int u : m_heavy) relaxFrom(sink, u, m_workspace->getDistance(u), false);
+            }
+
+            for (int u : m_members) emitVertex(sink, EventType::Visited, u);
+            bool reachedEnd = m_endId >= 0 && m_endId < static_cast<int>(m_expandedIn.size())
+                           && m_expandedIn[m_endId] == m_current;
+            ++m_current;
+            if (reachedEnd || m_pending == 0) return finish(sink);
+            return true;
+        }
+
+        /**
+         * @brief Moves m_current to the lowest non-empty bucket, refilling the ring from the overflow list on the way.
+         * * @return false If no vertex waits in any bucket.
+         */
+        bool findBucket() {
+            while (m_pending > 0) {
+                std::size_t end = std::min(m_current + m_ring.size(), m_overflowMin);
+                for (; m_current < end; ++m_current) {
+                    if (!m_ring[m_current % m_ring.size()].empty()) return true;
+                }
+                if (m_overflowMin == NONE) return false;
+                m_current = m_overflowMin;
+                refill();
+            }
+            return false;
+        }
+
+        /**
+         * @brief Moves the overflow entries that now fall inside the ring into their buckets and drops stale ones.
+         */
+        void refill() {
+            m_overflowMin = NONE;
+            std::erase_if(m_overflow, [&](const ParkedVertex& parked) {
+                if (deltaBucket(m_workspace->getDistance(parked.vertex), m_activeDelta) != parked.bucket) {
+                    --m_pending;
+                    return true;
+                }
+                if (parked.bucket - m_current < m_ring.size()) {
+                    m_ring[parked.bucket % m_ring.size()].push_back(parked.vertex);
+                    return true;
+                }
+                m_overflowMin = std::min(m_overflowMin, parked.bucket);
+                return false;
+            });
+        }
+
+        /**
+         * @brief Relaxes either the light or the heavy out-edges of a vertex.
+         * * @param sink Receiver of the events.
+         * @param u The vertex whose edges are relaxed.
+         * @param du The distance of u.
+         * @param light true for edges lighter than delta, false for the others.
+         */
+        template <typename Sink>
+        void relaxFrom(Sink& sink, int u, Distance du, bool light) {
+            m_graph->forEachEdgeFrom(u, [&](int v, TWeight weight) {
+                if ((static_cast<Distance>(weight) < m_activeDelta) != light) return;
+                Distance newDist = du + static_cast<Distance>(weight);
+                if (newDist < m_workspace->getDistance(v)) {
+                    m_workspace->setDistance(v, newDist, u);
+                    enqueue(v, newDist);
+
+                    emitEdge(sink, EventType::Tree, u, v);
+                    emitVertex(sink, EventType::Distance, v, static_cast<double>(newDist));
+                    emitVertex(sink, EventType::Frontier, v);
+                }
+            });
+        }
+
+        /**
+         * @brief Puts a vertex into the bucket of its new distance unless it already waits there.
+         * * Buckets beyond the end of the ring are parked in the overflow list.
+         * @param v The vertex.
+         * @param distance Its new tentative distance.
+         */
+        void enqueue(int v, Distance distance) {
+            std::size_t index = deltaBucket(distance, m_activeDelta);
+            if (m_queuedIn[v] == index) return;
+            m_queuedIn[v] = index;
+            if (index - m_current < m_ring.size()) {
+                m_ring[index % m_ring.size()].push_back(v);
+            } else {
+                m_overflow.push_back({index, v});
+                m_overflowMin = std::min(m_overflowMin, index);
+            }
+            ++m_pending;
+        }
+
+        /**
+         * @brief Reports the shortest path to the target, if one was requested and found, and ends the run.
+         * * @param sink Receiver of the path events.
+         * @return false, so callers can return it directly.
+         */
+        template <typename Sink>
+        bool finish(Sink& sink) {
+            if (m_endId != -1 && m_workspace->getDistance(m_endId) != Traits::infinity()) {
+                int curr = m_endId;
+                while (curr != m_startId && curr != -1) {
+                    int prev = m_workspace->getPrevious(curr);
+                    if (prev != -1) emitEdge(sink, EventType::Path, prev, curr);
+                    curr = prev;
+                }
+            }
+            m_finished = true;
+            return false;
+        }
+
+        Distance m_delta;                  ///< Requested bucket width, 0 to pick one per run.
+        Distance m_activeDelta = 1;        ///< Bucket width of the current run.
+        const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+        int m_startId = -1;                ///< Start vertex of the current run.
+        int m_endId = -1;                  ///< Target vertex of the current run, -1 to settle every reachable vertex.
+        bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
+        TraversalWorkspace<TWeight>* m_workspace = nullptr; ///< Tentative distances and predecessors of the current run.
+        std::vector<std::vector<int>> m_ring; ///< Bucket i lives at m_ring[i % size]; stale entries are skipped when popped.
+        std::vector<ParkedVertex> m_overflow; ///< Vertices queued for buckets beyond the end of the ring.
+        std::size_t m_overflowMin = NONE;  ///< Lowest bucket in m_overflow, or NONE if it is empty.
+        std::vector<std::size_t> m_queuedIn;  ///< Bucket each vertex was last queued in while still waiting there, or NONE.
+        std::vector<std::size_t> m_expandedIn; ///< Last bucket in which each vertex was expanded, or NONE.
+        std::vector<std::uint32_t> m_heavyPass; ///< Last pass that listed each vertex for heavy relaxation.
+        std::vector<int> m_members;        ///< Vertices expanded in the current bucket, reported as Visited at its end.
+        std::vector<int> m_heavy;          ///< Vertices expanded in the current pass, whose heavy edges are relaxed next.
+        std::uint32_t m_pass = 0;          ///< Counter of light/heavy passes in the run.
+        std::size_t m_current = 0;         ///< Index of the bucket being settled.
+        std::size_t m_pending = 0;         ///< Entries in the ring and the overflow list, including stale ones.
+        std::size_t m_bucketCount = 0;     ///< Non-empty buckets settled so far.
+    };
+}
@@ -5,131 +5,223 @@
 
 #pragma once
 #include "Algorithm.h"
-#include <queue>
-#include <vector>
-#include <limits>
-#include <string>
+#include "PriorityQueues.h"
+#include <type_traits>
 
 namespace Algorithms {
 
 /**
  * @brief Implements Dijkstra's algorithm for finding the shortest path in a graph.
+ * * Distances accumulate in Core::WeightTraits<TWeight>::Distance, so integer-weighted graphs
+ * run on 64-bit integer keys and never compare floating-point values.
+ * * The priority queue is a template parameter. For floating-point weights the default indexed 4-ary heap
+ * lowers keys in place and holds at most V entries; LazyBinaryHeap pushes a new entry per improvement
+ * instead. For integer weights the default MonotoneIntegerQueue uses Dial's buckets while the weights are
+ * small and a radix heap otherwise, both relying on the keys being popped in non-decreasing order.
  * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+ * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+ * @tparam TQueue The vertex priority queue (see PriorityQueues.h), keyed on the distance type.
  */
-template<typename TVertex = Core::Vertex>
-class Dijkstra : public Algorithm<TVertex> {
+template<typename TVertex = Core::Vertex, typename TWeight = double,
+         typename TQueue = DefaultDistanceQueue<typename Core::WeightTraits<TWeight>::Distance>>
+class Dijkstra : public Algorithm<TVertex, TWeight> {
 private:
-    /**
-     * @brief Internal helper structure to store a node and its computed distance.
-     */
-    struct NodeDist {
-        int id;        ///< The ID of the vertex.
-        double dist;   ///< The accumulated distance from the start vertex.
-
-        /**
-         * @brief Greater-than comparison operator, required for the min-priority queue.
-         * * @param other The other NodeDist to compare with.
-         * @return true If this distance is greater than the other distance.
-         * @return false Otherwise.
-         */
-        bool operator>(const NodeDist& other) const {
-            return dist > other.dist;
-        }
-    };
+    using Traits = Core::WeightTraits<TWeight>;
+    using Distance = typename Traits::Distance;
+
+    static_assert(std::is_same_v<typename TQueue::Key, Distance>, "The queue must be keyed on the distance type");
 
 public:
     /**
-     * @brief Runs Dijkstra's algorithm on the given graph.
+     * @brief Runs Dijkstra's algorithm on the given graph, reporting through a type-erased sink.
      * * @param graph Pointer to the graph to run the algorithm on.
      * @param startId The ID of the starting vertex.
      * @param endId The ID of the target vertex. If specified, the algorithm stops upon finding its shortest path.
-     * @param vertexCb Callback invoked during vertex state changes.
-     * @param edgeCb Callback invoked during edge state changes.
+     * @param sink Receiver of the progress events.
      * @return true If the algorithm completed without initialization errors.
      * @return false If the graph is null or startId does not exist.
      */
-    bool run(const Core::Graph<TVertex>* graph, int startId, int endId,
-             typename Algorithm<TVertex>::VertexCallback vertexCb,
-             typename Algorithm<TVertex>::EdgeCallback edgeCb) override
-    {
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Runs Dijkstra's algorithm on the given graph, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&. With the default NullSink no events are built.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. If specified, the algorithm stops upon finding its shortest path.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool run(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return search(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable run of Dijkstra's algorithm, reporting through a type-erased sink.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. If specified, the algorithm stops upon finding its shortest path.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, EventSinkRef sink) override {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Prepares a resumable run of Dijkstra's algorithm, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex. If specified, the algorithm stops upon finding its shortest path.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     * @return false If the graph is null or startId does not exist.
+     */
+    template <typename Sink = NullSink>
+    bool begin(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId = -1, Sink&& sink = {}) {
+        return initialize(graph, startId, endId, sink);
+    }
+
+    /**
+     * @brief Settles the next closest vertex, reporting through a type-erased sink.
+     * * The step that finishes the run also reports the shortest path to the target, if any.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    bool advance(EventSinkRef sink) override { return settle(sink); }
+
+    /**
+     * @brief Settles the next closest vertex, reporting to a statically known sink.
+     * * @tparam Sink Type of the sink, callable with a const AlgorithmEvent&.
+     * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     * @return false If the search has finished.
+     */
+    template <typename Sink = NullSink>
+    bool advance(Sink&& sink = {}) { return settle(sink); }
+
+    /**
+     * @brief Checks if Dijkstra's algorithm has completed execution.
+     * * @return true If the execution has finished.
+     * @return false Otherwise.
+     */
+    bool isFinished() const override { return m_finished; }
+
+    /**
+     * @brief Estimates the heap memory held by the priority queue, which keeps its capacity between runs.
+     * * @return The bytes reported by the queue.
+     */
+    std::size_t getQueueMemoryFootprint() const { return m_queue.getMemoryFootprint(); }
+
+private:
+    /**
+     * @brief The search shared by both run() overloads: a begin() followed by advance() until done.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the progress events.
+     * @return true If the algorithm completed without initialization errors.
+     */
+    template <typename Sink>
+    bool search(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
+        if (!initialize(graph, startId, endId, sink)) return false;
+        while (settle(sink));
+        return true;
+    }
+
+    /**
+     * @brief Resets the distances and queues the start vertex.
+     * * @param graph Pointer to the graph to run the algorithm on.
+     * @param startId The ID of the starting vertex.
+     * @param endId The ID of the target vertex.
+     * @param sink Receiver of the initial events.
+     * @return true If the run was set up.
+     */
+    template <typename Sink>
+    bool initialize(const Core::Graph<TVertex, TWeight>* graph, int startId, int endId, Sink& sink) {
         if (!graph || !graph->hasVertex(startId)) return false;
 
+        m_graph = graph;
+        m_startId = startId;
+        m_endId = endId;
         m_finished = false;
-        size_t maxId = graph->getVertexCount();
-        std::vector<double> distances(maxId, std::numeric_limits<double>::infinity());
-        std::vector<int> previous(maxId, -1);
+        m_workspace = &this->getWorkspace();
+        m_workspace->reset(graph->getVertexCount());
+        m_queue.reset(graph->getVertexCount());
 
-        std::priority_queue<NodeDist, std::vector<NodeDist>, std::greater<NodeDist>> pq;
+        m_workspace->setDistance(startId, 0, -1);
+        m_queue.push(startId, 0);
 
-        distances[startId] = 0.0;
-        pq.push({startId, 0.0});
+        emitVertex(sink, EventType::Distance, startId, 0.0);
+        emitVertex(sink, EventType::Frontier, startId);
+        return true;
+    }
 
-        if (vertexCb) {
-            vertexCb(startId, "dist=0");
-            vertexCb(startId, "frontier");
-        }
+    /**
+     * @brief Pops the closest queued vertex and relaxes its outgoing edges.
+     * * @param sink Receiver of the events of this step.
+     * @return true If vertices remain to be settled.
+     */
+    template <typename Sink>
+    bool settle(Sink& sink) {
+        if (m_finished || !m_graph) return false;
+        TraversalWorkspace<TWeight>& workspace = *m_workspace;
 
-        while (!pq.empty()) {
-            NodeDist current = pq.top();
-            pq.pop();
+        while (!m_queue.empty()) {
+            auto current = m_queue.pop();
 
             int u = current.id;
-            if (!graph->hasVertex(u)) continue;
-            if (current.dist > distances[u]) continue;
+            if (!m_graph->hasVertex(u)) continue;
+            if (current.key > workspace.getDistance(u)) continue;
 
-            if (vertexCb) vertexCb(u, "visiting");
+            emitVertex(sink, EventType::Visiting, u);
 
-            if (u == endId) {
-                if (vertexCb) vertexCb(u, "visited");
+            if (u == m_endId) {
+                emitVertex(sink, EventType::Visited, u);
                 break;
             }
 
-            std::vector<Core::Edge> edges = graph->getEdgesFrom(u);
-            for (const auto& edge : edges) {
-                int v = edge.getDestination();
-                if (!graph->hasVertex(v)) continue;
-
-                double weight = edge.getWeight();
-                double newDist = distances[u] + weight;
+            m_graph->forEachEdgeFrom(u, [&](int v, TWeight weight) {
+                Distance newDist = current.key + static_cast<Distance>(weight);
 
-                if (newDist < distances[v]) {
-                    distances[v] = newDist;
-                    previous[v] = u;
-                    pq.push({v, newDist});
+                if (newDist < workspace.getDistance(v)) {
+                    workspace.setDistance(v, newDist, u);
+                    m_queue.push(v, newDist);
 
-                    if (edgeCb) edgeCb(u, v, "tree");
-                    if (vertexCb) {
-                        vertexCb(v, "dist=" + std::to_string(newDist));
-                        vertexCb(v, "frontier");
-                    }
+                    emitEdge(sink, EventType::Tree, u, v);
+                    emitVertex(sink, EventType::Distance, v, static_cast<double>(newDist));
+                    emitVertex(sink, EventType::Frontier, v);
                 }
-            }
-            if (vertexCb) vertexCb(u, "visited");
+            });
+            emitVertex(sink, EventType::Visited, u);
+            if (!m_queue.empty()) return true;
         }
 
-        if (endId != -1 && distances[endId] != std::numeric_limits<double>::infinity()) {
-            int curr = endId;
-            while (curr != startId && curr != -1) {
-                int prev = previous[curr];
-                if (prev != -1) {
-                    if (edgeCb) edgeCb(prev, curr, "path");
-                }
+        if (m_endId != -1 && workspace.getDistance(m_endId) != Traits::infinity()) {
+            int curr = m_endId;
+            while (curr != m_startId && curr != -1) {
+                int prev = workspace.getPrevious(curr);
+                if (prev != -1) emitEdge(sink, EventType::Path, prev, curr);
                 curr = prev;
             }
         }
 
         m_finished = true;
-        return true;
+        return false;
     }
 
-    /**
-     * @brief Checks if Dijkstra's algorithm has completed execution.
-     * * @return true If the execution has finished.
-     * @return false Otherwise.
-     */
-    bool isFinished() const override { return m_finished; }
-
-private:
-    bool m_finished = false; ///< Flag indicating whether the algorithm has completed.
+    const Core::Graph<TVertex, TWeight>* m_graph = nullptr; ///< The graph of the current run.
+    int m_startId = -1;                ///< Start vertex of the current run.
+    int m_endId = -1;                  ///< Target vertex of the current run, -1 to settle every reachable vertex.
+    bool m_finished = false;           ///< Flag indicating whether the algorithm has completed.
+    TraversalWorkspace<TWeight>* m_workspace = nullptr; ///< Tentative distances and predecessors of the current run.
+    TQueue m_queue;                    ///< Vertices waiting to be settled, reused between runs.
 };
 }
\ No newline at end of file
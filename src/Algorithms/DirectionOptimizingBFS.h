@@ -0,0 +1,282 @@
+/**
+ * @file DirectionOptimizingBFS.h
+ * @brief Breadth-first search switching between top-down and bottom-up level expansion.
+ */
+
+#pragma once
+#include "CsrGraph.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Expansion strategies of DirectionOptimizingBFS.
+     */
+    enum class BfsDirection {
+        Adaptive,   ///< Choose per level from the frontier size (the default).
+        TopDown,    ///< Always scan the out-edges of the frontier, like a plain BFS.
+        BottomUp    ///< Always let unvisited vertices look for a parent in the frontier.
+    };
+
+    /**
+     * @brief Headless breadth-first search over a CSR snapshot that skips most edge inspections on low-diameter graphs.
+     * * A top-down level scans every out-edge of the frontier. Once the frontier is large, most of those edges
+     * lead to vertices that are already visited, so a bottom-up level instead lets each unvisited vertex scan
+     * its in-edges and stop at the first one coming from the frontier (Beamer, Asanović and Patterson).
+     * The search goes bottom-up when the out-edges of the frontier exceed the edges of unvisited vertices
+     * divided by alpha, and back to top-down once the frontier shrinks below V / beta.
+     * Bottom-up levels keep the frontier as a bitmap; top-down levels keep it as a queue.
+     * * Levels are those of Algorithms::BFS from the same start. Parents are always a frontier vertex of the
+     * previous level with an edge to the child; they equal the BFS parents when every level runs top-down,
+     * but a bottom-up level picks the first in-neighbour in the snapshot's edge order rather than the first one dequeued.
+     * No events are reported, which makes the engine suited to batch runs without visualization.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class DirectionOptimizingBFS {
+    public:
+        /**
+         * @brief Constructs the search.
+         * * @param direction The expansion strategy.
+         * @param alpha Go bottom-up once the frontier's out-edges exceed the unexplored edges divided by alpha.
+         * @param beta Go back top-down once the frontier holds fewer than V / beta vertices and is shrinking.
+         */
+        explicit DirectionOptimizingBFS(BfsDirection direction = BfsDirection::Adaptive, double alpha = 15.0, double beta = 18.0)
+            : m_direction(direction), m_alpha(alpha), m_beta(beta) {}
+
+        /**
+         * @brief Runs a full breadth-first search from a start vertex.
+         * * Runs in O(V + E) for top-down levels plus O(V / 64 + inspected in-edges) per bottom-up level.
+         * @param graph The snapshot to search. Directed snapshots provide their own in-edge arrays.
+         * @param startId The ID of the starting vertex.
+         * @return true If the search ran.
+         * @return false If startId does not exist.
+         */
+        bool run(const Core::CsrGraph<TVertex, TWeight>& graph, int startId) {
+            if (!graph.hasVertex(startId)) return false;
+
+            int count = graph.getVertexCount();
+            std::size_t words = (static_cast<std::size_t>(count) + 63) / 64;
+            m_levels.assign(count, -1);
+            m_parents.assign(count, -1);
+            m_frontierBits.assign(words, 0);
+            m_nextBits.assign(words, 0);
+            m_visitedBits.assign(words, 0);
+            if (count % 64 != 0) m_visitedBits.back() = ~std::uint64_t{0} << (count % 64);
+            m_queue.clear();
+            m_edgesInspected = 0;
+            m_bottomUpLevels = 0;
+            m_levelCount = 1;
+            m_reached = 1;
+
+            m_levels[startId] = 0;
+            m_visitedBits[startId >> 6] |= std::uint64_t{1} << (startId & 63);
+            m_queue.push_back(startId);
+
+            std::size_t scout = graph.getNeighborSpan(startId).size();
+            std::size_t unexplored = graph.getEdgeCount() - scout;
+            int level = 0;
+
+            while (!m_queue.empty()) {
+                if (goesBottomUp(scout, unexplored)) {
+                    queueToBitmap();
+                    std::size_t awake = m_queue.size();
+                    std::size_t previous;
+                    do {
+                        previous = awake;
+                        awake = bottomUpStep(graph, ++level, unexplored);
+                        std::swap(m_frontierBits, m_nextBits);
+                        ++m_bottomUpLevels;
+                    } while (awake > 0 && staysBottomUp(awake, previous, count));
+                    scout = bitmapToQueue(graph);
+                } else {
+                    scout = topDownStep(graph, ++level);
+                    unexplored -= scout < unexplored ? scout : unexplored;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Gets the BFS level of a vertex in the last run.
+         * * @param id The vertex ID.
+         * @return The number of edges on a shortest path from the start, or -1 if unreached.
+         */
+        int getLevel(int id) const { return id >= 0 && id < static_cast<int>(m_levels.size()) ? m_levels[id] : -1; }
+
+        /**
+         * @brief Gets the parent of a vertex in the BFS tree of the last run.
+         * * @param id The vertex ID.
+         * @return The parent ID, or -1 for the start and unreached vertices.
+         */
+        int getParent(int id) const { return id >= 0 && id < static_cast<int>(m_parents.size()) ? m_parents[id] : -1; }
+
+        /**
+         * @brief Gets the levels of all vertices, -1 for unreached ones.
+         * * @return A constant reference to the level array.
+         */
+        const std::vector<int>& getLevels() const { return m_levels; }
+
+        /**
+         * @brief Gets the parents of all vertices, -1 for the start and unreached ones.
+         * * @return A constant reference to the parent array.
+         */
+        const std::vector<int>& getParents() const { return m_parents; }
+
+        /**
+         * @brief Gets the number of vertices reached by the last run, including the start.
+         * * @return The reached count.
+         */
+        int getReachedCount() const { return m_reached; }
+
+        /**
+         * @brief Gets the number of non-empty levels of the last run.
+         * * @return The deepest level plus one.
+         */
+        int getLevelCount() const { return m_levelCount; }
+
+        /**
+         * @brief Gets the number of edges looked at by the last run, over both directions.
+         * * @return The count of inspected edges.
+         */
+        std::size_t getEdgesInspected() const { return m_edgesInspected; }
+
+        /**
+         * @brief Gets the number of levels the last run expanded bottom-up.
+         * * @return The bottom-up level count.
+         */
+        int getBottomUpLevels() const { return m_bottomUpLevels; }
+
+    private:
+        /**
+         * @brief Decides whether the next level is expanded bottom-up.
+         * * @param scout The out-edges of the current frontier.
+         * @param unexplored The out-edges of vertices not reached yet.
+         * @return true To switch to bottom-up.
+         */
+        bool goesBottomUp(std::size_t scout, std::size_t unexplored) const {
+            if (m_direction != BfsDirection::Adaptive) return m_direction == BfsDirection::BottomUp;
+            return static_cast<double>(scout) > static_cast<double>(unexplored) / m_alpha;
+        }
+
+        /**
+         * @brief Decides whether bottom-up expansion continues with the next level.
+         * * @param awake The size of the new frontier.
+         * @param previous The size of the previous frontier.
+         * @param count The vertex count of the graph.
+         * @return true To stay bottom-up.
+         */
+        bool staysBottomUp(std::size_t awake, std::size_t previous, int count) const {
+            if (m_direction != BfsDirection::Adaptive) return m_direction == BfsDirection::BottomUp;
+            return awake >= previous || static_cast<double>(awake) > count / m_beta;
+        }
+
+        /**
+         * @brief Expands the queued frontier through its out-edges into the next queue.
+         * * @param graph The snapshot being searched.
+         * @param level The level of the vertices discovered.
+         * @return The out-edges of the new frontier.
+         */
+        std::size_t topDownStep(const Core::CsrGraph<TVertex, TWeight>& graph, int level) {
+            std::size_t scout = 0;
+            m_next.clear();
+            for (int u : m_queue) {
+                std::span<const int> neighbors = graph.getNeighborSpan(u);
+                m_edgesInspected += neighbors.size();
+                for (int v : neighbors) {
+                    if (m_levels[v] >= 0) continue;
+                    m_levels[v] = level;
+                    m_parents[v] = u;
+                    m_visitedBits[v >> 6] |= std::uint64_t{1} << (v & 63);
+                    m_next.push_back(v);
+                    scout += graph.getNeighborSpan(v).size();
+                }
+            }
+            m_reached += static_cast<int>(m_next.size());
+            if (!m_next.empty()) m_levelCount = level + 1;
+            std::swap(m_queue, m_next);
+            return scout;
+        }
+
+        /**
+         * @brief Lets every unvisited vertex take its first in-neighbour in the frontier bitmap as parent.
+         * * @param graph The snapshot being searched.
+         * @param level The level of the vertices discovered.
+         * @param unexplored The out-edges of vertices not reached yet, reduced by those of every vertex claimed.
+         * @return The size of the new frontier, stored in m_nextBits.
+         */
+        std::size_t bottomUpStep(const Core::CsrGraph<TVertex, TWeight>& graph, int level, std::size_t& unexplored) {
+            std::size_t awake = 0;
+            std::fill(m_nextBits.begin(), m_nextBits.end(), 0);
+            for (std::size_t w = 0; w < m_visitedBits.size(); ++w) {
+                for (std::uint64_t bits = ~m_visitedBits[w]; bits; bits &= bits - 1) {
+                    int v = static_cast<int>(w * 64 + std::countr_zero(bits));
+                    for (int u : graph.getInNeighborSpan(v)) {
+                        ++m_edgesInspected;
+                        if (m_frontierBits[u >> 6] >> (u & 63) & 1) {
+                            m_levels[v] = level;
+                            m_parents[v] = u;
+                            m_nextBits[v >> 6] |= std::uint64_t{1} << (v & 63);
+                            std::size_t degree = graph.getNeighborSpan(v).size();
+                            unexplored -= degree < unexplored ? degree : unexplored;
+                            ++awake;
+                            break;
+                        }
+                    }
+                }
+                m_visitedBits[w] |= m_nextBits[w];
+            }
+            m_reached += static_cast<int>(awake);
+            if (awake > 0) m_levelCount = level + 1;
+            return awake;
+        }
+
+        /**
+         * @brief Moves the queued frontier into the frontier bitmap.
+         */
+        void queueToBitmap() {
+            std::fill(m_frontierBits.begin(), m_frontierBits.end(), 0);
+            for (int u : m_queue) m_frontierBits[u >> 6] |= std::uint64_t{1} << (u & 63);
+        }
+
+        /**
+         * @brief Lists the frontier bitmap in the queue, in ascending ID order.
+         * * @param graph The snapshot being searched.
+         * @return The out-edges of the frontier.
+         */
+        std::size_t bitmapToQueue(const Core::CsrGraph<TVertex, TWeight>& graph) {
+            std::size_t scout = 0;
+            m_queue.clear();
+            for (std::size_t w = 0; w < m_frontierBits.size(); ++w) {
+                for (std::uint64_t bits = m_frontierBits[w]; bits; bits &= bits - 1) {
+                    int u = static_cast<int>(w * 64 + std::countr_zero(bits));
+                    m_queue.push_back(u);
+                    scout += graph.getNeighborSpan(u).size();
+                }
+            }
+            return scout;
+        }
+
+        BfsDirection m_direction;            ///< The expansion strategy.
+        double m_alpha;                      ///< Top-down to bottom-up switching factor.
+        double m_beta;                       ///< Bottom-up to top-down switching factor.
+        std::vector<int> m_levels;           ///< Level of each vertex, -1 until reached.
+        std::vector<int> m_parents;          ///< BFS tree parent of each vertex, -1 for the start and unreached vertices.
+        std::vector<int> m_queue;            ///< The frontier during top-down levels.
+        std::vector<int> m_next;             ///< The next frontier being built by a top-down level.
+        std::vector<std::uint64_t> m_frontierBits; ///< The frontier during bottom-up levels, one bit per vertex.
+        std::vector<std::uint64_t> m_nextBits;     ///< The next frontier being built by a bottom-up level.
+        std::vector<std::uint64_t> m_visitedBits;  ///< Reached vertices, one bit per vertex, so bottom-up levels skip them by the word.
+        std::size_t m_edgesInspected = 0;    ///< Edges looked at in the last run.
+        int m_bottomUpLevels = 0;            ///< Levels expanded bottom-up in the last run.
+        int m_levelCount = 0;                ///< Non-empty levels in the last run.
+        int m_reached = 0;                   ///< Vertices reached in the last run.
+    };
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+/**
+ * @file FloydWarshall.h
+ * @brief All-pairs shortest paths on the dense weight matrix of an AdjacencyMatrix, by blocked Floyd-Warshall.
+ */
+
+#pragma once
+#include "AdjacencyMatrix.h"
+#include "AlgorithmStep.h"
+#include "ThreadPool.h"
+#include "CpuFeatures.h"
+#include "WeightTraits.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Headless all-pairs shortest paths that keeps a distance matrix and a next-hop matrix.
+     * * The matrices are filled from the presence bitmap and dense weights of a Core::AdjacencyMatrix and
+     * padded to a multiple of TILE rows and columns. Each round k of Floyd-Warshall is run for TILE values
+     * of k at a time, as three phases over TILE x TILE tiles (Venkataraman et al., "A Blocked All-Pairs
+     * Shortest-Paths Algorithm"): the diagonal tile of the block, then the other tiles of its row and column,
+     * then every remaining tile. Tiles of the second and third phase only read tiles finished earlier in
+     * the round, so they are spread over a Core::ThreadPool. The three tiles a tile reads stay in cache
+     * while it is relaxed.
+     * * The inner step is d(i, j) = min(d(i, j), d(i, k) + d(k, j)) over a row of the tile, with next(i, j)
+     * taken from next(i, k) where the distance drops. For double distances on CPUs with AVX2 it handles four
+     * columns per instruction and skips the stores when no lane improves; elsewhere it is a scalar loop. Rows with an
+     * infinite d(i, k) are skipped. If some edge weighs 0 or less, an edge-count matrix is kept as well and
+     * equal distances are broken by fewer edges, so that following the next hops always ends.
+     * * Negative weights are allowed. A negative cycle makes some diagonal entry negative, which
+     * hasNegativeCycle() reports; distances and paths through the cycle are meaningless then.
+     * After run(), getDistance() and getNextHop() are O(1) and getPath() is O(path length), so a viewer
+     * can highlight the path between any pair without searching.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class FloydWarshall {
+    private:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+        /**
+         * @brief The distance of an unreached cell during the run.
+         * * Half the largest integer for integer distances, so adding an edge to it cannot overflow;
+         * it becomes Traits::infinity() when the run ends.
+         */
+        static constexpr Distance UNREACHED = Traits::isIntegral ? std::numeric_limits<Distance>::max() / 2 : Traits::infinity();
+
+    public:
+        static constexpr int TILE = 64;  ///< Side of the square tiles, in cells.
+
+        /**
+         * @brief Constructs the solver.
+         * * @param pool The pool that relaxes the tiles; it must outlive the solver.
+         */
+        explicit FloydWarshall(Core::ThreadPool& pool = Core::ThreadPool::shared()) : m_pool(&pool) {}
+
+        /**
+         * @brief Computes the shortest distances and next hops between every pair of vertices.
+         * * Costs O(V^3 / P) for P threads and O(V^2) memory, whatever the number of edges.
+         * Unweighted graphs use weight 1 per edge; removed vertices reach nothing and are reached by nothing.
+         * @param graph The matrix to read. It is not kept, so later changes need another run.
+         */
+        template <typename DirectionPolicy, typename WeightPolicy>
+        void run(const Core::AdjacencyMatrix<TVertex, DirectionPolicy, WeightPolicy, TWeight>& graph) {
+            m_count = graph.getVertexCount();
+            m_stride = (static_cast<std::size_t>(m_count) + TILE - 1) / TILE * TILE;
+            m_distances.assign(m_stride * m_stride, UNREACHED);
+            m_next.assign(m_stride * m_stride, -1);
+            m_hops.clear();
+            if (load(graph)) {
+                m_hops.assign(m_stride * m_stride, 1);
+                for (std::size_t v = 0; v < m_stride; ++v) m_hops[v * m_stride + v] = 0;
+                solve<true>();
+            } else {
+                solve<false>();
+            }
+
+            if constexpr (Traits::isIntegral) {
+                for (Distance& distance : m_distances) {
+                    if (distance >= UNREACHED) distance = Traits::infinity();
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the number of vertex IDs covered by the last run.
+         * * @return The vertex count of the matrix at the time of run().
+         */
+        int getVertexCount() const { return m_count; }
+
+        /**
+         * @brief Gets the shortest distance between two vertices.
+         * * @param from The source vertex ID.
+         * @param to The destination vertex ID.
+         * @return The shortest path length, 0 from a vertex to itself, or Core::WeightTraits<TWeight>::infinity()
+         * if there is no path or either ID is out of range or removed.
+         */
+        Distance getDistance(int from, int to) const {
+            if (!inRange(from) || !inRange(to)) return Traits::infinity();
+            return m_distances[from * m_stride + to];
+        }
+
+        /**
+         * @brief Gets the distances from one vertex to every vertex.
+         * * @param from The source vertex ID.
+         * @return A view of getVertexCount() distances, infinity for unreached vertices; empty if out of range.
+         */
+        std::span<const Distance> getRow(int from) const {
+            if (!inRange(from)) return {};
+            return std::span<const Distance>(m_distances.data() + from * m_stride, m_count);
+        }
+
+        /**
+         * @brief Gets the vertex that follows the source on a shortest path.
+         * * @param from The source vertex ID.
+         * @param to The destination vertex ID.
+         * @return The next vertex, `to` itself for a direct edge and `from` when both are the same vertex,
+         * or -1 if there is no path.
+         */
+        int getNextHop(int from, int to) const {
+            if (!inRange(from) || !inRange(to)) return -1;
+            return m_next[from * m_stride + to];
+        }
+
+        /**
+         * @brief Gets the vertices of a shortest path by following the next hops.
+         * * @param from The source vertex ID.
+         * @param to The destination vertex ID.
+         * @return The path from `from` to `to`, both included, or an empty vector if there is no path.
+         */
+        std::vector<int> getPath(int from, int to) const {
+            std::vector<int> path;
+            if (getNextHop(from, to) < 0) return path;
+            path.push_back(from);
+            for (int current = from; current != to && static_cast<int>(path.size()) <= m_count; ) {
+                current = m_next[current * m_stride + to];
+                path.push_back(current);
+            }
+            return path;
+        }
+
+        /**
+         * @brief Describes one pair's shortest path as a state that a viewer can display.
+         * * @param from The source vertex ID.
+         * @param to The destination vertex ID.
+         * @return A state with the distances from `from`, the path's edges in shortestPathEdges
+         * and `to` as the current vertex; only the distances are set if there is no path.
+         */
+        AlgoState getPathState(int from, int to) const {
+            AlgoState state;
+            std::span<const Distance> row = getRow(from);
+            state.distances.reserve(row.size());
+            for (Distance distance : row) {
+                state.distances.push_back(distance == Traits::infinity() ? std::numeric_limits<double>::infinity()
+                                                                          : static_cast<double>(distance));
+            }
+            std::vector<int> path = getPath(from, to);
+            if (path.empty()) return state;
+            state.currentVertex = to;
+            state.visitedVertices = path;
+            for (std::size_t i = 1; i < path.size(); ++i) state.shortestPathEdges.push_back({path[i - 1], path[i]});
+            return state;
+        }
+
+        /**
+         * @brief Checks if the last run met a cycle of negative length.
+         * * @return true If some vertex has a negative distance to itself.
+         */
+        bool hasNegativeCycle() const {
+            for (int v = 0; v < m_count; ++v) {
+                if (m_distances[v * m_stride + v] < 0) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Estimates the heap memory held by the distance and next-hop matrices.
+         * * @return The number of bytes.
+         */
+        std::size_t getMemoryFootprint() const {
+            return m_distances.capacity() * sizeof(Distance) + (m_next.capacity() + m_hops.capacity()) * sizeof(std::int32_t);
+        }
+
+    private:
+        /**
+         * @brief Checks if a vertex ID lies within the matrices of the last run.
+         * * @param id The vertex ID.
+         * @return true If 0 <= id < getVertexCount().
+         */
+        bool inRange(int id) const { return id >= 0 && id < m_count; }
+
+        /**
+         * @brief Fills the matrices with the edges of the graph, one row per parallel iteration.
+         * * @param graph The matrix to read.
+         * @return true If some edge between distinct vertices weighs 0 or less, or some self-loop less than 0.
+         */
+        template <typename DirectionPolicy, typename WeightPolicy>
+        bool load(const Core::AdjacencyMatrix<TVertex, DirectionPolicy, WeightPolicy, TWeight>& graph) {
+            std::span<const std::uint64_t> active = graph.getActiveMask();
+            std::atomic<bool> nonPositive = false;
+            m_pool->parallelFor(static_cast<std::size_t>(m_count), 64, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    if (!((active[i >> 6] >> (i & 63)) & 1u)) continue;
+                    Distance* distances = m_distances.data() + i * m_stride;
+                    std::int32_t* next = m_next.data() + i * m_stride;
+                    distances[i] = 0;
+                    next[i] = static_cast<std::int32_t>(i);
+
+                    std::span<const std::uint64_t> present = graph.getPresenceRow(static_cast<int>(i));
+                    std::span<const TWeight> weights = graph.getWeightRow(static_cast<int>(i));
+                    for (std::size_t w = 0; w < present.size(); ++w) {
+                        for (std::uint64_t bits = present[w] & active[w]; bits; bits &= bits - 1) {
+                            std::size_t j = w * 64 + std::countr_zero(bits);
+                            Distance weight = weights.empty() ? Distance{1} : static_cast<Distance>(weights[j]);
+                            if (j == i && weight >= 0) continue;
+                            if (weight <= 0) nonPositive.store(true, std::memory_order_relaxed);
+                            distances[j] = weight;
+                            next[j] = static_cast<std::int32_t>(j);
+                        }
+                    }
+                }
+            });
+            return nonPositive.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Runs the blocked rounds over the loaded matrices.
+         * @tparam Ties true to break distance ties by hop count, which m_hops must be sized for.
+         */
+        template <bool Ties>
+        void solve() {
+            std::size_t tiles = m_stride / TILE;
+            for (std::size_t block = 0; block < tiles; ++block) {
+                relaxTile<Ties>(block, block, block);
+                m_pool->parallelFor(2 * (tiles - 1), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                    for (std::size_t t = begin; t < end; ++t) {
+                        std::size_t other = t % (tiles - 1);
+                        other += other >= block;
+                        if (t < tiles - 1) relaxTile<Ties>(block, other, block);
+                        else relaxTile<Ties>(other, block, block);
+                    }
+                });
+                std::size_t rest = (tiles - 1) * (tiles - 1);
+                m_pool->parallelFor(rest, 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                    for (std::size_t t = begin; t < end; ++t) {
+                        std::size_t row = t / (tiles - 1);
+                        std::size_t column = t % (tiles - 1);
+                        relaxTile<Ties>(row + (row >= block), column + (column >= block), block);
+                    }
+                });
+            }
+        }
+
+        /**
+         * @brief Relaxes one tile through the TILE values of k of a block.
+         * @tparam Ties true to break distance ties by hop count.
+         * @param row The tile row, whose cells have i in [row * TILE, row * TILE + TILE).
+         * @param column The tile column, whose cells have j in [column * TILE, column * TILE + TILE).
+         * @param block The block of k, finished already in every tile this one reads unless they coincide.
+         */
+        template <bool Ties>
+        void relaxTile(std::size_t row, std::size_t column, std::size_t block) {
+            for (std::size_t k = block * TILE; k < block * TILE + TILE; ++k) {
+                std::size_t through = k * m_stride + column * TILE;
+                for (std::size_t i = row * TILE; i < row * TILE + TILE; ++i) {
+                    std::size_t toK = i * m_stride + k;
+                    if (m_distances[toK] >= UNREACHED) continue;
+                    std::size_t cell = i * m_stride + column * TILE;
+                    if constexpr (Ties) {
+                        relaxRow<true>(m_distances.data() + cell, m_next.data() + cell, m_hops.data() + cell,
+                                       m_distances.data() + through, m_hops.data() + through,
+                                       m_distances[toK], m_hops[toK], m_next[toK]);
+                    } else {
+                        relaxRow<false>(m_distances.data() + cell, m_next.data() + cell, nullptr,
+                                        m_distances.data() + through, nullptr, m_distances[toK], 0, m_next[toK]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Lowers TILE cells of a row through vertex k.
+         * * With ties broken, a path as long as the current one replaces it if it has fewer edges. Without that,
+         * zero-weight cycles can leave two vertices naming each other as next hop towards the same target,
+         * since the blocked order relaxes d(i, k) through k values beyond k.
+         * @tparam Ties true to break distance ties by hop count.
+         * @param distances The cells d(i, j), updated in place.
+         * @param next The next hops next(i, j), updated where the path changes.
+         * @param hops The edge counts h(i, j), updated where the path changes; unused without ties.
+         * @param through The distances d(k, j) of the same columns.
+         * @param throughHops The edge counts h(k, j); unused without ties.
+         * @param toK The distance d(i, k), finite.
+         * @param hopsToK The edge count h(i, k).
+         * @param hop The next hop next(i, k).
+         */
+        template <bool Ties>
+        static void relaxRow(Distance* distances, std::int32_t* next, std::int32_t* hops, const Distance* through,
+                             const std::int32_t* throughHops, Distance toK, std::int32_t hopsToK, std::int32_t hop) {
+            int j = 0;
+#if CORE_AVX2_KERNELS
+            if constexpr (std::is_same_v<Distance, double>) {
+                if (Core::cpuSupportsAvx2()) j = relaxRowAvx2<Ties>(distances, next, hops, through, throughHops, toK, hopsToK, hop);
+            }
+#endif
+            for (; j < TILE; ++j) {
+                if constexpr (Traits::isIntegral) {
+                    if (through[j] >= UNREACHED) continue;
+                }
+                Distance candidate = toK + through[j];
+                bool better = candidate < distances[j];
+                if constexpr (Ties) {
+                    std::int32_t candidateHops = hopsToK + throughHops[j];
+                    better = better || (candidate == distances[j] && candidate < UNREACHED && candidateHops < hops[j]);
+                    if (better) hops[j] = candidateHops;
+                }
+                if (better) {
+                    distances[j] = candidate;
+                    next[j] = hop;
+                }
+            }
+        }
+
+#if CORE_AVX2_KERNELS
+        /**
+         * @brief AVX2 part of relaxRow() for double distances: lowers four cells per step.
+         * * Takes the same arguments as relaxRow().
+         * @return The number of cells handled, TILE rounded down to a multiple of four.
+         */
+        template <bool Ties>
+        CORE_AVX2_TARGET static int relaxRowAvx2(double* distances, std::int32_t* next, std::int32_t* hops, const double* through,
+                                                 const std::int32_t* throughHops, double toK, std::int32_t hopsToK, std::int32_t hop) {
+            int j = 0;
+            __m256d base = _mm256_set1_pd(toK);
+            __m256d unreached = _mm256_set1_pd(UNREACHED);
+            __m128i hopBase = _mm_set1_epi32(hopsToK);
+            __m128i hopFill = _mm_set1_epi32(hop);
+            __m256i low = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+            for (; j + 4 <= TILE; j += 4) {
+                __m256d candidate = _mm256_add_pd(base, _mm256_loadu_pd(through + j));
+                __m256d current = _mm256_loadu_pd(distances + j);
+                __m256d better = _mm256_cmp_pd(candidate, current, _CMP_LT_OQ);
+                __m128i lanes;
+                if constexpr (Ties) {
+                    __m256d tied = _mm256_and_pd(_mm256_cmp_pd(candidate, current, _CMP_EQ_OQ),
+                                                 _mm256_cmp_pd(candidate, unreached, _CMP_LT_OQ));
+                    __m256d either = _mm256_or_pd(better, tied);
+                    if (_mm256_testz_pd(either, either)) continue;
+                    __m128i* hopSlot = reinterpret_cast<__m128i*>(hops + j);
+                    __m128i candidateHops = _mm_add_epi32(hopBase, _mm_loadu_si128(reinterpret_cast<const __m128i*>(throughHops + j)));
+                    __m128i currentHops = _mm_loadu_si128(hopSlot);
+                    __m128i shorter = _mm_and_si128(narrow(tied, low), _mm_cmpgt_epi32(currentHops, candidateHops));
+                    lanes = _mm_or_si128(narrow(better, low), shorter);
+                    better = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(lanes));
+                    _mm_storeu_si128(hopSlot, _mm_blendv_epi8(currentHops, candidateHops, lanes));
+                } else {
+                    if (_mm256_testz_pd(better, better)) continue;
+                    lanes = narrow(better, low);
+                }
+                _mm256_storeu_pd(distances + j, _mm256_blendv_pd(current, candidate, better));
+                __m128i* slot = reinterpret_cast<__m128i*>(next + j);
+                _mm_storeu_si128(slot, _mm_blendv_epi8(_mm_loadu_si128(slot), hopFill, lanes));
+            }
+            return j;
+        }
+
+        /**
+         * @brief Packs the low halves of the four 64-bit lanes of a comparison mask into four 32-bit lanes.
+         * @param mask The mask, all ones or all zeros per lane.
+         * @param low The permutation selecting the even 32-bit lanes.
+         * @return The mask narrowed to match std::int32_t columns.
+         */
+        CORE_AVX2_TARGET static __m128i narrow(__m256d mask, __m256i low) {
+            return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(mask), low));
+        }
+#endif
+
+        Core::ThreadPool* m_pool;              ///< The pool that relaxes the tiles.
+        int m_count = 0;                       ///< Vertex IDs covered by the last run.
+        std::size_t m_stride = 0;              ///< Row length of the matrices, m_count rounded up to a multiple of TILE.
+        std::vector<Distance> m_distances;     ///< Row-major shortest distances, padding included.
+        std::vector<std::int32_t> m_next;      ///< Row-major next hops, -1 where there is no path.
+        std::vector<std::int32_t> m_hops;      ///< Row-major edge counts of the paths, only kept when weights can tie at zero.
+    };
+}
@@ -0,0 +1,283 @@
+/**
+ * @file MinPlusMatrix.h
+ * @brief Dense square matrices over the (min, +) semiring and their register-blocked, multithreaded product.
+ */
+
+#pragma once
+#include "ThreadPool.h"
+#include "CpuFeatures.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief A square matrix of path lengths, multiplied with min in place of + and + in place of *.
+     * * Cell (i, j) of the min-plus product A (x) B is min over k of A(i, k) + B(k, j). If A holds the cheapest
+     * walks of at most a edges and B those of at most b edges, the product holds those of at most a + b
+     * edges, which is what shortest-path algorithms built on top of it rely on.
+     * * Rows are padded to a multiple of NR columns and the matrix to as many rows, with UNREACHED in the
+     * padding. The product is computed MR x NR cells at a time, kept in registers while a panel of KC values
+     * of k streams through them; a panel of B spans NC columns so that it stays in cache across the row
+     * blocks of a thread (Goto and van de Geijn's blocking for matrix products). Row blocks are spread over
+     * a Core::ThreadPool. On CPUs with AVX2, detected at runtime, double and std::int64_t
+     * matrices use four-lane vector instructions; other element types and CPUs use plain loops.
+     * * Integer matrices cannot hold infinity, so UNREACHED is a quarter of the largest value and any product
+     * cell at or above half of UNREACHED is rounded up to it. Finite path lengths must stay below that bound.
+     * @tparam T The element type, an arithmetic type.
+     */
+    template <typename T>
+    class MinPlusMatrix {
+        static_assert(std::is_arithmetic_v<T>, "Min-plus matrices hold arithmetic values");
+
+    public:
+        /**
+         * @brief The value of a cell without any walk: infinity for floating-point types, a quarter of the largest value otherwise.
+         */
+        static constexpr T UNREACHED = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                              : std::numeric_limits<T>::max() / 4;
+        static constexpr std::size_t MR = 4;    ///< Rows of the register block.
+        static constexpr std::size_t NR = 8;    ///< Columns of the register block, two AVX2 registers of 64-bit lanes.
+        static constexpr std::size_t KC = 128;  ///< Values of k per panel.
+        static constexpr std::size_t NC = 256;  ///< Columns per panel of the right operand.
+
+        /**
+         * @brief Constructs an empty matrix.
+         */
+        MinPlusMatrix() = default;
+
+        /**
+         * @brief Constructs a matrix with every cell UNREACHED.
+         * * @param size The number of rows and columns.
+         */
+        explicit MinPlusMatrix(int size) { reset(size); }
+
+        /**
+         * @brief Resizes the matrix and sets every cell to UNREACHED, reusing the buffer when it is large enough.
+         * * @param size The number of rows and columns.
+         */
+        void reset(int size) {
+            m_size = std::max(size, 0);
+            m_stride = (static_cast<std::size_t>(m_size) + NR - 1) / NR * NR;
+            m_cells.assign(m_stride * m_stride, UNREACHED);
+        }
+
+        /**
+         * @brief Gets the number of rows and columns.
+         * * @return The size passed to the constructor or to reset().
+         */
+        int getSize() const { return m_size; }
+
+        /**
+         * @brief Gets the distance between the starts of consecutive rows.
+         * * @return The size rounded up to a multiple of NR.
+         */
+        std::size_t getStride() const { return m_stride; }
+
+        /**
+         * @brief Gets a cell. Both indices must be below getSize().
+         * * @param row The row index.
+         * @param column The column index.
+         * @return The stored value.
+         */
+        T get(int row, int column) const { return m_cells[row * m_stride + column]; }
+
+        /**
+         * @brief Sets a cell. Both indices must be below getSize().
+         * * @param row The row index.
+         * @param column The column index.
+         * @param value The new value.
+         */
+        void set(int row, int column, T value) { m_cells[row * m_stride + column] = value; }
+
+        /**
+         * @brief Gets the cells of a row, padding included. The index must be below getStride().
+         * * @param row The row index.
+         * @return A pointer to getStride() cells.
+         */
+        T* getRow(int row) { return m_cells.data() + row * m_stride; }
+
+        /**
+         * @brief Gets the cells of a row, padding included. The index must be below getStride().
+         * * @param row The row index.
+         * @return A pointer to getStride() constant cells.
+         */
+        const T* getRow(int row) const { return m_cells.data() + row * m_stride; }
+
+        /**
+         * @brief Compares two matrices cell by cell.
+         * * @param other The matrix to compare with.
+         * @return true If both have the same size and cells.
+         */
+        bool operator==(const MinPlusMatrix& other) const { return m_size == other.m_size && m_cells == other.m_cells; }
+
+        /**
+         * @brief Computes the min-plus product of two matrices of the same size.
+         * * Costs O(N^3 / P) for P threads in the worst case. A row block skips every k at which all of its
+         * rows of the left operand are UNREACHED, so sparse operands are cheaper.
+         * @param left The left operand A.
+         * @param right The right operand B.
+         * @param out Receives A (x) B, resized to their size. It must be a different object from both operands.
+         * @param pool The pool that computes the row blocks.
+         */
+        static void multiply(const MinPlusMatrix& left, const MinPlusMatrix& right, MinPlusMatrix& out,
+                             Core::ThreadPool& pool = Core::ThreadPool::shared()) {
+            out.reset(left.m_size);
+            std::size_t stride = left.m_stride;
+            std::size_t depth = static_cast<std::size_t>(left.m_size);
+            std::size_t blocks = (depth + MR - 1) / MR;
+            std::vector<std::vector<T>> panels(pool.getThreadCount());
+            pool.parallelFor(blocks, 16, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                std::vector<T>& panel = panels[thread];
+                panel.resize(KC * NC);
+                for (std::size_t jc = 0; jc < stride; jc += NC) {
+                    std::size_t jEnd = std::min(jc + NC, stride);
+                    for (std::size_t kc = 0; kc < depth; kc += KC) {
+                        std::size_t kCount = std::min(KC, depth - kc);
+                        pack(right, panel.data(), kc, kCount, jc, jEnd);
+                        for (std::size_t block = begin; block < end; ++block) {
+                            const T* a = left.m_cells.data() + block * MR * stride + kc;
+                            T* c = out.m_cells.data() + block * MR * stride;
+                            for (std::size_t j = jc; j < jEnd; j += NR) {
+                                multiplyBlock(a, panel.data() + (j - jc) * kCount, c + j, stride, kCount);
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+    private:
+        static constexpr T HALF = UNREACHED / 2;  ///< Integer cells at or above this are rounded up to UNREACHED.
+
+        /**
+         * @brief Copies a panel of the right operand so that each NR-column strip is contiguous.
+         * * Rows of the matrix lie a power of two apart for many sizes, so reading a strip in place would
+         * make its rows compete for the same cache sets.
+         * @param right The right operand.
+         * @param panel Receives the strips one after the other, each as kCount rows of NR values.
+         * @param kBegin The first row of the panel.
+         * @param kCount The number of rows of the panel.
+         * @param jBegin The first column of the panel, a multiple of NR.
+         * @param jEnd One past the last column of the panel, a multiple of NR.
+         */
+        static void pack(const MinPlusMatrix& right, T* panel, std::size_t kBegin, std::size_t kCount,
+                         std::size_t jBegin, std::size_t jEnd) {
+            for (std::size_t k = 0; k < kCount; ++k) {
+                const T* row = right.m_cells.data() + (kBegin + k) * right.m_stride;
+                for (std::size_t j = jBegin; j < jEnd; j += NR) {
+                    std::copy_n(row + j, NR, panel + (j - jBegin) * kCount + k * NR);
+                }
+            }
+        }
+
+        /**
+         * @brief Lowers an MR x NR block of the product through a panel of k.
+         * * @param a The block's first row of the left operand, at the panel's first k.
+         * @param b The packed strip of the right operand, kCount rows of NR values.
+         * @param c The block's first cell of the product, holding its values over earlier panels.
+         * @param stride The row stride of the left operand and the product.
+         * @param kCount The number of values of k in the panel.
+         */
+        static void multiplyBlock(const T* a, const T* b, T* c, std::size_t stride, std::size_t kCount) {
+#if CORE_AVX2_KERNELS
+            if constexpr (std::is_same_v<T, double> || std::is_same_v<T, std::int64_t>) {
+                if (Core::cpuSupportsAvx2()) {
+                    multiplyBlockAvx2(a, b, c, stride, kCount);
+                    return;
+                }
+            }
+#endif
+            T acc[MR][NR];
+            for (std::size_t r = 0; r < MR; ++r) {
+                for (std::size_t n = 0; n < NR; ++n) acc[r][n] = c[r * stride + n];
+            }
+            for (std::size_t k = 0; k < kCount; ++k) {
+                if (std::min({a[k], a[stride + k], a[2 * stride + k], a[3 * stride + k]}) >= UNREACHED) continue;
+                const T* bk = b + k * NR;
+                for (std::size_t r = 0; r < MR; ++r) {
+                    T ar = a[r * stride + k];
+                    for (std::size_t n = 0; n < NR; ++n) acc[r][n] = std::min<T>(acc[r][n], ar + bk[n]);
+                }
+            }
+            for (std::size_t r = 0; r < MR; ++r) {
+                for (std::size_t n = 0; n < NR; ++n) {
+                    if constexpr (std::is_integral_v<T>) c[r * stride + n] = acc[r][n] >= HALF ? UNREACHED : acc[r][n];
+                    else c[r * stride + n] = acc[r][n];
+                }
+            }
+        }
+
+#if CORE_AVX2_KERNELS
+        /**
+         * @brief AVX2 part of multiplyBlock() for double and std::int64_t matrices.
+         * * Takes the same arguments as multiplyBlock().
+         */
+        CORE_AVX2_TARGET static void multiplyBlockAvx2(const T* a, const T* b, T* c, std::size_t stride, std::size_t kCount) {
+            if constexpr (std::is_same_v<T, double>) {
+                __m256d acc[MR][2];
+                for (std::size_t r = 0; r < MR; ++r) {
+                    acc[r][0] = _mm256_loadu_pd(c + r * stride);
+                    acc[r][1] = _mm256_loadu_pd(c + r * stride + 4);
+                }
+                for (std::size_t k = 0; k < kCount; ++k) {
+                    if (std::min({a[k], a[stride + k], a[2 * stride + k], a[3 * stride + k]}) >= UNREACHED) continue;
+                    __m256d b0 = _mm256_loadu_pd(b + k * NR);
+                    __m256d b1 = _mm256_loadu_pd(b + k * NR + 4);
+                    for (std::size_t r = 0; r < MR; ++r) {
+                        __m256d ar = _mm256_set1_pd(a[r * stride + k]);
+                        acc[r][0] = _mm256_min_pd(acc[r][0], _mm256_add_pd(ar, b0));
+                        acc[r][1] = _mm256_min_pd(acc[r][1], _mm256_add_pd(ar, b1));
+                    }
+                }
+                for (std::size_t r = 0; r < MR; ++r) {
+                    _mm256_storeu_pd(c + r * stride, acc[r][0]);
+                    _mm256_storeu_pd(c + r * stride + 4, acc[r][1]);
+                }
+            } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                __m256i acc[MR][2];
+                for (std::size_t r = 0; r < MR; ++r) {
+                    acc[r][0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + r * stride));
+                    acc[r][1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + r * stride + 4));
+                }
+                for (std::size_t k = 0; k < kCount; ++k) {
+                    if (std::min({a[k], a[stride + k], a[2 * stride + k], a[3 * stride + k]}) >= UNREACHED) continue;
+                    __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * NR));
+                    __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * NR + 4));
+                    for (std::size_t r = 0; r < MR; ++r) {
+                        __m256i ar = _mm256_set1_epi64x(a[r * stride + k]);
+                        acc[r][0] = lower(acc[r][0], _mm256_add_epi64(ar, b0));
+                        acc[r][1] = lower(acc[r][1], _mm256_add_epi64(ar, b1));
+                    }
+                }
+                __m256i unreached = _mm256_set1_epi64x(UNREACHED);
+                __m256i belowHalf = _mm256_set1_epi64x(HALF - 1);
+                for (std::size_t r = 0; r < MR; ++r) {
+                    for (std::size_t h = 0; h < 2; ++h) {
+                        __m256i clamped = _mm256_blendv_epi8(acc[r][h], unreached, _mm256_cmpgt_epi64(acc[r][h], belowHalf));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + r * stride + 4 * h), clamped);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Lane-wise minimum of two vectors of signed 64-bit integers.
+         * @param current The values kept where they are not larger.
+         * @param candidate The values taken where they are smaller.
+         * @return The lane-wise minimum.
+         */
+        CORE_AVX2_TARGET static __m256i lower(__m256i current, __m256i candidate) {
+            return _mm256_blendv_epi8(current, candidate, _mm256_cmpgt_epi64(current, candidate));
+        }
+#endif
+
+        int m_size = 0;            ///< Number of rows and columns in use.
+        std::size_t m_stride = 0;  ///< Row length and row count of the buffer, m_size rounded up to a multiple of NR.
+        std::vector<T> m_cells;    ///< Row-major cells, padding included.
+    };
+}
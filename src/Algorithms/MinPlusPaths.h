@@ -0,0 +1,198 @@
+/**
+ * @file MinPlusPaths.h
+ * @brief All-pairs and hop-bounded shortest distances on an AdjacencyMatrix by min-plus matrix powers.
+ */
+
+#pragma once
+#include "AdjacencyMatrix.h"
+#include "MinPlusMatrix.h"
+#include "ThreadPool.h"
+#include "WeightTraits.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Algorithms {
+
+    /**
+     * @brief Headless shortest distances between every pair of vertices from powers of the weight matrix.
+     * * The matrix W holds the edge weights with 0 on the diagonal, so its min-plus power W^k holds the
+     * cheapest walk of at most k edges between every pair. runBoundedHops() computes W^k with O(log k)
+     * products by binary exponentiation, which answers "the cheapest route with at most k hops" for every
+     * pair at once; Dijkstra cannot bound the number of edges. run() squares W until it stops changing, at
+     * most ceil(log2 V) + 1 times, which yields the unbounded distances. Products are
+     * MinPlusMatrix::multiply() on a Core::ThreadPool.
+     * * Integer weights are summed in std::int64_t and floating-point ones in their distance type. Negative
+     * weights are allowed; with a negative cycle, run() reports it through hasNegativeCycle() and its
+     * distances are meaningless, while hop-bounded distances stay exact. Paths are not kept; see
+     * FloydWarshall for next hops.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class MinPlusPaths {
+    private:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+    public:
+        using Element = std::conditional_t<Traits::isIntegral, std::int64_t, Distance>;  ///< The type of the matrix cells.
+        using Matrix = MinPlusMatrix<Element>;                                           ///< The matrix type multiplied.
+
+        /**
+         * @brief Constructs the solver.
+         * * @param pool The pool that computes the products; it must outlive the solver.
+         */
+        explicit MinPlusPaths(Core::ThreadPool& pool = Core::ThreadPool::shared()) : m_pool(&pool) {}
+
+        /**
+         * @brief Computes the shortest distances between every pair of vertices by repeated squaring.
+         * * Costs O(V^3 log V / P) for P threads, less when the distances settle after fewer squarings.
+         * Unweighted graphs use weight 1 per edge; removed vertices reach nothing and are reached by nothing.
+         * @param graph The matrix to read. It is not kept, so later changes need another run.
+         */
+        template <typename DirectionPolicy, typename WeightPolicy>
+        void run(const Core::AdjacencyMatrix<TVertex, DirectionPolicy, WeightPolicy, TWeight>& graph) {
+            load(graph, m_result);
+            m_products = 0;
+            m_hopLimit = -1;
+            int squarings = std::bit_width(static_cast<unsigned>(std::max(m_result.getSize() - 1, 1)));
+            for (int s = 0; s < squarings; ++s) {
+                Matrix::multiply(m_result, m_result, m_scratch, *m_pool);
+                ++m_products;
+                bool settled = m_scratch == m_result;
+                std::swap(m_result, m_scratch);
+                if (settled) break;
+            }
+        }
+
+        /**
+         * @brief Computes the cheapest walk of at most a given number of edges between every pair of vertices.
+         * * Costs O(V^3 log k / P) for P threads. Without negative weights, k is capped at V - 1 first,
+         * since longer walks are never cheaper.
+         * @param graph The matrix to read. It is not kept, so later changes need another run.
+         * @param maxHops The largest number of edges k; 0 leaves only each existing vertex at distance 0 from itself.
+         */
+        template <typename DirectionPolicy, typename WeightPolicy>
+        void runBoundedHops(const Core::AdjacencyMatrix<TVertex, DirectionPolicy, WeightPolicy, TWeight>& graph, int maxHops) {
+            bool negative = load(graph, m_base);
+            m_products = 0;
+            m_hopLimit = std::max(maxHops, 0);
+            int n = m_base.getSize();
+
+            if (m_hopLimit == 0) {
+                m_result.reset(n);
+                for (int v = 0; v < n; ++v) {
+                    if (m_base.get(v, v) < Matrix::UNREACHED) m_result.set(v, v, 0);
+                }
+                return;
+            }
+
+            unsigned remaining = static_cast<unsigned>(negative ? m_hopLimit : std::min(m_hopLimit, std::max(n - 1, 1))) - 1;
+            m_result = m_base;
+            while (remaining > 0) {
+                if (remaining & 1u) {
+                    Matrix::multiply(m_result, m_base, m_scratch, *m_pool);
+                    std::swap(m_result, m_scratch);
+                    ++m_products;
+                }
+                remaining >>= 1;
+                if (remaining > 0) {
+                    Matrix::multiply(m_base, m_base, m_scratch, *m_pool);
+                    std::swap(m_base, m_scratch);
+                    ++m_products;
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the distance between two vertices in the last run.
+         * * @param from The source vertex ID.
+         * @param to The destination vertex ID.
+         * @return The length of the cheapest walk within the run's hop limit, or
+         * Core::WeightTraits<TWeight>::infinity() if there is none or either ID is out of range or removed.
+         */
+        Distance getDistance(int from, int to) const {
+            int n = m_result.getSize();
+            if (from < 0 || from >= n || to < 0 || to >= n) return Traits::infinity();
+            Element value = m_result.get(from, to);
+            return value >= Matrix::UNREACHED ? Traits::infinity() : static_cast<Distance>(value);
+        }
+
+        /**
+         * @brief Gets the distance matrix of the last run.
+         * * @return A constant reference to the matrix; unreached cells hold Matrix::UNREACHED.
+         */
+        const Matrix& getMatrix() const { return m_result; }
+
+        /**
+         * @brief Gets the hop limit of the last run.
+         * * @return The k passed to runBoundedHops(), or -1 after run().
+         */
+        int getHopLimit() const { return m_hopLimit; }
+
+        /**
+         * @brief Gets the number of matrix products computed by the last run.
+         * * @return The product count.
+         */
+        std::size_t getProductCount() const { return m_products; }
+
+        /**
+         * @brief Checks if some vertex lies on a cycle of negative length in the last run.
+         * * Only meaningful after run(); within a hop limit, a negative diagonal cell only shows a short cycle.
+         * @return true If some vertex has a negative distance to itself.
+         */
+        bool hasNegativeCycle() const {
+            for (int v = 0; v < m_result.getSize(); ++v) {
+                if (m_result.get(v, v) < 0) return true;
+            }
+            return false;
+        }
+
+    private:
+        /**
+         * @brief Fills a matrix with the edge weights of the graph and 0 on the diagonal of existing vertices.
+         * * A negative self-loop replaces the 0 on the diagonal.
+         * @param graph The matrix to read.
+         * @param weights Receives W.
+         * @return true If some weight is negative.
+         */
+        template <typename DirectionPolicy, typename WeightPolicy>
+        bool load(const Core::AdjacencyMatrix<TVertex, DirectionPolicy, WeightPolicy, TWeight>& graph, Matrix& weights) {
+            int n = graph.getVertexCount();
+            weights.reset(n);
+            std::span<const std::uint64_t> active = graph.getActiveMask();
+            std::atomic<bool> negative = false;
+            m_pool->parallelFor(static_cast<std::size_t>(n), 64, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    if (!((active[i >> 6] >> (i & 63)) & 1u)) continue;
+                    Element* row = weights.getRow(static_cast<int>(i));
+                    row[i] = 0;
+                    std::span<const std::uint64_t> present = graph.getPresenceRow(static_cast<int>(i));
+                    std::span<const TWeight> values = graph.getWeightRow(static_cast<int>(i));
+                    for (std::size_t w = 0; w < present.size(); ++w) {
+                        for (std::uint64_t bits = present[w] & active[w]; bits; bits &= bits - 1) {
+                            std::size_t j = w * 64 + std::countr_zero(bits);
+                            Element weight = values.empty() ? Element{1} : static_cast<Element>(values[j]);
+                            if (weight < 0) negative.store(true, std::memory_order_relaxed);
+                            row[j] = j == i ? std::min<Element>(weight, 0) : weight;
+                        }
+                    }
+                }
+            });
+            return negative.load(std::memory_order_relaxed);
+        }
+
+        Core::ThreadPool* m_pool;      ///< The pool that computes the products.
+        Matrix m_result;               ///< Distances of the last run.
+        Matrix m_base;                 ///< W raised to the current power of two while exponentiating.
+        Matrix m_scratch;              ///< Output buffer of the current product, swapped in afterwards.
+        int m_hopLimit = -1;           ///< Hop limit of the last run, -1 for none.
+        std::size_t m_products = 0;    ///< Matrix products computed by the last run.
+    };
+}
@@ -0,0 +1,198 @@
+/**
+ * @file MultiSourceBFS.h
+ * @brief Breadth-first searches from many sources at once, sharing every edge scan through per-vertex bitmasks.
+ */
+
+#pragma once
+#include "CsrGraph.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Headless multi-source BFS (MS-BFS) over a CSR snapshot.
+     * * Sources are processed in batches of 64 * Words. Each vertex holds three bitmasks with one bit per
+     * search of the batch: the searches that have seen it, the searches that expand it in the current level
+     * and the searches that reach it in the next one. A level scans the out-edges of every vertex with a
+     * non-empty visit mask once and ORs the bits not seen by the neighbour into the neighbour's next mask,
+     * so an edge shared by several searches is scanned once per batch instead of once per source
+     * (Then et al., "The More the Merrier"). With Words = 4 the masks are 256 bits wide and the mask
+     * operations are plain loops over four words, which compilers turn into SIMD instructions.
+     * * Levels are those of Algorithms::BFS from each source.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     * @tparam Words The number of 64-bit words per mask, i.e. searches per batch divided by 64.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double, std::size_t Words = 1>
+    class MultiSourceBFS {
+    private:
+        /**
+         * @brief One bit per search of the batch.
+         */
+        struct Mask {
+            std::array<std::uint64_t, Words> words{};  ///< The bits, search i in word i / 64.
+
+            /**
+             * @brief Checks if any search has its bit set.
+             * @return true If the mask is not empty.
+             */
+            bool any() const {
+                std::uint64_t bits = 0;
+                for (std::size_t w = 0; w < Words; ++w) bits |= words[w];
+                return bits != 0;
+            }
+        };
+
+    public:
+        static constexpr std::size_t BATCH = 64 * Words;  ///< Number of searches carried by one pass over the graph.
+
+        /**
+         * @brief Runs a BFS from every source and reports each reached (source, vertex) pair.
+         * * Costs O(ceil(S / BATCH) * (L * V + E)) for S sources and at most L levels per batch, plus one call per pair.
+         * @tparam Visit Callable as visit(std::size_t sourceIndex, int vertex, int level).
+         * @param graph The snapshot to search.
+         * @param sources The start vertices; a vertex may appear more than once.
+         * @param visit Called once per source for every vertex it reaches, the source itself at level 0.
+         * Calls of one source come in non-decreasing level order.
+         * @return true If the searches ran.
+         * @return false If some source does not exist; nothing is reported then.
+         */
+        template <typename Visit>
+        bool run(const Core::CsrGraph<TVertex, TWeight>& graph, std::span<const int> sources, Visit&& visit) {
+            for (int source : sources) {
+                if (!graph.hasVertex(source)) return false;
+            }
+            m_edgesScanned = 0;
+            for (std::size_t first = 0; first < sources.size(); first += BATCH) {
+                std::size_t count = std::min(BATCH, sources.size() - first);
+                runBatch(graph, sources.subspan(first, count), first, visit);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Runs a BFS from every source and keeps the levels as a sources x vertices matrix.
+         * * @param graph The snapshot to search.
+         * @param sources The start vertices; a vertex may appear more than once.
+         * @return true If the searches ran.
+         * @return false If some source does not exist; the matrix is left empty then.
+         */
+        bool run(const Core::CsrGraph<TVertex, TWeight>& graph, std::span<const int> sources) {
+            std::size_t count = static_cast<std::size_t>(graph.getVertexCount());
+            m_columns = count;
+            m_levels.assign(sources.size() * count, -1);
+            bool ran = run(graph, sources, [this, count](std::size_t source, int vertex, int level) {
+                m_levels[source * count + vertex] = level;
+            });
+            if (!ran) {
+                m_levels.clear();
+                m_columns = 0;
+            }
+            return ran;
+        }
+
+        /**
+         * @brief Gets the level of a vertex in the search from one source of the last matrix run.
+         * * @param sourceIndex The position of the source in the sources passed to run().
+         * @param vertex The vertex ID.
+         * @return The number of edges on a shortest path, or -1 if unreached or out of range.
+         */
+        int getLevel(std::size_t sourceIndex, int vertex) const {
+            if (vertex < 0 || static_cast<std::size_t>(vertex) >= m_columns) return -1;
+            std::size_t index = sourceIndex * m_columns + vertex;
+            return index < m_levels.size() ? m_levels[index] : -1;
+        }
+
+        /**
+         * @brief Gets the levels of every vertex in the search from one source of the last matrix run.
+         * * @param sourceIndex The position of the source in the sources passed to run().
+         * @return A view of the row, -1 for unreached vertices; empty if out of range.
+         */
+        std::span<const int> getRow(std::size_t sourceIndex) const {
+            if ((sourceIndex + 1) * m_columns > m_levels.size()) return {};
+            return std::span<const int>(m_levels.data() + sourceIndex * m_columns, m_columns);
+        }
+
+        /**
+         * @brief Gets the whole level matrix of the last matrix run, one row per source.
+         * * @return A constant reference to the row-major matrix.
+         */
+        const std::vector<int>& getLevels() const { return m_levels; }
+
+        /**
+         * @brief Gets the number of out-edges scanned by the last run, over all batches.
+         * * Separate searches would scan each reached vertex's out-edges once per source.
+         * @return The count of scanned edges.
+         */
+        std::size_t getEdgesScanned() const { return m_edgesScanned; }
+
+    private:
+        /**
+         * @brief Runs the searches of one batch to completion.
+         * * @param graph The snapshot to search.
+         * @param batch The sources of the batch, at most BATCH of them.
+         * @param first The index of batch[0] among all sources.
+         * @param visit The callback of run().
+         */
+        template <typename Visit>
+        void runBatch(const Core::CsrGraph<TVertex, TWeight>& graph, std::span<const int> batch, std::size_t first, Visit& visit) {
+            int count = graph.getVertexCount();
+            m_seen.assign(count, Mask{});
+            m_visit.assign(count, Mask{});
+            m_next.assign(count, Mask{});
+
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                std::uint64_t bit = std::uint64_t{1} << (i & 63);
+                m_seen[batch[i]].words[i >> 6] |= bit;
+                m_visit[batch[i]].words[i >> 6] |= bit;
+                visit(first + i, batch[i], 0);
+            }
+
+            for (int level = 1; ; ++level) {
+                for (int v = 0; v < count; ++v) {
+                    if (!m_visit[v].any()) continue;
+                    const Mask& current = m_visit[v];
+                    std::span<const int> neighbors = graph.getNeighborSpan(v);
+                    m_edgesScanned += neighbors.size();
+                    for (int n : neighbors) {
+                        Mask& next = m_next[n];
+                        const Mask& seen = m_seen[n];
+                        for (std::size_t w = 0; w < Words; ++w) next.words[w] |= current.words[w] & ~seen.words[w];
+                    }
+                }
+
+                bool discovered = false;
+                for (int n = 0; n < count; ++n) {
+                    Mask& next = m_next[n];
+                    Mask& seen = m_seen[n];
+                    for (std::size_t w = 0; w < Words; ++w) {
+                        std::uint64_t fresh = next.words[w] & ~seen.words[w];
+                        next.words[w] = fresh;
+                        seen.words[w] |= fresh;
+                        for (; fresh; fresh &= fresh - 1) {
+                            visit(first + w * 64 + std::countr_zero(fresh), n, level);
+                            discovered = true;
+                        }
+                    }
+                }
+                if (!discovered) break;
+                std::swap(m_visit, m_next);
+                for (Mask& mask : m_next) mask = Mask{};
+            }
+        }
+
+        std::vector<Mask> m_seen;       ///< Searches of the batch that have reached each vertex.
+        std::vector<Mask> m_visit;      ///< Searches of the batch that expand each vertex in the current level.
+        std::vector<Mask> m_next;       ///< Searches of the batch that reach each vertex in the next level.
+        std::vector<int> m_levels;      ///< Level matrix of the last matrix run, row-major by source.
+        std::size_t m_columns = 0;      ///< Row length of m_levels, the vertex count of the snapshot.
+        std::size_t m_edgesScanned = 0; ///< Out-edges scanned by the last run.
+    };
+}
@@ -0,0 +1,168 @@
+/**
+ * @file ParallelBFS.h
+ * @brief Level-synchronous breadth-first search that expands each frontier on a thread pool.
+ */
+
+#pragma once
+#include "CsrGraph.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Headless breadth-first search over a CSR snapshot that uses every thread of a Core::ThreadPool.
+     * * Each level splits the frontier into chunks that the pool's threads claim and steal. A thread
+     * claims an undiscovered neighbour with a compare-and-swap of its level from -1, so every vertex is
+     * claimed exactly once, and appends it to the thread's own buffer. After the level, the buffers are
+     * laid end to end into the next frontier at offsets from a prefix sum, without any lock.
+     * * Levels are those of Algorithms::BFS from the same start. Parents are a vertex of the previous level
+     * with an edge to the child, but which one wins depends on thread timing when several qualify.
+     * The pool is passed in rather than owned, so several searches can share its threads, and the
+     * per-thread buffers are sized from its thread count once, at construction.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class ParallelBFS {
+    private:
+        /**
+         * @brief The vertices one thread discovered in the current level, kept on its own cache lines.
+         */
+        struct alignas(64) Buffer {
+            std::vector<int> vertices;  ///< Discovered vertices in claim order.
+        };
+
+    public:
+        /**
+         * @brief Constructs the search.
+         * * @param pool The pool that runs the levels; it must outlive the search.
+         * @param grain The number of frontier vertices per chunk claimed by a thread.
+         */
+        explicit ParallelBFS(Core::ThreadPool& pool = Core::ThreadPool::shared(), std::size_t grain = 256)
+            : m_pool(&pool), m_grain(grain), m_buffers(pool.getThreadCount()) {}
+
+        /**
+         * @brief Runs a full breadth-first search from a start vertex.
+         * * Runs in O((V + E) / P + L * P) for P threads and L levels.
+         * @param graph The snapshot to search. It is only read, so other searches may share it.
+         * @param startId The ID of the starting vertex.
+         * @return true If the search ran.
+         * @return false If startId does not exist.
+         */
+        bool run(const Core::CsrGraph<TVertex, TWeight>& graph, int startId) {
+            if (!graph.hasVertex(startId)) return false;
+
+            m_levels.assign(graph.getVertexCount(), -1);
+            m_parents.assign(graph.getVertexCount(), -1);
+            m_frontier.assign(1, startId);
+            m_levels[startId] = 0;
+            m_reached = 1;
+            m_levelCount = 1;
+
+            for (int level = 1; !m_frontier.empty(); ++level) {
+                expand(graph, level);
+                gather();
+                m_reached += static_cast<int>(m_frontier.size());
+                if (!m_frontier.empty()) m_levelCount = level + 1;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Gets the BFS level of a vertex in the last run.
+         * * @param id The vertex ID.
+         * @return The number of edges on a shortest path from the start, or -1 if unreached.
+         */
+        int getLevel(int id) const { return id >= 0 && id < static_cast<int>(m_levels.size()) ? m_levels[id] : -1; }
+
+        /**
+         * @brief Gets the parent of a vertex in the BFS tree of the last run.
+         * * @param id The vertex ID.
+         * @return The parent ID, or -1 for the start and unreached vertices.
+         */
+        int getParent(int id) const { return id >= 0 && id < static_cast<int>(m_parents.size()) ? m_parents[id] : -1; }
+
+        /**
+         * @brief Gets the levels of all vertices, -1 for unreached ones.
+         * * @return A constant reference to the level array.
+         */
+        const std::vector<int>& getLevels() const { return m_levels; }
+
+        /**
+         * @brief Gets the parents of all vertices, -1 for the start and unreached ones.
+         * * @return A constant reference to the parent array.
+         */
+        const std::vector<int>& getParents() const { return m_parents; }
+
+        /**
+         * @brief Gets the number of vertices reached by the last run, including the start.
+         * * @return The reached count.
+         */
+        int getReachedCount() const { return m_reached; }
+
+        /**
+         * @brief Gets the number of non-empty levels of the last run.
+         * * @return The deepest level plus one.
+         */
+        int getLevelCount() const { return m_levelCount; }
+
+    private:
+        /**
+         * @brief Scans the out-edges of the frontier in parallel and claims undiscovered neighbours.
+         * * @param graph The snapshot being searched.
+         * @param level The level of the vertices discovered.
+         */
+        void expand(const Core::CsrGraph<TVertex, TWeight>& graph, int level) {
+            for (Buffer& buffer : m_buffers) buffer.vertices.clear();
+            m_pool->parallelFor(m_frontier.size(), m_grain, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                std::vector<int>& found = m_buffers[thread].vertices;
+                for (std::size_t i = begin; i < end; ++i) {
+                    int u = m_frontier[i];
+                    for (int v : graph.getNeighborSpan(u)) {
+                        std::atomic_ref<int> slot(m_levels[v]);
+                        if (slot.load(std::memory_order_relaxed) >= 0) continue;
+                        int unseen = -1;
+                        if (!slot.compare_exchange_strong(unseen, level, std::memory_order_relaxed)) continue;
+                        m_parents[v] = u;
+                        found.push_back(v);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Replaces the frontier with the contents of the per-thread buffers.
+         * * Each buffer is copied in parallel to its offset in the prefix sum of the buffer sizes.
+         */
+        void gather() {
+            std::size_t total = 0;
+            m_offsets.resize(m_buffers.size());
+            for (std::size_t t = 0; t < m_buffers.size(); ++t) {
+                m_offsets[t] = total;
+                total += m_buffers[t].vertices.size();
+            }
+            m_frontier.resize(total);
+            m_pool->parallelFor(m_buffers.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t t = begin; t < end; ++t) {
+                    const std::vector<int>& found = m_buffers[t].vertices;
+                    std::copy(found.begin(), found.end(), m_frontier.begin() + m_offsets[t]);
+                }
+            });
+        }
+
+        Core::ThreadPool* m_pool;                 ///< The pool that runs the levels.
+        std::size_t m_grain;                      ///< Frontier vertices per chunk.
+        std::vector<Buffer> m_buffers;            ///< Vertices discovered in the current level, one buffer per thread.
+        std::vector<std::size_t> m_offsets;       ///< Position of each buffer in the next frontier.
+        std::vector<int> m_frontier;              ///< The vertices of the current level.
+        std::vector<int> m_levels;                ///< Level of each vertex, -1 until claimed.
+        std::vector<int> m_parents;               ///< BFS tree parent of each vertex, -1 for the start and unreached vertices.
+        int m_reached = 0;                        ///< Vertices reached in the last run.
+        int m_levelCount = 0;                     ///< Non-empty levels in the last run.
+    };
+}
@@ -0,0 +1,315 @@
+/**
+ * @file ParallelDeltaStepping.h
+ * @brief Delta-stepping shortest paths with every bucket's relaxations spread over a thread pool.
+ */
+
+#pragma once
+#include "DeltaStepping.h"
+#include "CsrGraph.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Algorithms {
+
+    /**
+     * @brief Headless delta-stepping over a CSR snapshot that relaxes each bucket on a Core::ThreadPool.
+     * * Follows the scheme of DeltaStepping, including its bounded ring and overflow list. Every light-edge
+     * round and heavy-edge pass splits its vertices into chunks claimed by the pool's threads. A relaxation
+     * lowers the target's distance with a compare-and-swap loop and, if it won, appends the target to the
+     * calling thread's own copy of the destination bucket. Before a round, the threads' copies of the current bucket are laid end to end at
+     * offsets from a prefix sum, so no lock is taken. A vertex listed several times in a round is expanded
+     * once, by the thread that stamps it first.
+     * * Distances are exactly those of Dijkstra for non-negative weights: both reach the same least fixed point
+     * of d(v) = min(d(u) + w(u, v)), whatever the order of relaxations. Predecessors are not tracked, since
+     * the last thread to lower a distance would overwrite them racily; use DeltaStepping, which runs on the
+     * same buckets and reports events, when the path or a step-by-step view is needed.
+     * * @tparam TVertex The vertex type used in the graph. Defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights. Defaults to double.
+     */
+    template<typename TVertex = Core::Vertex, typename TWeight = double>
+    class ParallelDeltaStepping {
+    private:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+        static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();  ///< Marks an empty overflow list.
+
+        /**
+         * @brief The buckets and the pending heavy relaxations of one thread, kept on their own cache lines.
+         */
+        struct alignas(64) Local {
+            std::vector<std::vector<int>> ring;  ///< The thread's share of each bucket, indexed like DeltaStepping's ring.
+            std::vector<ParkedVertex> overflow;  ///< The thread's vertices queued for buckets beyond the end of the ring.
+            std::size_t overflowMin = NONE;      ///< Lowest bucket in overflow, or NONE if it is empty.
+            std::vector<int> heavy;              ///< Vertices expanded by the thread in the current pass.
+            TWeight maxWeight = 0;               ///< Heaviest edge seen by the thread while sizing the ring.
+        };
+
+    public:
+        /**
+         * @brief Constructs the search.
+         * * @param delta The bucket width, or 0 to pick one with suggestDelta() at every run.
+         * @param pool The pool that relaxes the buckets; it must outlive the search.
+         * @param grain The number of vertices per chunk claimed by a thread.
+         */
+        explicit ParallelDeltaStepping(Distance delta = 0, Core::ThreadPool& pool = Core::ThreadPool::shared(), std::size_t grain = 128)
+            : m_delta(delta), m_pool(&pool), m_grain(grain), m_locals(pool.getThreadCount()) {}
+
+        /**
+         * @brief Computes the distances from a start vertex to every vertex.
+         * * @param graph The snapshot to search. It is only read, so other searches may share it.
+         * @param startId The ID of the starting vertex.
+         * @return true If the search ran.
+         * @return false If startId does not exist.
+         */
+        bool run(const Core::CsrGraph<TVertex, TWeight>& graph, int startId) {
+            if (!graph.hasVertex(startId)) return false;
+
+            TWeight maxWeight = heaviestEdge(graph);
+            std::size_t vertices = 0;
+            graph.forEachVertex([&](const TVertex&) { ++vertices; });
+            m_activeDelta = m_delta > 0 ? m_delta
+                          : suggestDelta(maxWeight, static_cast<double>(graph.getEdgeCount()) / std::max<std::size_t>(vertices, 1));
+
+            std::size_t ringSize = deltaRingSize<Distance>(static_cast<Distance>(maxWeight), m_activeDelta);
+            for (Local& local : m_locals) {
+                for (std::vector<int>& bucket : local.ring) bucket.clear();
+                local.ring.resize(ringSize);
+                local.overflow.clear();
+                local.overflowMin = NONE;
+                local.heavy.clear();
+            }
+            m_distances.assign(graph.getVertexCount(), Traits::infinity());
+            m_roundStamps.assign(graph.getVertexCount(), 0);
+            m_passStamps.assign(graph.getVertexCount(), 0);
+            m_round = 0;
+            m_pass = 0;
+            m_bucketCount = 0;
+
+            m_distances[startId] = 0;
+            m_locals[0].ring[0].push_back(startId);
+
+            for (std::size_t current = 0; findBucket(current); ++current) {
+                ++m_bucketCount;
+                settleBucket(graph, current);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Gets the distance from the start of the last run to a vertex.
+         * * @param id The vertex ID.
+         * @return The shortest path length, or Core::WeightTraits<TWeight>::infinity() if unreached.
+         */
+        Distance getDistance(int id) const {
+            return id >= 0 && id < static_cast<int>(m_distances.size()) ? m_distances[id] : Traits::infinity();
+        }
+
+        /**
+         * @brief Gets the distances of all vertices, infinity for unreached ones.
+         * * @return A constant reference to the distance array.
+         */
+        const std::vector<Distance>& getDistances() const { return m_distances; }
+
+        /**
+         * @brief Gets the bucket width of the last run.
+         * * @return The width passed to the constructor, or the one picked by run() if that was 0.
+         */
+        Distance getDelta() const { return m_activeDelta; }
+
+        /**
+         * @brief Gets the number of non-empty buckets settled by the last run.
+         * * @return The bucket count.
+         */
+        std::size_t getBucketCount() const { return m_bucketCount; }
+
+        /**
+         * @brief Gets the number of parallel rounds of the last run, light and heavy together.
+         * * Each round ends with the pool's threads synchronizing, so fewer rounds mean less waiting.
+         * @return The round count.
+         */
+        std::size_t getRoundCount() const { return m_round + m_pass; }
+
+    private:
+        /**
+         * @brief Finds the heaviest edge of the snapshot, scanning its weight array in parallel.
+         * * @param graph The snapshot.
+         * @return The largest weight, 0 if there are no edges.
+         */
+        TWeight heaviestEdge(const Core::CsrGraph<TVertex, TWeight>& graph) {
+            const std::vector<TWeight>& weights = graph.getWeights();
+            for (Local& local : m_locals) local.maxWeight = 0;
+            m_pool->parallelFor(weights.size(), 1 << 14, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                TWeight heaviest = m_locals[thread].maxWeight;
+                for (std::size_t e = begin; e < end; ++e) heaviest = std::max(heaviest, weights[e]);
+                m_locals[thread].maxWeight = heaviest;
+            });
+            TWeight heaviest = 0;
+            for (const Local& local : m_locals) heaviest = std::max(heaviest, local.maxWeight);
+            return heaviest;
+        }
+
+        /**
+         * @brief Moves to the lowest bucket that still has entries in some thread's ring or overflow list.
+         * * When the ring holds nothing below the lowest overflow bucket, the search jumps there and refills the ring.
+         * @param current In: the bucket to start from. Out: the first non-empty bucket.
+         * @return false If every ring and overflow list is empty.
+         */
+        bool findBucket(std::size_t& current) {
+            std::size_t ringSize = m_locals[0].ring.size();
+            while (true) {
+                std::size_t overflowMin = NONE;
+                for (const Local& local : m_locals) overflowMin = std::min(overflowMin, local.overflowMin);
+                std::size_t end = std::min(current + ringSize, overflowMin);
+                for (; current < end; ++current) {
+                    for (const Local& local : m_locals) {
+                        if (!local.ring[current % ringSize].empty()) return true;
+                    }
+                }
+                if (overflowMin == NONE) return false;
+                current = overflowMin;
+                refill(current);
+            }
+        }
+
+        /**
+         * @brief Moves every thread's overflow entries that now fall inside the ring into its buckets, dropping stale ones.
+         * * @param current The lowest bucket the ring holds.
+         */
+        void refill(std::size_t current) {
+            m_pool->parallelFor(m_locals.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t t = begin; t < end; ++t) {
+                    Local& local = m_locals[t];
+                    std::size_t ringSize = local.ring.size();
+                    local.overflowMin = NONE;
+                    std::erase_if(local.overflow, [&](const ParkedVertex& parked) {
+                        if (deltaBucket(m_distances[parked.vertex], m_activeDelta) != parked.bucket) return true;
+                        if (parked.bucket - current < ringSize) {
+                            local.ring[parked.bucket % ringSize].push_back(parked.vertex);
+                            return true;
+                        }
+                        local.overflowMin = std::min(local.overflowMin, parked.bucket);
+                        return false;
+                    });
+                }
+            });
+        }
+
+        /**
+         * @brief Empties one bucket through parallel light-edge rounds and heavy-edge passes.
+         * * @param graph The snapshot being searched.
+         * @param current The index of the bucket.
+         */
+        void settleBucket(const Core::CsrGraph<TVertex, TWeight>& graph, std::size_t current) {
+            std::size_t slot = current % m_locals[0].ring.size();
+            while (true) {
+                ++m_pass;
+                while (gather([slot](Local& local) -> std::vector<int>& { return local.ring[slot]; })) {
+                    ++m_round;
+                    m_pool->parallelFor(m_frontier.size(), m_grain, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                        Local& local = m_locals[thread];
+                        for (std::size_t i = begin; i < end; ++i) {
+                            int u = m_frontier[i];
+                            Distance du = std::atomic_ref<Distance>(m_distances[u]).load(std::memory_order_relaxed);
+                            if (deltaBucket(du, m_activeDelta) != current) continue;
+                            if (std::atomic_ref<std::uint32_t>(m_roundStamps[u]).exchange(m_round, std::memory_order_relaxed) == m_round) continue;
+                            if (std::atomic_ref<std::uint32_t>(m_passStamps[u]).exchange(m_pass, std::memory_order_relaxed) != m_pass) {
+                                local.heavy.push_back(u);
+                            }
+                            relaxFrom(graph, local, u, du, true, current);
+                        }
+                    });
+                }
+
+                if (!gather([](Local& local) -> std::vector<int>& { return local.heavy; })) break;
+                m_pool->parallelFor(m_frontier.size(), m_grain, [&](std::size_t begin, std::size_t end, std::size_t thread) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        int u = m_frontier[i];
+                        Distance du = std::atomic_ref<Distance>(m_distances[u]).load(std::memory_order_relaxed);
+                        relaxFrom(graph, m_locals[thread], u, du, false, current);
+                    }
+                });
+            }
+        }
+
+        /**
+         * @brief Relaxes either the light or the heavy out-edges of a vertex.
+         * * @param graph The snapshot being searched.
+         * @param local The calling thread's buckets.
+         * @param u The vertex whose edges are relaxed.
+         * @param du The distance of u.
+         * @param light true for edges lighter than delta, false for the others.
+         * @param current The index of the bucket being settled.
+         */
+        void relaxFrom(const Core::CsrGraph<TVertex, TWeight>& graph, Local& local, int u, Distance du, bool light,
+                       std::size_t current) {
+            std::span<const int> targets = graph.getNeighborSpan(u);
+            std::span<const TWeight> weights = graph.getWeightSpan(u);
+            std::size_t ringSize = local.ring.size();
+            for (std::size_t k = 0; k < targets.size(); ++k) {
+                Distance weight = static_cast<Distance>(weights[k]);
+                if ((weight < m_activeDelta) != light) continue;
+                Distance newDist = du + weight;
+                std::atomic_ref<Distance> slot(m_distances[targets[k]]);
+                Distance seen = slot.load(std::memory_order_relaxed);
+                while (newDist < seen) {
+                    if (slot.compare_exchange_weak(seen, newDist, std::memory_order_relaxed)) {
+                        std::size_t bucket = deltaBucket(newDist, m_activeDelta);
+                        if (bucket - current < ringSize) {
+                            local.ring[bucket % ringSize].push_back(targets[k]);
+                        } else {
+                            local.overflow.push_back({bucket, targets[k]});
+                            local.overflowMin = std::min(local.overflowMin, bucket);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Collects one list of every thread into the frontier and clears the lists.
+         * * Each thread's list is copied in parallel to its offset in the prefix sum of the list sizes.
+         * @param list Maps a thread's Local to the list to collect, such as its share of a bucket.
+         * @return true If the frontier is not empty.
+         */
+        template <typename ListOf>
+        bool gather(ListOf list) {
+            std::size_t total = 0;
+            m_offsets.resize(m_locals.size());
+            for (std::size_t t = 0; t < m_locals.size(); ++t) {
+                m_offsets[t] = total;
+                total += list(m_locals[t]).size();
+            }
+            m_frontier.resize(total);
+            m_pool->parallelFor(m_locals.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t t = begin; t < end; ++t) {
+                    std::vector<int>& entries = list(m_locals[t]);
+                    std::copy(entries.begin(), entries.end(), m_frontier.begin() + m_offsets[t]);
+                    entries.clear();
+                }
+            });
+            return total > 0;
+        }
+
+        Distance m_delta;                         ///< Requested bucket width, 0 to pick one per run.
+        Distance m_activeDelta = 1;               ///< Bucket width of the last run.
+        Core::ThreadPool* m_pool;                 ///< The pool that relaxes the buckets.
+        std::size_t m_grain;                      ///< Vertices per chunk.
+        std::vector<Local> m_locals;              ///< Per-thread buckets and heavy lists.
+        std::vector<std::size_t> m_offsets;       ///< Position of each thread's entries in the frontier.
+        std::vector<int> m_frontier;              ///< The vertices expanded by the current round or pass.
+        std::vector<Distance> m_distances;        ///< Tentative distance of each vertex.
+        std::vector<std::uint32_t> m_roundStamps; ///< Last round that expanded each vertex, so duplicates are skipped.
+        std::vector<std::uint32_t> m_passStamps;  ///< Last pass that listed each vertex for heavy relaxation.
+        std::uint32_t m_round = 0;                ///< Counter of light-edge rounds in the run.
+        std::uint32_t m_pass = 0;                 ///< Counter of heavy-edge passes in the run.
+        std::size_t m_bucketCount = 0;            ///< Non-empty buckets settled by the last run.
+    };
+}
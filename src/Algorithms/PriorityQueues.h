@@ -0,0 +1,553 @@
+/**
+* @file PriorityQueues.h
+ * @brief Vertex priority queues usable by Dijkstra's algorithm.
+ */
+
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <bit>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace Algorithms {
+
+    /**
+     * @brief A vertex with its priority, as returned by the queues' pop().
+     * * @tparam TKey The priority type; smaller keys come out first.
+     */
+    template<typename TKey>
+    struct QueueEntry {
+        TKey key;   ///< The priority (tentative distance) of the vertex.
+        int id;     ///< The ID of the vertex.
+
+        /**
+         * @brief Greater-than comparison on keys, used to build min-heaps with the standard heap algorithms.
+         * * @param other The entry to compare with.
+         * @return true If this key is greater than the other key.
+         */
+        bool operator>(const QueueEntry& other) const { return key > other.key; }
+    };
+
+    /**
+     * @brief Binary min-heap without decrease-key: every improvement pushes a new entry.
+     * * Outdated entries stay in the heap until popped, so the heap may grow to O(E) entries and
+     * the caller must skip entries whose key is larger than the vertex's current distance.
+     * * Queues used by Dijkstra provide Key, reset(vertexCount), empty(), push(id, key) and pop().
+     * @tparam TKey The priority type.
+     */
+    template<typename TKey>
+    class LazyBinaryHeap {
+    public:
+        using Key = TKey;
+        using Entry = QueueEntry<TKey>;
+
+        /**
+         * @brief Empties the queue for a new run.
+         * * @param vertexCount The number of vertex IDs (unused).
+         */
+        void reset(std::size_t vertexCount) { (void)vertexCount; m_heap.clear(); }
+
+        /**
+         * @brief Checks if the queue is empty.
+         * * @return true If no entry is left.
+         */
+        bool empty() const { return m_heap.empty(); }
+
+        /**
+         * @brief Gets the number of stored entries, outdated ones included.
+         * * @return The heap size.
+         */
+        std::size_t size() const { return m_heap.size(); }
+
+        /**
+         * @brief Adds an entry for a vertex, even if it already has one.
+         * * @param id The vertex ID.
+         * @param key Its priority.
+         */
+        void push(int id, TKey key) {
+            m_heap.push_back({key, id});
+            std::push_heap(m_heap.begin(), m_heap.end(), std::greater<Entry>());
+        }
+
+        /**
+         * @brief Removes and returns the entry with the smallest key. The queue must not be empty.
+         * * @return The popped entry, possibly outdated.
+         */
+        Entry pop() {
+            std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<Entry>());
+            Entry top = m_heap.back();
+            m_heap.pop_back();
+            return top;
+        }
+
+        /**
+         * @brief Estimates the heap memory held by the queue.
+         * * @return The bytes of capacity of the entry array.
+         */
+        std::size_t getMemoryFootprint() const { return m_heap.capacity() * sizeof(Entry); }
+
+    private:
+        std::vector<Entry> m_heap;     ///< Min-heap ordered by std::greater; reused between runs.
+    };
+
+    /**
+     * @brief Indexed d-ary min-heap with true decrease-key.
+     * * Each vertex appears at most once: a position map from vertex ID to heap slot lets push() lower
+     * the key of a queued vertex in place, so the heap never holds more than V entries and pops are
+     * never outdated. A wider node (D = 4 by default) makes the tree shallower, which shortens the
+     * sift-up of decrease-key, and keeps the children of a node in one or two cache lines.
+     * * reset() only clears the positions of the entries still queued, so a run that stops early costs
+     * nothing proportional to the graph size.
+     * @tparam TKey The priority type.
+     * @tparam D The number of children per node, at least 2.
+     */
+    template<typename TKey, unsigned D = 4>
+    class IndexedDaryHeap {
+        static_assert(D >= 2, "A heap node needs at least two children");
+
+    public:
+        using Key = TKey;
+        using Entry = QueueEntry<TKey>;
+
+        /**
+         * @brief Empties the queue for a new run.
+         * * @param vertexCount The number of vertex IDs; the position map grows to it if needed.
+         */
+        void reset(std::size_t vertexCount) {
+            for (const Entry& entry : m_heap) m_positions[entry.id] = NOT_QUEUED;
+            m_heap.clear();
+            if (vertexCount > m_positions.size()) m_positions.resize(vertexCount, NOT_QUEUED);
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         * * @return true If no vertex is queued.
+         */
+        bool empty() const { return m_heap.empty(); }
+
+        /**
+         * @brief Gets the number of queued vertices.
+         * * @return The heap size, at most the vertex count.
+         */
+        std::size_t size() const { return m_heap.size(); }
+
+        /**
+         * @brief Checks if a vertex is queued.
+         * * @param id The vertex ID, below the count given to reset().
+         * @return true If the vertex is in the heap.
+         */
+        bool contains(int id) const { return m_positions[id] != NOT_QUEUED; }
+
+        /**
+         * @brief Queues a vertex, or lowers its key if it is already queued with a larger one.
+         * * @param id The vertex ID, below the count given to reset().
+         * @param key Its priority.
+         */
+        void push(int id, TKey key) {
+            std::uint32_t pos = m_positions[id];
+            if (pos == NOT_QUEUED) {
+                m_heap.push_back({key, id});
+                siftUp(m_heap.size() - 1, {key, id});
+            } else if (key < m_heap[pos].key) {
+                siftUp(pos, {key, id});
+            }
+        }
+
+        /**
+         * @brief Removes and returns the vertex with the smallest key. The queue must not be empty.
+         * * @return The popped entry.
+         */
+        Entry pop() {
+            Entry top = m_heap.front();
+            m_positions[top.id] = NOT_QUEUED;
+            Entry last = m_heap.back();
+            m_heap.pop_back();
+            if (!m_heap.empty()) siftDown(0, last);
+            return top;
+        }
+
+        /**
+         * @brief Estimates the heap memory held by the queue.
+         * * @return The bytes of capacity of the entry array and the position map.
+         */
+        std::size_t getMemoryFootprint() const {
+            return m_heap.capacity() * sizeof(Entry) + m_positions.capacity() * sizeof(std::uint32_t);
+        }
+
+    private:
+        static constexpr std::uint32_t NOT_QUEUED = UINT32_MAX;  ///< Position of a vertex outside the heap.
+
+        /**
+         * @brief Moves an entry up from a slot until its parent is not larger, then stores it.
+         * * @param pos The slot to start from; its current content is overwritten.
+         * @param entry The entry to place.
+         */
+        void siftUp(std::size_t pos, Entry entry) {
+            while (pos > 0) {
+                std::size_t parent = (pos - 1) / D;
+                if (!(entry.key < m_heap[parent].key)) break;
+                place(pos, m_heap[parent]);
+                pos = parent;
+            }
+            place(pos, entry);
+        }
+
+        /**
+         * @brief Moves an entry down from a slot until no child is smaller, then stores it.
+         * * @param pos The slot to start from; its current content is overwritten.
+         * @param entry The entry to place.
+         */
+        void siftDown(std::size_t pos, Entry entry) {
+            std::size_t count = m_heap.size();
+            while (true) {
+                std::size_t first = pos * D + 1;
+                if (first >= count) break;
+                std::size_t last = std::min(first + D, count);
+                std::size_t best = first;
+                for (std::size_t child = first + 1; child < last; ++child) {
+                    if (m_heap[child].key < m_heap[best].key) best = child;
+                }
+                if (!(m_heap[best].key < entry.key)) break;
+                place(pos, m_heap[best]);
+                pos = best;
+            }
+            place(pos, entry);
+        }
+
+        /**
+         * @brief Stores an entry in a slot and records its position.
+         * * @param pos The slot.
+         * @param entry The entry.
+         */
+        void place(std::size_t pos, const Entry& entry) {
+            m_heap[pos] = entry;
+            m_positions[entry.id] = static_cast<std::uint32_t>(pos);
+        }
+
+        std::vector<Entry> m_heap;              ///< The d-ary heap, at most one entry per vertex.
+        std::vector<std::uint32_t> m_positions; ///< Slot of each vertex in m_heap, or NOT_QUEUED.
+    };
+
+    /**
+     * @brief Dial's bucket queue for monotone integer keys.
+     * * Vertex IDs sit in a circular array of buckets indexed by key modulo the ring size. Dijkstra pops keys
+     * in non-decreasing order and never pushes a key more than the largest edge weight C above the last
+     * popped one, so once the ring has more than C buckets each bucket holds a single key and pop() only
+     * scans forward. The ring starts small and doubles whenever a key lands beyond it, moving each bucket
+     * whole, so C does not have to be known in advance. Like LazyBinaryHeap it keeps outdated entries,
+     * which the caller skips.
+     * * Pushed keys must not be negative nor smaller than the last popped key. The ring spans the keys from
+     * the last popped one, so a run should start near 0, as Dijkstra's does.
+     * @tparam TKey The integral priority type.
+     */
+    template<typename TKey>
+    class DialQueue {
+        static_assert(std::is_integral_v<TKey>, "Bucket queues need integer keys");
+
+    public:
+        using Key = TKey;
+        using Entry = QueueEntry<TKey>;
+
+        /**
+         * @brief Empties the queue for a new run, keeping the ring and the bucket capacities.
+         * * @param vertexCount The number of vertex IDs (unused).
+         */
+        void reset(std::size_t vertexCount) {
+            (void)vertexCount;
+            if (m_size > 0) {
+                for (std::vector<int>& bucket : m_buckets) bucket.clear();
+            }
+            m_size = 0;
+            m_cursorKey = 0;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         * * @return true If no entry is left.
+         */
+        bool empty() const { return m_size == 0; }
+
+        /**
+         * @brief Gets the number of stored entries, outdated ones included.
+         * * @return The entry count.
+         */
+        std::size_t size() const { return m_size; }
+
+        /**
+         * @brief Gets the number of buckets a key needs the ring to have.
+         * * @param key A key about to be pushed.
+         * @return The distance from the smallest key that may still be queued to @p key, plus one, or
+         * SIZE_MAX if @p key is below it.
+         */
+        std::size_t getSpan(TKey key) const {
+            if (key < m_cursorKey) return std::numeric_limits<std::size_t>::max();
+            return static_cast<std::size_t>(key - m_cursorKey) + 1;
+        }
+
+        /**
+         * @brief Gets the current number of buckets of the ring.
+         * * @return A power of two, or 0 before the first push.
+         */
+        std::size_t getBucketCount() const { return m_buckets.size(); }
+
+        /**
+         * @brief Adds an entry for a vertex, even if it already has one.
+         * * @param id The vertex ID.
+         * @param key Its priority, not below the last popped key.
+         */
+        void push(int id, TKey key) {
+            std::size_t span = getSpan(key);
+            if (span > m_buckets.size()) grow(span);
+            m_buckets[slot(key)].push_back(id);
+            ++m_size;
+        }
+
+        /**
+         * @brief Removes and returns an entry with the smallest key. The queue must not be empty.
+         * * @return The popped entry, possibly outdated.
+         */
+        Entry pop() {
+            while (m_buckets[slot(m_cursorKey)].empty()) ++m_cursorKey;
+            std::vector<int>& bucket = m_buckets[slot(m_cursorKey)];
+            int id = bucket.back();
+            bucket.pop_back();
+            --m_size;
+            return {m_cursorKey, id};
+        }
+
+        /**
+         * @brief Estimates the heap memory held by the queue.
+         * * @return The bytes of the ring and of the capacity of every bucket.
+         */
+        std::size_t getMemoryFootprint() const {
+            std::size_t bytes = m_buckets.capacity() * sizeof(std::vector<int>);
+            for (const std::vector<int>& bucket : m_buckets) bytes += bucket.capacity() * sizeof(int);
+            return bytes;
+        }
+
+    private:
+        static constexpr std::size_t MIN_BUCKETS = 64;  ///< Ring size allocated by the first push.
+
+        /**
+         * @brief Maps a key to its bucket.
+         * * @param key The key.
+         * @return The bucket index, the key modulo the ring size.
+         */
+        std::size_t slot(TKey key) const { return static_cast<std::size_t>(key) & (m_buckets.size() - 1); }
+
+        /**
+         * @brief Enlarges the ring to a power of two of at least @p span buckets and moves the queued buckets.
+         * * All IDs of a bucket share one key, so each non-empty bucket moves as a whole.
+         * @param span The number of buckets needed.
+         */
+        void grow(std::size_t span) {
+            std::size_t count = std::max(MIN_BUCKETS, m_buckets.size() * 2);
+            while (count < span) count *= 2;
+            std::vector<std::vector<int>> ring(count);
+            std::size_t oldCount = m_buckets.size();
+            std::size_t start = m_buckets.empty() ? 0 : slot(m_cursorKey);
+            for (std::size_t offset = 0; offset < oldCount; ++offset) {
+                std::vector<int>& bucket = m_buckets[(start + offset) & (oldCount - 1)];
+                TKey key = m_cursorKey + static_cast<TKey>(offset);
+                ring[static_cast<std::size_t>(key) & (count - 1)] = std::move(bucket);
+            }
+            m_buckets = std::move(ring);
+        }
+
+        std::vector<std::vector<int>> m_buckets;  ///< The ring of buckets; its size is 0 or a power of two.
+        std::size_t m_size = 0;                   ///< Number of entries, outdated ones included.
+        TKey m_cursorKey = 0;                     ///< Smallest key that may still be queued: the last popped one, or 0.
+    };
+
+    /**
+     * @brief Radix heap for monotone integer keys.
+     * * Entries are kept in one bucket per bit position: an entry lands in the bucket given by the
+     * highest bit in which its key differs from the last popped key. When the lowest bucket is empty,
+     * pop() takes the minimum of the next non-empty bucket as the new reference and redistributes that
+     * bucket into lower ones, so every entry moves down at most once per bit of the key and a pop costs
+     * O(log C) amortised for a largest edge weight C, however large C is. Outdated entries are kept.
+     * * Pushed keys must not be smaller than the last popped key, and must not be negative.
+     * @tparam TKey The integral priority type.
+     */
+    template<typename TKey>
+    class RadixHeap {
+        static_assert(std::is_integral_v<TKey>, "Radix heaps need integer keys");
+
+    public:
+        using Key = TKey;
+        using Entry = QueueEntry<TKey>;
+
+        /**
+         * @brief Empties the queue for a new run, keeping the bucket capacities.
+         * * @param vertexCount The number of vertex IDs (unused).
+         */
+        void reset(std::size_t vertexCount) {
+            (void)vertexCount;
+            if (m_size > 0) {
+                for (std::vector<Entry>& bucket : m_buckets) bucket.clear();
+            }
+            m_size = 0;
+            m_last = 0;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         * * @return true If no entry is left.
+         */
+        bool empty() const { return m_size == 0; }
+
+        /**
+         * @brief Gets the number of stored entries, outdated ones included.
+         * * @return The entry count.
+         */
+        std::size_t size() const { return m_size; }
+
+        /**
+         * @brief Adds an entry for a vertex, even if it already has one.
+         * * @param id The vertex ID.
+         * @param key Its priority, not below the last popped key.
+         */
+        void push(int id, TKey key) {
+            m_buckets[bucketOf(key)].push_back({key, id});
+            ++m_size;
+        }
+
+        /**
+         * @brief Removes and returns an entry with the smallest key. The queue must not be empty.
+         * * @return The popped entry, possibly outdated.
+         */
+        Entry pop() {
+            if (m_buckets[0].empty()) {
+                std::size_t index = 1;
+                while (m_buckets[index].empty()) ++index;
+                std::vector<Entry>& bucket = m_buckets[index];
+                m_last = std::min_element(bucket.begin(), bucket.end(),
+                                          [](const Entry& a, const Entry& b) { return a.key < b.key; })->key;
+                for (const Entry& entry : bucket) m_buckets[bucketOf(entry.key)].push_back(entry);
+                bucket.clear();
+            }
+            Entry top = m_buckets[0].back();
+            m_buckets[0].pop_back();
+            --m_size;
+            return top;
+        }
+
+        /**
+         * @brief Estimates the heap memory held by the queue.
+         * * @return The bytes of capacity of every bucket.
+         */
+        std::size_t getMemoryFootprint() const {
+            std::size_t bytes = 0;
+            for (const std::vector<Entry>& bucket : m_buckets) bytes += bucket.capacity() * sizeof(Entry);
+            return bytes;
+        }
+
+    private:
+        using Bits = std::make_unsigned_t<TKey>;
+        static constexpr std::size_t BUCKETS = std::numeric_limits<Bits>::digits + 1;  ///< One per bit, plus the last key's.
+
+        /**
+         * @brief Finds the bucket of a key relative to the last popped key.
+         * * @param key The key.
+         * @return The bit width of the key XOR the last popped key: 0 for an equal key.
+         */
+        std::size_t bucketOf(TKey key) const {
+            return static_cast<std::size_t>(std::bit_width(static_cast<Bits>(key) ^ static_cast<Bits>(m_last)));
+        }
+
+        std::vector<Entry> m_buckets[BUCKETS];  ///< Entries by highest bit differing from m_last.
+        std::size_t m_size = 0;                 ///< Number of entries, outdated ones included.
+        TKey m_last = 0;                        ///< The last popped key, or 0 at the start of a run.
+    };
+
+    /**
+     * @brief Bucket queue for integer-weighted Dijkstra that picks Dial's queue or a radix heap by itself.
+     * * A run starts on a DialQueue, which is the fastest choice while edge weights are small. If a push
+     * would need a ring of more than MaxBuckets buckets, meaning some edge weight is at least that large,
+     * the queued entries move to a RadixHeap, whose cost does not depend on the weights, for the rest of
+     * the run. reset() returns to Dial's queue.
+     * @tparam TKey The integral priority type.
+     * @tparam MaxBuckets The largest ring Dial's queue may use.
+     */
+    template<typename TKey, std::size_t MaxBuckets = (1u << 16)>
+    class MonotoneIntegerQueue {
+    public:
+        using Key = TKey;
+        using Entry = QueueEntry<TKey>;
+
+        /**
+         * @brief Empties the queue for a new run and selects Dial's queue.
+         * * @param vertexCount The number of vertex IDs.
+         */
+        void reset(std::size_t vertexCount) {
+            m_dial.reset(vertexCount);
+            m_radix.reset(vertexCount);
+            m_useRadix = false;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         * * @return true If no entry is left.
+         */
+        bool empty() const { return m_useRadix ? m_radix.empty() : m_dial.empty(); }
+
+        /**
+         * @brief Gets the number of stored entries, outdated ones included.
+         * * @return The entry count of the active queue.
+         */
+        std::size_t size() const { return m_useRadix ? m_radix.size() : m_dial.size(); }
+
+        /**
+         * @brief Checks which queue the current run uses.
+         * * @return true If the run has switched to the radix heap.
+         */
+        bool usesRadixHeap() const { return m_useRadix; }
+
+        /**
+         * @brief Adds an entry for a vertex, switching to the radix heap if the key is too far ahead.
+         * * @param id The vertex ID.
+         * @param key Its priority, not below the last popped key.
+         */
+        void push(int id, TKey key) {
+            if (!m_useRadix && m_dial.getSpan(key) > MaxBuckets) {
+                while (!m_dial.empty()) {
+                    Entry entry = m_dial.pop();
+                    m_radix.push(entry.id, entry.key);
+                }
+                m_useRadix = true;
+            }
+            if (m_useRadix) m_radix.push(id, key);
+            else m_dial.push(id, key);
+        }
+
+        /**
+         * @brief Removes and returns an entry with the smallest key. The queue must not be empty.
+         * * @return The popped entry, possibly outdated.
+         */
+        Entry pop() { return m_useRadix ? m_radix.pop() : m_dial.pop(); }
+
+        /**
+         * @brief Estimates the heap memory held by the queue.
+         * * @return The bytes held by both queues.
+         */
+        std::size_t getMemoryFootprint() const { return m_dial.getMemoryFootprint() + m_radix.getMemoryFootprint(); }
+
+    private:
+        DialQueue<TKey> m_dial;   ///< Queue used while the keys stay within MaxBuckets of each other.
+        RadixHeap<TKey> m_radix;  ///< Queue used for the rest of a run once they do not.
+        bool m_useRadix = false;  ///< True once the current run has switched to the radix heap.
+    };
+
+    /**
+     * @brief The queue Dijkstra uses by default for a distance type.
+     * * Integer distances get the bucket queues, floating-point ones the indexed 4-ary heap.
+     * @tparam TKey The distance type.
+     */
+    template<typename TKey>
+    using DefaultDistanceQueue = std::conditional_t<std::is_integral_v<TKey>, MonotoneIntegerQueue<TKey>,
+                                                    IndexedDaryHeap<TKey>>;
+}
\ No newline at end of file
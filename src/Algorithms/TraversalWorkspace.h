@@ -0,0 +1,123 @@
+/**
+* @file TraversalWorkspace.h
+ * @brief Per-vertex scratch state of graph searches, reset in O(1) between runs.
+ */
+
+#pragma once
+#include "WeightTraits.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace Algorithms {
+
+    /**
+     * @brief Reusable visited flags, tentative distances and predecessors for graph searches.
+     * * Instead of clearing its arrays before each run, the workspace keeps a generation stamp per vertex
+     * and a current epoch: a vertex counts as reached only if its stamp equals the epoch, and its
+     * distance and predecessor are initialised on that first touch. reset() therefore just increments the
+     * epoch, so the cost of a search depends on the vertices it reaches, not on the size of the graph.
+     * The arrays only grow, and are cleared once every 2^32 - 1 resets when the epoch wraps around.
+     * * A workspace may be shared by several algorithm objects, one run at a time.
+     * @tparam TWeight The arithmetic type of edge weights, which determines the distance type.
+     */
+    template<typename TWeight = double>
+    class TraversalWorkspace {
+    public:
+        using Traits = Core::WeightTraits<TWeight>;
+        using Distance = typename Traits::Distance;
+
+        /**
+         * @brief Starts a new run: every vertex becomes unreached.
+         * * @param vertexCount The number of vertex IDs of the graph; the arrays grow to it if needed.
+         */
+        void reset(std::size_t vertexCount) {
+            if (vertexCount > m_stamps.size()) {
+                m_stamps.resize(vertexCount, 0);
+                m_distances.resize(vertexCount);
+                m_previous.resize(vertexCount);
+            }
+            if (++m_epoch == 0) {
+                std::fill(m_stamps.begin(), m_stamps.end(), 0);
+                m_epoch = 1;
+            }
+            m_reached = 0;
+        }
+
+        /**
+         * @brief Checks if a vertex has been reached in the current run.
+         * * @param id The vertex ID, below the count given to reset().
+         * @return true If reach() or setDistance() was called for it since the last reset().
+         */
+        bool isReached(int id) const { return m_stamps[id] == m_epoch; }
+
+        /**
+         * @brief Marks a vertex as reached, with an infinite distance and no predecessor.
+         * * @param id The vertex ID.
+         * @return true If the vertex had not been reached yet.
+         */
+        bool reach(int id) {
+            if (isReached(id)) return false;
+            m_stamps[id] = m_epoch;
+            m_distances[id] = Traits::infinity();
+            m_previous[id] = -1;
+            ++m_reached;
+            return true;
+        }
+
+        /**
+         * @brief Gets the tentative distance of a vertex.
+         * * @param id The vertex ID.
+         * @return The distance set in this run, or infinity if the vertex has not been reached.
+         */
+        Distance getDistance(int id) const { return isReached(id) ? m_distances[id] : Traits::infinity(); }
+
+        /**
+         * @brief Gets the predecessor of a vertex.
+         * * @param id The vertex ID.
+         * @return The predecessor set in this run, or -1.
+         */
+        int getPrevious(int id) const { return isReached(id) ? m_previous[id] : -1; }
+
+        /**
+         * @brief Reaches a vertex if needed and records its distance and predecessor.
+         * * @param id The vertex ID.
+         * @param distance The new tentative distance.
+         * @param previous The predecessor on the path, or -1.
+         */
+        void setDistance(int id, Distance distance, int previous) {
+            reach(id);
+            m_distances[id] = distance;
+            m_previous[id] = previous;
+        }
+
+        /**
+         * @brief Gets the number of vertices reached in the current run.
+         * * @return The count of distinct vertices touched since the last reset().
+         */
+        std::size_t getReachedCount() const { return m_reached; }
+
+        /**
+         * @brief Gets the current epoch, mostly useful to observe resets.
+         * * @return The stamp given to vertices reached in the current run.
+         */
+        std::uint32_t getEpoch() const { return m_epoch; }
+
+        /**
+         * @brief Estimates the heap memory held by the workspace.
+         * * @return The bytes of capacity of its arrays.
+         */
+        std::size_t getMemoryFootprint() const {
+            return m_stamps.capacity() * sizeof(std::uint32_t) + m_distances.capacity() * sizeof(Distance)
+                 + m_previous.capacity() * sizeof(int);
+        }
+
+    private:
+        std::vector<std::uint32_t> m_stamps;   ///< Epoch in which each vertex was last reached.
+        std::vector<Distance> m_distances;     ///< Tentative distances, valid only for reached vertices.
+        std::vector<int> m_previous;           ///< Predecessors, valid only for reached vertices.
+        std::uint32_t m_epoch = 0;             ///< Stamp of the current run; 0 is never a valid epoch.
+        std::size_t m_reached = 0;             ///< Number of vertices reached in the current run.
+    };
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file AStarBenchmark.cpp
+ * @brief Compares Dijkstra's algorithm with A* guided by layout coordinates.
+ *
+ * Standalone program. Answers random start/target queries on a random geometric graph (each vertex joined
+ * to its nearest neighbours, weighted by their Euclidean distance) and on a grid with random weights
+ * (both frozen as CsrGraph), with Dijkstra and with A* using the consistently scaled Euclidean and
+ * Manhattan heuristics, and reports the average number of expanded vertices and the time per query.
+ * Usage: AStarBenchmark [queries]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Dijkstra.h"
+#include "AStar.h"
+#include "BenchmarkGraphs.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Builds a random geometric graph in the unit square and freezes it.
+ * * Points are bucketed into cells so that the nearest neighbours are searched among nearby cells only.
+ * @param vertices The number of vertices.
+ * @param neighbours The number of nearest neighbours each vertex is joined to.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGeometric(int vertices, int neighbours) {
+    AdjacencyList<Vertex> graph(false, true);
+    std::mt19937 rng(19);
+    std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+    graph.addVertices(vertices);
+
+    int cells = std::max(1, static_cast<int>(std::sqrt(vertices / 4.0)));
+    std::vector<std::vector<int>> grid(cells * cells);
+    auto cellOf = [&](double c) { return std::min(cells - 1, static_cast<int>(c * cells)); };
+    for (int id = 0; id < vertices; ++id) {
+        graph.getVertex(id)->setPosition(coordinate(rng), coordinate(rng));
+        grid[cellOf(graph.getVertex(id)->getY()) * cells + cellOf(graph.getVertex(id)->getX())].push_back(id);
+    }
+
+    std::vector<std::pair<double, int>> candidates;
+    for (int id = 0; id < vertices; ++id) {
+        const Vertex* v = graph.getVertex(id);
+        int row = cellOf(v->getY()), col = cellOf(v->getX());
+        candidates.clear();
+        for (int r = std::max(0, row - 2); r <= std::min(cells - 1, row + 2); ++r) {
+            for (int c = std::max(0, col - 2); c <= std::min(cells - 1, col + 2); ++c) {
+                for (int other : grid[r * cells + c]) {
+                    if (other != id) candidates.emplace_back(layoutDistance(v, graph.getVertex(other), HeuristicMetric::Euclidean), other);
+                }
+            }
+        }
+        int count = std::min<int>(neighbours, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+        for (int i = 0; i < count; ++i) {
+            if (!graph.hasEdge(id, candidates[i].second)) graph.addEdge(id, candidates[i].second, candidates[i].first);
+        }
+    }
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Builds an undirected side x side grid with random weights of at least 1 and freezes it.
+ * @param side The number of vertices per row and column.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGrid(int side) {
+    AdjacencyList<Vertex> graph(false, true);
+    fillGrid(graph, side, 17, std::uniform_real_distribution<double>(1.0, 2.0));
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Times point-to-point queries with one algorithm.
+ * @tparam TAlgorithm The search to run.
+ * @param label The row label.
+ * @param algorithm The configured search.
+ * @param graph The graph to search.
+ * @param queries The start/target pairs.
+ */
+template <typename TAlgorithm>
+static void measure(const char* label, TAlgorithm& algorithm, const CsrGraph<Vertex>& graph,
+                    const std::vector<std::pair<int, int>>& queries) {
+    long long expanded = 0;
+    auto count = [&](const AlgorithmEvent& e) { expanded += e.type == EventType::Visiting; };
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& [start, target] : queries) algorithm.run(&graph, start, target, count);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-24s %12.0f expanded   %9.3f ms/query\n", label,
+                static_cast<double>(expanded) / queries.size(), ms / queries.size());
+}
+
+/**
+ * @brief Runs Dijkstra and both A* heuristics on the same random queries of one graph.
+ * @param title The graph description.
+ * @param graph The graph to search.
+ * @param count The number of queries.
+ */
+static void compare(const char* title, const CsrGraph<Vertex>& graph, int count) {
+    std::printf("%s: %d vertices, %zu edges\n", title, graph.getVertexCount(), graph.getEdgeCount());
+    std::mt19937 rng(29);
+    std::uniform_int_distribution<int> pick(0, graph.getVertexCount() - 1);
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < count; ++i) queries.emplace_back(pick(rng), pick(rng));
+
+    Dijkstra<Vertex> dijkstra;
+    measure("dijkstra", dijkstra, graph, queries);
+    for (HeuristicMetric metric : {HeuristicMetric::Euclidean, HeuristicMetric::Manhattan}) {
+        AStar<Vertex> astar(makeCoordinateHeuristic(metric, consistentScale(graph, metric)));
+        measure(metric == HeuristicMetric::Euclidean ? "a* euclidean" : "a* manhattan", astar, graph, queries);
+    }
+}
+
+int main(int argc, char** argv) {
+    int queries = argc > 1 ? std::atoi(argv[1]) : 50;
+    compare("random geometric", buildGeometric(200000, 6), queries);
+    compare("grid", buildGrid(700), queries);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ * @file BenchmarkGraphs.h
+ * @brief Seeded graph generators shared by the benchmark programs.
+ */
+
+#pragma once
+#include <random>
+
+/**
+ * @brief Fills a graph with edges between uniformly random vertices.
+ * @param graph The graph to fill.
+ * @param vertices The number of vertices.
+ * @param edges The number of edge insertions.
+ * @param seed The random seed.
+ * @param weight A distribution, or any callable taking the std::mt19937, that draws each edge weight.
+ */
+template <typename TGraph, typename WeightFn>
+void fillRandom(TGraph& graph, int vertices, long long edges, unsigned seed, WeightFn weight) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    graph.addVertices(vertices);
+    for (long long i = 0; i < edges; ++i) {
+        int from = pick(rng);
+        int to = pick(rng);
+        graph.addEdge(from, to, weight(rng));
+    }
+}
+
+/**
+ * @brief Fills a graph with a side x side grid of positioned vertices joined to their right and lower neighbours.
+ * * Vertex row * side + col is placed at (col, row), so neighbours are one unit apart.
+ * @param graph The graph to fill.
+ * @param side The number of vertices per row and column.
+ * @param seed The random seed.
+ * @param weight A distribution, or any callable taking the std::mt19937, that draws each edge weight.
+ */
+template <typename TGraph, typename WeightFn>
+void fillGrid(TGraph& graph, int side, unsigned seed, WeightFn weight) {
+    std::mt19937 rng(seed);
+    graph.addVertices(side * side);
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            int id = row * side + col;
+            graph.getVertex(id)->setPosition(col, row);
+            if (col + 1 < side) graph.addEdge(id, id + 1, weight(rng));
+            if (row + 1 < side) graph.addEdge(id, id + side, weight(rng));
+        }
+    }
+}
+
+/**
+ * @brief Draws the unit weight, for unweighted graphs.
+ * @return 1.
+ */
+inline int unitWeight(std::mt19937&) {
+    return 1;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file BidirectionalSearchBenchmark.cpp
+ * @brief Compares one-sided and bidirectional point-to-point searches.
+ *
+ * Standalone program. Answers random start/target queries on a sparse random directed graph and on a
+ * road-like grid (both frozen as CsrGraph) with BFS, Dijkstra and their bidirectional variants, and
+ * reports the average number of expanded vertices and the time per query.
+ * Usage: BidirectionalSearchBenchmark [queries]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "BFS.h"
+#include "Dijkstra.h"
+#include "BidirectionalBFS.h"
+#include "BidirectionalDijkstra.h"
+#include "BenchmarkGraphs.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Builds a random directed weighted graph and freezes it.
+ * @param vertices The number of vertices.
+ * @param edges The number of edges.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildRandom(int vertices, int edges) {
+    AdjacencyList<Vertex> graph(true, true);
+    fillRandom(graph, vertices, edges, 13, std::uniform_real_distribution<double>(1.0, 100.0));
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Builds an undirected side x side grid with random weights and freezes it.
+ * @param side The number of vertices per row and column.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGrid(int side) {
+    AdjacencyList<Vertex> graph(false, true);
+    fillGrid(graph, side, 17, std::uniform_real_distribution<double>(1.0, 10.0));
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Times point-to-point queries with one algorithm.
+ * @tparam TAlgorithm The search to run.
+ * @param label The row label.
+ * @param graph The graph to search.
+ * @param queries The start/target pairs.
+ */
+template <typename TAlgorithm>
+static void measure(const char* label, const CsrGraph<Vertex>& graph, const std::vector<std::pair<int, int>>& queries) {
+    TAlgorithm algorithm;
+    long long expanded = 0;
+    auto count = [&](const AlgorithmEvent& e) { expanded += e.type == EventType::Visiting; };
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& [start, target] : queries) algorithm.run(&graph, start, target, count);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-24s %12.0f expanded   %9.3f ms/query\n", label,
+                static_cast<double>(expanded) / queries.size(), ms / queries.size());
+}
+
+/**
+ * @brief Runs every algorithm on the same random queries of one graph.
+ * @param title The graph description.
+ * @param graph The graph to search.
+ * @param count The number of queries.
+ */
+static void compare(const char* title, const CsrGraph<Vertex>& graph, int count) {
+    std::printf("%s: %d vertices, %zu edges\n", title, graph.getVertexCount(), graph.getEdgeCount());
+    std::mt19937 rng(29);
+    std::uniform_int_distribution<int> pick(0, graph.getVertexCount() - 1);
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < count; ++i) queries.emplace_back(pick(rng), pick(rng));
+
+    measure<BFS<Vertex>>("bfs", graph, queries);
+    measure<BidirectionalBFS<Vertex>>("bidirectional bfs", graph, queries);
+    measure<Dijkstra<Vertex>>("dijkstra", graph, queries);
+    measure<BidirectionalDijkstra<Vertex>>("bidirectional dijkstra", graph, queries);
+}
+
+int main(int argc, char** argv) {
+    int queries = argc > 1 ? std::atoi(argv[1]) : 50;
+    compare("sparse random", buildRandom(1000000, 4000000), queries);
+    compare("grid", buildGrid(1000), queries);
+    return 0;
+}
\ No newline at end of file
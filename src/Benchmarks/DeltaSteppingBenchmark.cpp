@@ -0,0 +1,82 @@
+/**
+ * @file DeltaSteppingBenchmark.cpp
+ * @brief Compares Dijkstra with sequential and parallel delta-stepping for several bucket widths.
+ *
+ * Standalone program. Builds a directed random graph with uniform integer weights in [1, 1000] as doubles,
+ * frozen as CsrGraph, and computes the distances from random start vertices with Dijkstra, with
+ * DeltaStepping and with ParallelDeltaStepping on pools of 1, 2, 4, ... threads up to the hardware
+ * concurrency. Reports the time per search, the buckets and parallel rounds, and checks every distance.
+ * Usage: DeltaSteppingBenchmark [vertices] [edges per vertex] [searches]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "BenchmarkGraphs.h"
+#include "Dijkstra.h"
+#include "DeltaStepping.h"
+#include "ParallelDeltaStepping.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? std::atoi(argv[2]) : 16;
+    int searches = argc > 3 ? std::atoi(argv[3]) : 4;
+
+    AdjacencyList<Vertex> graph(true, true);
+    fillRandom(graph, vertices, static_cast<long long>(degree) * vertices, 53, std::uniform_int_distribution<int>(1, 1000));
+    CsrGraph<Vertex> csr(graph);
+    std::printf("%d vertices, %zu edges\n", csr.getVertexCount(), csr.getEdgeCount());
+
+    std::mt19937 rng(59);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    std::vector<int> starts;
+    for (int i = 0; i < searches; ++i) starts.push_back(pick(rng));
+
+    Dijkstra<Vertex> dijkstra;
+    std::vector<std::vector<double>> expected;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int start : starts) {
+        dijkstra.run(&csr, start);
+        std::vector<double> distances(csr.getVertexCount());
+        for (int v = 0; v < csr.getVertexCount(); ++v) distances[v] = dijkstra.getWorkspace().getDistance(v);
+        expected.push_back(std::move(distances));
+    }
+    double base = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / searches;
+    std::printf("  %-26s %9.2f ms/search\n", "dijkstra", base);
+
+    DeltaStepping<Vertex> sequential;
+    t0 = std::chrono::steady_clock::now();
+    for (int start : starts) sequential.run(&csr, start);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / searches;
+    std::printf("  %-26s %9.2f ms/search   delta %.1f, %zu buckets\n", "delta-stepping", ms,
+                sequential.getDelta(), sequential.getBucketCount());
+
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (double scale : {0.25, 1.0, 4.0}) {
+        double delta = sequential.getDelta() * scale;
+        for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+            ThreadPool pool(threads);
+            ParallelDeltaStepping<Vertex> parallel(delta, pool);
+            bool agree = true;
+            t0 = std::chrono::steady_clock::now();
+            for (int i = 0; i < searches; ++i) {
+                parallel.run(csr, starts[i]);
+                agree = agree && parallel.getDistances() == expected[i];
+            }
+            ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / searches;
+            std::printf("  delta %7.1f, %2zu threads  %9.2f ms/search   %5.2fx   %zu rounds   distances %s\n", delta, threads,
+                        ms, base / ms, parallel.getRoundCount(), agree ? "agree" : "DIFFER");
+        }
+    }
+    return 0;
+}
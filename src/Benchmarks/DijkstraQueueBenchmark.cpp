@@ -0,0 +1,73 @@
+/**
+ * @file DijkstraQueueBenchmark.cpp
+ * @brief Compares Dijkstra's algorithm over the available priority queues.
+ *
+ * Standalone program. Runs full single-source searches on a sparse and a dense random weighted graph
+ * (both frozen as CsrGraph) with the lazy binary heap and indexed d-ary heaps for several d, and reports
+ * the time per search and the largest memory the queue held.
+ * Usage: DijkstraQueueBenchmark [repetitions]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Dijkstra.h"
+#include "PriorityQueues.h"
+#include "BenchmarkGraphs.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Builds a random directed weighted graph and freezes it.
+ * @param vertices The number of vertices.
+ * @param edges The number of edges.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGraph(int vertices, int edges) {
+    AdjacencyList<Vertex> graph(true, true);
+    fillRandom(graph, vertices, edges, 13, std::uniform_real_distribution<double>(1.0, 100.0));
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Times full searches from vertex 0 with one queue type.
+ * @tparam TQueue The priority queue given to Dijkstra.
+ * @param label The row label.
+ * @param graph The graph to search.
+ * @param repetitions The number of measured searches.
+ */
+template <typename TQueue>
+static void measure(const char* label, const CsrGraph<Vertex>& graph, int repetitions) {
+    Dijkstra<Vertex, double, TQueue> dijkstra;
+    dijkstra.run(&graph, 0);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) dijkstra.run(&graph, i % graph.getVertexCount());
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-16s %9.2f ms/search   queue %8.2f MiB\n", label, ms / repetitions,
+                dijkstra.getQueueMemoryFootprint() / 1048576.0);
+}
+
+/**
+ * @brief Runs every queue variant on one graph.
+ * @param title The graph description.
+ * @param graph The graph to search.
+ * @param repetitions The number of measured searches per variant.
+ */
+static void compare(const char* title, const CsrGraph<Vertex>& graph, int repetitions) {
+    std::printf("%s: %d vertices, %zu edges\n", title, graph.getVertexCount(), graph.getEdgeCount());
+    measure<LazyBinaryHeap<double>>("lazy binary", graph, repetitions);
+    measure<IndexedDaryHeap<double, 2>>("indexed 2-ary", graph, repetitions);
+    measure<IndexedDaryHeap<double, 4>>("indexed 4-ary", graph, repetitions);
+    measure<IndexedDaryHeap<double, 8>>("indexed 8-ary", graph, repetitions);
+}
+
+int main(int argc, char** argv) {
+    int repetitions = argc > 1 ? std::atoi(argv[1]) : 5;
+    compare("sparse", buildGraph(1000000, 4000000), repetitions);
+    compare("dense", buildGraph(5000, 5000000), repetitions);
+    return 0;
+}
\ No newline at end of file
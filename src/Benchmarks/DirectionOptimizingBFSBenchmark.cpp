@@ -0,0 +1,106 @@
+/**
+ * @file DirectionOptimizingBFSBenchmark.cpp
+ * @brief Compares top-down, bottom-up and direction-optimizing breadth-first search.
+ *
+ * Standalone program. Builds an R-MAT graph (skewed degrees and a small diameter, like social networks)
+ * and a grid (large diameter), frozen as CsrGraph, runs full searches from random start vertices with
+ * Algorithms::BFS and with each DirectionOptimizingBFS strategy, and reports the edges inspected and the
+ * time per search.
+ * Usage: DirectionOptimizingBFSBenchmark [scale] [searches]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "BFS.h"
+#include "DirectionOptimizingBFS.h"
+#include "BenchmarkGraphs.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Builds an undirected R-MAT graph with 2^scale vertices and 16 edges per vertex and freezes it.
+ * @param scale The base-2 logarithm of the vertex count.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildRmat(int scale) {
+    AdjacencyList<Vertex> graph(false, false);
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    int vertices = 1 << scale;
+    graph.addVertices(vertices);
+    for (long long i = 0; i < 16LL * vertices; ++i) {
+        int from = 0, to = 0;
+        for (int bit = 0; bit < scale; ++bit) {
+            double r = coin(rng);
+            int row = r >= 0.57 + 0.19;
+            int col = (r >= 0.57 && r < 0.76) || r >= 0.95;
+            from |= row << bit;
+            to |= col << bit;
+        }
+        if (from != to) graph.addEdge(from, to);
+    }
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Builds an undirected side x side grid and freezes it.
+ * @param side The number of vertices per row and column.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGrid(int side) {
+    AdjacencyList<Vertex> graph(false, false);
+    fillGrid(graph, side, 0, unitWeight);
+    return CsrGraph<Vertex>(graph);
+}
+
+/**
+ * @brief Runs every strategy from the same start vertices of one graph.
+ * @param title The graph description.
+ * @param graph The graph to search.
+ * @param searches The number of start vertices.
+ */
+static void compare(const char* title, const CsrGraph<Vertex>& graph, int searches) {
+    std::printf("%s: %d vertices, %zu edges\n", title, graph.getVertexCount(), graph.getEdgeCount());
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int> pick(0, graph.getVertexCount() - 1);
+    std::vector<int> starts;
+    while (static_cast<int>(starts.size()) < searches) {
+        int start = pick(rng);
+        if (!graph.getNeighborSpan(start).empty()) starts.push_back(start);
+    }
+
+    BFS<Vertex> reference;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int start : starts) reference.run(&graph, start);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-12s %14s   %9.2f ms/search\n", "bfs", "", ms / searches);
+
+    struct Strategy { const char* label; BfsDirection direction; };
+    for (Strategy strategy : {Strategy{"top-down", BfsDirection::TopDown}, Strategy{"bottom-up", BfsDirection::BottomUp},
+                              Strategy{"adaptive", BfsDirection::Adaptive}}) {
+        DirectionOptimizingBFS<Vertex> bfs(strategy.direction);
+        std::size_t inspected = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (int start : starts) {
+            bfs.run(graph, start);
+            inspected += bfs.getEdgesInspected();
+        }
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        std::printf("  %-12s %14.0f edges   %9.2f ms/search   %d levels, %d bottom-up\n", strategy.label,
+                    static_cast<double>(inspected) / searches, ms / searches, bfs.getLevelCount(), bfs.getBottomUpLevels());
+    }
+}
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? std::atoi(argv[1]) : 18;
+    int searches = argc > 2 ? std::atoi(argv[2]) : 8;
+    compare("r-mat", buildRmat(scale), searches);
+    compare("grid", buildGrid(512), searches);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file FloydWarshallBenchmark.cpp
+ * @brief Compares Dijkstra from every vertex, plain Floyd-Warshall and blocked Floyd-Warshall for all-pairs distances.
+ *
+ * Standalone program. Builds a directed random AdjacencyMatrix with uniform integer weights in [1, 1000] as
+ * doubles and computes every distance three ways: Dijkstra from each vertex over a CsrGraph snapshot, the
+ * textbook triple loop with next hops over a copy of the matrix, and FloydWarshall on pools of 1, 2, 4, ... threads up to the
+ * hardware concurrency. Reports the time of each and checks the distances, then times path queries.
+ * The vector kernel is used when the CPU supports AVX2; no build flag is needed.
+ * Usage: FloydWarshallBenchmark [vertices] [edges per vertex]
+ */
+
+#include "AdjacencyMatrix.h"
+#include "CsrGraph.h"
+#include "BenchmarkGraphs.h"
+#include "Dijkstra.h"
+#include "FloydWarshall.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int degree = argc > 2 ? std::atoi(argv[2]) : 16;
+
+    AdjacencyMatrix<Vertex, Directed, Weighted> graph;
+    graph.reserve(vertices);
+    fillRandom(graph, vertices, static_cast<long long>(degree) * vertices, 61, std::uniform_int_distribution<int>(1, 1000));
+    CsrGraph<Vertex> csr(graph);
+    std::printf("%d vertices, %zu edges\n", csr.getVertexCount(), csr.getEdgeCount());
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::size_t n = static_cast<std::size_t>(vertices);
+    std::vector<double> expected(n * n);
+    Dijkstra<Vertex> dijkstra;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int from = 0; from < vertices; ++from) {
+        dijkstra.run(&csr, from);
+        for (int to = 0; to < vertices; ++to) expected[from * n + to] = dijkstra.getWorkspace().getDistance(to);
+    }
+    double dijkstraMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-24s %10.1f ms\n", "dijkstra x V", dijkstraMs);
+
+    std::vector<double> plain(n * n, infinity);
+    std::vector<int> next(n * n, -1);
+    for (int from = 0; from < vertices; ++from) {
+        plain[from * n + from] = 0;
+        next[from * n + from] = from;
+        graph.forEachEdgeFrom(from, [&](int to, double w) {
+            if (w < plain[from * n + to]) {
+                plain[from * n + to] = w;
+                next[from * n + to] = to;
+            }
+        });
+    }
+    t0 = std::chrono::steady_clock::now();
+    for (std::size_t k = 0; k < n; ++k) {
+        for (std::size_t i = 0; i < n; ++i) {
+            double toK = plain[i * n + k];
+            if (toK == infinity) continue;
+            for (std::size_t j = 0; j < n; ++j) {
+                double candidate = toK + plain[k * n + j];
+                if (candidate < plain[i * n + j]) {
+                    plain[i * n + j] = candidate;
+                    next[i * n + j] = next[i * n + k];
+                }
+            }
+        }
+    }
+    double plainMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-24s %10.1f ms   %5.2fx   distances %s\n", "plain floyd-warshall", plainMs, dijkstraMs / plainMs,
+                plain == expected ? "agree" : "DIFFER");
+
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool(threads);
+        FloydWarshall<Vertex> blocked(pool);
+        t0 = std::chrono::steady_clock::now();
+        blocked.run(graph);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        bool agree = true;
+        for (int from = 0; from < vertices && agree; ++from) {
+            for (int to = 0; to < vertices; ++to) agree = agree && blocked.getDistance(from, to) == expected[from * n + to];
+        }
+        std::printf("  blocked, %2zu threads     %10.1f ms   %5.2fx   distances %s   %.1f MiB\n", threads, ms,
+                    dijkstraMs / ms, agree ? "agree" : "DIFFER", blocked.getMemoryFootprint() / 1048576.0);
+
+        if (threads * 2 > hardware) {
+            std::size_t hops = 0;
+            std::mt19937 rng(67);
+            std::uniform_int_distribution<int> pick(0, vertices - 1);
+            t0 = std::chrono::steady_clock::now();
+            for (int q = 0; q < 100000; ++q) hops += blocked.getPath(pick(rng), pick(rng)).size();
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / 100000;
+            std::printf("  path query               %10.3f us   %.1f vertices per path\n", us, hops / 100000.0);
+        }
+    }
+    return 0;
+}
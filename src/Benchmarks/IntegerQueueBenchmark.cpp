@@ -0,0 +1,93 @@
+/**
+ * @file IntegerQueueBenchmark.cpp
+ * @brief Compares Dijkstra's algorithm over heaps and bucket queues on integer-weighted graphs.
+ *
+ * Standalone program. Runs full single-source searches on a 4-neighbour grid and on random graphs with
+ * small and large 32-bit weights (all frozen as CsrGraph), with the lazy binary heap (the former
+ * std::priority_queue path), the indexed 4-ary heap, Dial's queue, the radix heap and the automatic
+ * MonotoneIntegerQueue, and reports the time per search and the largest memory the queue held.
+ * Usage: IntegerQueueBenchmark [repetitions]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Dijkstra.h"
+#include "PriorityQueues.h"
+#include "BenchmarkGraphs.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace Core;
+using namespace Algorithms;
+
+using Weight = std::uint32_t;
+using Key = WeightTraits<Weight>::Distance;
+
+/**
+ * @brief Builds a side x side grid whose neighbouring cells are joined by random weights.
+ * @param side The number of vertices per row and column.
+ * @param maxWeight The largest edge weight.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex, Weight> buildGrid(int side, Weight maxWeight) {
+    AdjacencyList<Vertex, Undirected, Weighted, Weight> graph;
+    fillGrid(graph, side, 17, std::uniform_int_distribution<Weight>(1, maxWeight));
+    return CsrGraph<Vertex, Weight>(graph);
+}
+
+/**
+ * @brief Builds a random directed graph with random weights.
+ * @param vertices The number of vertices.
+ * @param edges The number of edges.
+ * @param maxWeight The largest edge weight.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex, Weight> buildRandom(int vertices, int edges, Weight maxWeight) {
+    AdjacencyList<Vertex, Directed, Weighted, Weight> graph;
+    fillRandom(graph, vertices, edges, 13, std::uniform_int_distribution<Weight>(1, maxWeight));
+    return CsrGraph<Vertex, Weight>(graph);
+}
+
+/**
+ * @brief Times full searches with one queue type.
+ * @tparam TQueue The priority queue given to Dijkstra.
+ * @param label The row label.
+ * @param graph The graph to search.
+ * @param repetitions The number of measured searches.
+ */
+template <typename TQueue>
+static void measure(const char* label, const CsrGraph<Vertex, Weight>& graph, int repetitions) {
+    Dijkstra<Vertex, Weight, TQueue> dijkstra;
+    dijkstra.run(&graph, 0);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) dijkstra.run(&graph, (i * 7919) % graph.getVertexCount());
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-16s %9.2f ms/search   queue %8.2f MiB\n", label, ms / repetitions,
+                dijkstra.getQueueMemoryFootprint() / 1048576.0);
+}
+
+/**
+ * @brief Runs every queue variant on one graph.
+ * @param title The graph description.
+ * @param graph The graph to search.
+ * @param repetitions The number of measured searches per variant.
+ */
+static void compare(const char* title, const CsrGraph<Vertex, Weight>& graph, int repetitions) {
+    std::printf("%s: %d vertices, %zu edges\n", title, graph.getVertexCount(), graph.getEdgeCount());
+    measure<LazyBinaryHeap<Key>>("lazy binary", graph, repetitions);
+    measure<IndexedDaryHeap<Key, 4>>("indexed 4-ary", graph, repetitions);
+    measure<DialQueue<Key>>("dial", graph, repetitions);
+    measure<RadixHeap<Key>>("radix", graph, repetitions);
+    measure<MonotoneIntegerQueue<Key>>("automatic", graph, repetitions);
+}
+
+int main(int argc, char** argv) {
+    int repetitions = argc > 1 ? std::atoi(argv[1]) : 5;
+    compare("grid, weights 1-10", buildGrid(1000, 10), repetitions);
+    compare("random, weights 1-100", buildRandom(1000000, 4000000, 100), repetitions);
+    compare("random, weights 1-10^6", buildRandom(1000000, 4000000, 1000000), repetitions);
+    return 0;
+}
\ No newline at end of file
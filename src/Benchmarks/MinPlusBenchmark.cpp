@@ -0,0 +1,122 @@
+/**
+ * @file MinPlusBenchmark.cpp
+ * @brief Measures the min-plus product kernel and the shortest distances computed with it.
+ *
+ * Standalone program. Builds a dense directed random AdjacencyMatrix with uniform integer weights in [1, 1000],
+ * as doubles and as 32-bit integers. Times one min-plus product of the weight matrix with itself, naively
+ * and with MinPlusMatrix::multiply on pools of 1, 2, 4, ... threads up to the hardware concurrency, and
+ * reports the rate of cell updates. Then compares all-pairs distances by repeated squaring with
+ * FloydWarshall and times hop-bounded runs for a few hop limits.
+ * The vector kernels are used when the CPU supports AVX2; no build flag is needed.
+ * Usage: MinPlusBenchmark [vertices] [edge probability in percent]
+ */
+
+#include "AdjacencyMatrix.h"
+#include "FloydWarshall.h"
+#include "MinPlusMatrix.h"
+#include "MinPlusPaths.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Times the product of a graph's weight matrix with itself, naively and with the blocked kernel.
+ * @param graph The graph whose weights are multiplied.
+ * @param label The name of the weight type, for the report.
+ */
+template <typename TWeight>
+static void benchmarkProduct(const AdjacencyMatrix<Vertex, Directed, Weighted, TWeight>& graph, const char* label) {
+    using Paths = MinPlusPaths<Vertex, TWeight>;
+    using Matrix = typename Paths::Matrix;
+    using Element = typename Paths::Element;
+
+    Paths oneHop;
+    oneHop.runBoundedHops(graph, 1);
+    const Matrix& w = oneHop.getMatrix();
+    int n = w.getSize();
+    double updates = static_cast<double>(n) * n * n;
+
+    Matrix naive(n);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        Element* out = naive.getRow(i);
+        for (int k = 0; k < n; ++k) {
+            Element toK = w.get(i, k);
+            if (toK >= Matrix::UNREACHED) continue;
+            const Element* row = w.getRow(k);
+            for (int j = 0; j < n; ++j) out[j] = std::min<Element>(out[j], toK + row[j]);
+        }
+    }
+    double base = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-8s naive product        %9.1f ms   %6.2f G updates/s\n", label, base, updates / base / 1e6);
+
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool(threads);
+        Matrix product;
+        t0 = std::chrono::steady_clock::now();
+        Matrix::multiply(w, w, product, pool);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        std::printf("  %-8s blocked, %2zu threads  %9.1f ms   %6.2f G updates/s   %5.2fx   %s\n", label, threads, ms,
+                    updates / ms / 1e6, base / ms, product == naive ? "agree" : "DIFFER");
+    }
+}
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 1024;
+    int percent = argc > 2 ? std::atoi(argv[2]) : 90;
+
+    AdjacencyMatrix<Vertex, Directed, Weighted> graph;
+    AdjacencyMatrix<Vertex, Directed, Weighted, std::uint32_t> integral;
+    std::mt19937 rng(71);
+    std::uniform_int_distribution<int> weight(1, 1000);
+    graph.reserve(vertices);
+    integral.reserve(vertices);
+    graph.addVertices(vertices);
+    integral.addVertices(vertices);
+    for (int from = 0; from < vertices; ++from) {
+        for (int to = 0; to < vertices; ++to) {
+            if (from == to || static_cast<int>(rng() % 100) >= percent) continue;
+            int w = weight(rng);
+            graph.addEdge(from, to, w);
+            integral.addEdge(from, to, static_cast<std::uint32_t>(w));
+        }
+    }
+    std::printf("%d vertices, %d%% of the pairs linked\n", vertices, percent);
+
+    benchmarkProduct(graph, "double");
+    benchmarkProduct(integral, "uint32");
+
+    FloydWarshall<Vertex> floyd;
+    auto t0 = std::chrono::steady_clock::now();
+    floyd.run(graph);
+    double floydMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  floyd-warshall                  %9.1f ms\n", floydMs);
+
+    MinPlusPaths<Vertex> paths;
+    t0 = std::chrono::steady_clock::now();
+    paths.run(graph);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    bool agree = true;
+    for (int from = 0; from < vertices && agree; ++from) {
+        for (int to = 0; to < vertices; ++to) agree = agree && paths.getDistance(from, to) == floyd.getDistance(from, to);
+    }
+    std::printf("  repeated squaring               %9.1f ms   %zu products   distances %s\n", ms, paths.getProductCount(),
+                agree ? "agree" : "DIFFER");
+
+    for (int hops : {2, 3, 8}) {
+        t0 = std::chrono::steady_clock::now();
+        paths.runBoundedHops(graph, hops);
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        std::printf("  at most %d hops                  %9.1f ms   %zu products\n", hops, ms, paths.getProductCount());
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file MultiSourceBFSBenchmark.cpp
+ * @brief Compares one BFS per source with the 64- and 256-wide multi-source BFS on a batch of sources.
+ *
+ * Standalone program. Builds an undirected small-world graph (a ring lattice with random shortcuts) frozen
+ * as CsrGraph and computes the eccentricity and closeness of a set of random sources, once with a
+ * top-down DirectionOptimizingBFS per source and once with MultiSourceBFS of each width. Reports the
+ * edges scanned and the total time, and checks that the results agree.
+ * Usage: MultiSourceBFSBenchmark [vertices] [sources]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "DirectionOptimizingBFS.h"
+#include "MultiSourceBFS.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Eccentricity and sum of levels of every source.
+ */
+struct Summary {
+    std::vector<int> eccentricity;     ///< Largest level reached from each source.
+    std::vector<long long> levelSum;   ///< Sum of levels from each source; closeness is its inverse.
+
+    bool operator==(const Summary&) const = default;
+};
+
+/**
+ * @brief Runs the multi-source engine of one width and summarizes its levels through the callback.
+ * @param graph The graph to search.
+ * @param sources The start vertices.
+ * @param label The row label.
+ * @param base The time of the per-source searches, in ms.
+ * @param expected The summary of the per-source searches.
+ */
+template <std::size_t Words>
+static void measure(const CsrGraph<Vertex>& graph, const std::vector<int>& sources, const char* label, double base,
+                    const Summary& expected) {
+    MultiSourceBFS<Vertex, double, Words> bfs;
+    Summary summary{std::vector<int>(sources.size(), 0), std::vector<long long>(sources.size(), 0)};
+    auto t0 = std::chrono::steady_clock::now();
+    bfs.run(graph, sources, [&](std::size_t source, int, int level) {
+        summary.eccentricity[source] = std::max(summary.eccentricity[source], level);
+        summary.levelSum[source] += level;
+    });
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-12s %14zu edges   %9.1f ms   %5.2fx   %s\n", label, bfs.getEdgesScanned(), ms, base / ms,
+                summary == expected ? "agree" : "DIFFER");
+}
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int count = argc > 2 ? std::atoi(argv[2]) : 512;
+
+    AdjacencyList<Vertex> graph(false, false);
+    std::mt19937 rng(61);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    graph.addVertices(vertices);
+    for (int v = 0; v < vertices; ++v) {
+        for (int k = 1; k <= 4; ++k) graph.addEdge(v, (v + k) % vertices);
+        graph.addEdge(v, pick(rng));
+    }
+    CsrGraph<Vertex> csr(graph);
+    std::vector<int> sources;
+    for (int i = 0; i < count; ++i) sources.push_back(pick(rng));
+    std::printf("%d vertices, %zu edges, %d sources\n", csr.getVertexCount(), csr.getEdgeCount(), count);
+
+    DirectionOptimizingBFS<Vertex> single(BfsDirection::TopDown);
+    Summary expected{std::vector<int>(sources.size(), 0), std::vector<long long>(sources.size(), 0)};
+    std::size_t scanned = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        single.run(csr, sources[i]);
+        scanned += single.getEdgesInspected();
+        for (int level : single.getLevels()) {
+            if (level < 0) continue;
+            expected.eccentricity[i] = std::max(expected.eccentricity[i], level);
+            expected.levelSum[i] += level;
+        }
+    }
+    double base = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-12s %14zu edges   %9.1f ms\n", "per source", scanned, base);
+
+    measure<1>(csr, sources, "ms-bfs 64", base, expected);
+    measure<4>(csr, sources, "ms-bfs 256", base, expected);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file ParallelBFSBenchmark.cpp
+ * @brief Measures how the parallel level-synchronous BFS scales with the number of threads.
+ *
+ * Standalone program. Builds an undirected random graph frozen as CsrGraph, runs full searches from
+ * random start vertices with the sequential top-down DirectionOptimizingBFS and with ParallelBFS on
+ * pools of 1, 2, 4, ... threads up to the hardware concurrency, checks that the levels agree and
+ * reports the time per search and the speedup over the sequential engine.
+ * Usage: ParallelBFSBenchmark [vertices] [edges per vertex] [searches]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "BenchmarkGraphs.h"
+#include "DirectionOptimizingBFS.h"
+#include "ParallelBFS.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int degree = argc > 2 ? std::atoi(argv[2]) : 16;
+    int searches = argc > 3 ? std::atoi(argv[3]) : 8;
+
+    AdjacencyList<Vertex> graph(false, false);
+    fillRandom(graph, vertices, static_cast<long long>(degree) * vertices / 2, 41, unitWeight);
+    CsrGraph<Vertex> csr(graph);
+    std::printf("%d vertices, %zu edges\n", csr.getVertexCount(), csr.getEdgeCount());
+
+    std::mt19937 rng(43);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    std::vector<int> starts;
+    for (int i = 0; i < searches; ++i) starts.push_back(pick(rng));
+
+    DirectionOptimizingBFS<Vertex> sequential(BfsDirection::TopDown);
+    std::vector<std::vector<int>> levels;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int start : starts) {
+        sequential.run(csr, start);
+        levels.push_back(sequential.getLevels());
+    }
+    double base = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / searches;
+    std::printf("  %-12s %9.2f ms/search\n", "sequential", base);
+
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        ThreadPool pool(threads);
+        ParallelBFS<Vertex> bfs(pool);
+        bool agree = true;
+        t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < searches; ++i) {
+            bfs.run(csr, starts[i]);
+            agree = agree && bfs.getLevels() == levels[i];
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / searches;
+        std::printf("  %2zu threads   %9.2f ms/search   %5.2fx   levels %s\n", threads, ms, base / ms, agree ? "agree" : "DIFFER");
+    }
+    return 0;
+}
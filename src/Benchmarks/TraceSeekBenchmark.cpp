@@ -0,0 +1,83 @@
+/**
+ * @file TraceSeekBenchmark.cpp
+ * @brief Measures the memory of a recorded algorithm trace and the latency of seeking through it.
+ *
+ * Standalone program. Records a Dijkstra run on a random graph through AlgorithmController,
+ * then reports the time to the first frame and to the full trace, the trace footprint next to
+ * what one full AlgoState per step would take, and the average and worst latency of sequential
+ * steps and random seeks.
+ */
+
+#include "AdjacencyList.h"
+#include "BenchmarkGraphs.h"
+#include "AlgorithmController.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Prints latency statistics of a series of operations.
+ * @param label The row label.
+ * @param samples The latencies in microseconds.
+ */
+static void report(const char* label, std::vector<double>& samples) {
+    double total = 0.0;
+    for (double s : samples) total += s;
+    std::sort(samples.begin(), samples.end());
+    std::printf("  %-16s avg %9.2f us   p99 %9.2f us   max %9.2f us\n", label, total / samples.size(),
+                samples[samples.size() * 99 / 100], samples.back());
+}
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 50000;
+    int edges = argc > 2 ? std::atoi(argv[2]) : 200000;
+    int seeks = argc > 3 ? std::atoi(argv[3]) : 2000;
+
+    AdjacencyList<Vertex> graph(true, true);
+    fillRandom(graph, vertices, edges, 42, std::uniform_real_distribution<double>(1.0, 10.0));
+
+    AlgorithmController<Vertex> controller;
+    controller.setAlgorithm(AlgorithmType::Dijkstra);
+    controller.setGraph(&graph);
+    AlgoState state;
+
+    auto t0 = std::chrono::steady_clock::now();
+    controller.start(0, -1, state);
+    auto t1 = std::chrono::steady_clock::now();
+    controller.runToEnd();
+    auto t2 = std::chrono::steady_clock::now();
+
+    int steps = controller.getStepCount();
+    const AlgorithmTrace& trace = controller.getTrace();
+    double fullCopies = static_cast<double>(steps) * vertices * sizeof(double);
+    std::printf("%d vertices, %d steps, first frame in %.3f ms, all recorded in %.1f ms\n", vertices, steps,
+                std::chrono::duration<double, std::milli>(t1 - t0).count(),
+                std::chrono::duration<double, std::milli>(t2 - t0).count());
+    std::printf("  trace            %9.2f MiB in %zu keyframes (full copies would need >= %.1f GiB)\n",
+                trace.getMemoryFootprint() / 1048576.0, trace.getKeyframeCount(), fullCopies / 1073741824.0);
+
+    std::vector<double> forward;
+    for (int i = 0; i < std::min(steps - 1, seeks); ++i) {
+        auto s0 = std::chrono::steady_clock::now();
+        controller.nextStep(state);
+        forward.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - s0).count());
+    }
+    if (!forward.empty()) report("nextStep", forward);
+
+    std::vector<double> random;
+    std::mt19937 rng(43);
+    std::uniform_int_distribution<int> step(0, steps - 1);
+    for (int i = 0; i < seeks; ++i) {
+        int target = step(rng);
+        auto s0 = std::chrono::steady_clock::now();
+        controller.seek(target, state);
+        random.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - s0).count());
+    }
+    report("random seek", random);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @file TraversalAllocationBenchmark.cpp
+ * @brief Counts heap allocations and time per traversal for every graph representation.
+ *
+ * Standalone program (it replaces the global operator new, so it must not be linked into the GUI).
+ * Each algorithm is run once to warm up its reusable buffers, then measured; the
+ * "vector API" row repeats the traversal through getNeighbors()/getEdgesFrom() for comparison, and the
+ * "BFS events"/"BFS erased" rows count the typed events through a static and a type-erased sink.
+ */
+
+#include "AdjacencyList.h"
+#include "AdjacencyMatrix.h"
+#include "CsrGraph.h"
+#include "BFS.h"
+#include "DFS.h"
+#include "Dijkstra.h"
+#include "BenchmarkGraphs.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+static std::atomic<std::size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Reference BFS through the allocating vector API, as the algorithms worked before the visitor API.
+ * @param graph The graph to traverse.
+ * @param start The start vertex ID.
+ */
+static void vectorApiBfs(const Graph<Vertex>& graph, int start) {
+    std::vector<bool> visited(graph.getVertexCount(), false);
+    std::vector<int> queue{start};
+    visited[start] = true;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        for (int n : graph.getNeighbors(queue[head])) {
+            if (!visited[n]) { visited[n] = true; queue.push_back(n); }
+        }
+    }
+}
+
+/**
+ * @brief Runs a measurement and prints its allocation count and wall time.
+ * @param label The row label.
+ * @param fn The work to measure.
+ */
+template <typename Fn>
+static void measure(const char* label, Fn&& fn) {
+    std::size_t before = g_allocations.load();
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    std::printf("  %-12s %10zu allocations %10.2f ms\n", label, g_allocations.load() - before,
+                std::chrono::duration<double, std::milli>(t1 - t0).count());
+}
+
+/**
+ * @brief Measures all traversals on one representation.
+ * @param name The representation name.
+ * @param graph The graph to traverse.
+ */
+static void benchmark(const char* name, const Graph<Vertex>& graph) {
+    BFS<Vertex> bfs;
+    DFS<Vertex> dfs;
+    Dijkstra<Vertex> dijkstra;
+    bfs.run(&graph, 0);
+    dfs.run(&graph, 0);
+    dijkstra.run(&graph, 0);
+
+    std::printf("%s\n", name);
+    measure("BFS", [&] { bfs.run(&graph, 0); });
+    measure("DFS", [&] { dfs.run(&graph, 0); });
+    measure("Dijkstra", [&] { dijkstra.run(&graph, 0); });
+    measure("vector API", [&] { vectorApiBfs(graph, 0); });
+
+    std::size_t events = 0;
+    auto count = [&](const AlgorithmEvent&) { ++events; };
+    measure("BFS events", [&] { bfs.run(&graph, 0, -1, count); });
+    measure("BFS erased", [&] { static_cast<Algorithm<Vertex>&>(bfs).run(&graph, 0, -1, count); });
+    std::printf("  %-12s %10zu\n", "events", events);
+}
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int edges = argc > 2 ? std::atoi(argv[2]) : 200000;
+
+    AdjacencyList<Vertex> list(true, true);
+    fillRandom(list, vertices, edges, 42, std::uniform_real_distribution<double>(1.0, 10.0));
+    benchmark("AdjacencyList", list);
+    benchmark("CsrGraph", CsrGraph<Vertex>(list));
+
+    AdjacencyMatrix<Vertex> matrix(true, true);
+    fillRandom(matrix, vertices / 4, edges / 4, 42, std::uniform_real_distribution<double>(1.0, 10.0));
+    benchmark("AdjacencyMatrix", matrix);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/**
+ * @file WorkspaceQueryBenchmark.cpp
+ * @brief Measures many short point-to-point queries on a large graph with and without a reused workspace.
+ *
+ * Standalone program. Builds a random sparse graph as a CsrGraph and answers Dijkstra and BFS queries
+ * between vertices a few hops apart. The "fresh" rows construct a new algorithm per query, paying for
+ * O(V) per-vertex arrays each time; the "shared" rows reuse one TraversalWorkspace, whose reset is O(1),
+ * so their cost follows the explored region only.
+ * Usage: WorkspaceQueryBenchmark [vertices] [edges] [queries]
+ */
+
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "BFS.h"
+#include "Dijkstra.h"
+#include "TraversalWorkspace.h"
+#include "BenchmarkGraphs.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Times a sequence of queries.
+ * @param label The row label.
+ * @param queries The (start, end) pairs.
+ * @param query Function answering one query and returning the number of reached vertices.
+ */
+template <typename Query>
+static void measure(const char* label, const std::vector<std::pair<int, int>>& queries, Query query) {
+    std::size_t reached = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& [from, to] : queries) reached += query(from, to);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("  %-18s %10.2f us/query   %8.1f vertices reached/query\n", label, us / queries.size(),
+                static_cast<double>(reached) / queries.size());
+}
+
+/**
+ * @brief Builds a random directed weighted graph and freezes it.
+ * @param vertices The number of vertices.
+ * @param edges The number of edges.
+ * @return The CSR snapshot of the graph.
+ */
+static CsrGraph<Vertex> buildGraph(int vertices, int edges) {
+    AdjacencyList<Vertex> graph(true, true);
+    fillRandom(graph, vertices, edges, 7, std::uniform_real_distribution<double>(1.0, 10.0));
+    return CsrGraph<Vertex>(graph);
+}
+
+int main(int argc, char** argv) {
+    int vertices = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int edges = argc > 2 ? std::atoi(argv[2]) : 3000000;
+    int count = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    CsrGraph<Vertex> graph = buildGraph(vertices, edges);
+    const CsrGraph<Vertex>* csr = &graph;
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, vertices - 1);
+    std::vector<std::pair<int, int>> queries;
+    while (static_cast<int>(queries.size()) < count) {
+        int from = pick(rng);
+        int to = from;
+        for (int hop = 0; hop < 3; ++hop) {
+            auto next = csr->getNeighborSpan(to);
+            if (next.empty()) break;
+            to = next[rng() % next.size()];
+        }
+        if (to != from) queries.emplace_back(from, to);
+    }
+
+    std::printf("%d vertices, %zu edges, %d queries 3 hops apart\n", vertices, csr->getEdgeCount(), count);
+
+    measure("Dijkstra fresh", queries, [&](int from, int to) {
+        Dijkstra<Vertex> dijkstra;
+        dijkstra.run(csr, from, to);
+        return dijkstra.getWorkspace().getReachedCount();
+    });
+
+    TraversalWorkspace<double> workspace;
+    measure("Dijkstra shared", queries, [&](int from, int to) {
+        Dijkstra<Vertex> dijkstra;
+        dijkstra.setWorkspace(&workspace);
+        dijkstra.run(csr, from, to);
+        return workspace.getReachedCount();
+    });
+
+    measure("BFS fresh", queries, [&](int from, int to) {
+        BFS<Vertex> bfs;
+        bfs.run(csr, from, to);
+        return bfs.getWorkspace().getReachedCount();
+    });
+
+    BFS<Vertex> bfs;
+    bfs.setWorkspace(&workspace);
+    measure("BFS shared", queries, [&](int from, int to) {
+        bfs.run(csr, from, to);
+        return workspace.getReachedCount();
+    });
+    return 0;
+}
\ No newline at end of file
@@ -5,39 +5,139 @@
 
 #pragma once
 #include "Graph.h"
+#include "GraphNotifier.h"
+#include "EdgeIndex.h"
+#include "GraphPolicies.h"
 #include <vector>
-#include <list>
 #include <stack>
 #include <algorithm>
 #include <string>
+#include <limits>
+#include <cstddef>
 
 namespace Core {
 
+/**
+ * @brief Result of reclaiming inactive (tombstoned) edges from an AdjacencyList.
+ */
+struct CompactionStats {
+    std::size_t removedEdges = 0;    ///< Number of inactive edges erased from the edge arrays.
+    std::size_t compactedBytes = 0;  ///< Bytes of edge slots vacated by the erased edges, kept as spare row capacity.
+    std::size_t reclaimedBytes = 0;  ///< Bytes of edge storage actually released to the allocator.
+};
+
+/**
+ * @brief Outgoing edge as stored in an AdjacencyList row.
+ * * The source is implied by the row. A removed edge keeps its slot until the row is compacted
+ * and is marked by storing the bitwise complement of its destination, so no separate flag is needed.
+ * @tparam TWeight The arithmetic type of the edge weight.
+ * @tparam HasWeight True if the entry carries a weight.
+ */
+template <typename TWeight, bool HasWeight>
+struct AdjacencyEntry {
+    TWeight m_weight;       ///< The weight of the edge.
+    int m_destination;      ///< The destination vertex ID, negative once the edge is removed.
+
+    /**
+     * @brief Constructs an active entry.
+     * @param destination The destination vertex ID.
+     * @param weight The weight of the edge.
+     */
+    AdjacencyEntry(int destination, TWeight weight) : m_weight(weight), m_destination(destination) {}
+
+    /**
+     * @brief Gets the weight of the edge.
+     * @return The stored weight.
+     */
+    TWeight weight() const { return m_weight; }
+
+    /**
+     * @brief Checks if the edge is active.
+     * @return True until markInactive() is called.
+     */
+    bool isActive() const { return m_destination >= 0; }
+
+    /**
+     * @brief Marks the edge as removed.
+     */
+    void markInactive() { m_destination = ~m_destination; }
+};
+
+/**
+ * @brief Outgoing edge of an unweighted AdjacencyList row: only the destination is stored.
+ */
+template <typename TWeight>
+struct AdjacencyEntry<TWeight, false> {
+    int m_destination;      ///< The destination vertex ID, negative once the edge is removed.
+
+    /**
+     * @brief Constructs an active entry.
+     * @param destination The destination vertex ID.
+     */
+    AdjacencyEntry(int destination, TWeight) : m_destination(destination) {}
+
+    /**
+     * @brief Gets the weight of the edge.
+     * @return Always 1.
+     */
+    TWeight weight() const { return 1; }
+
+    /**
+     * @brief Checks if the edge is active.
+     * @return True until markInactive() is called.
+     */
+    bool isActive() const { return m_destination >= 0; }
+
+    /**
+     * @brief Marks the edge as removed.
+     */
+    void markInactive() { m_destination = ~m_destination; }
+};
+
 /**
  * @brief Graph implementation using an adjacency list.
+ * * Direction and weighting are policies. The defaults (RuntimeDirection, RuntimeWeighted) take them
+ * from the constructor; Directed/Undirected and Weighted/Unweighted fix them at compile time, which
+ * removes the corresponding branches from every operation, and Unweighted rows store 4 bytes per edge.
+ * Weighted rows store sizeof(int) plus the size of TWeight (8 bytes with uint32_t or float weights).
+ * Use makeAdjacencyList() to pick a compile-time variant from runtime settings.
  * @tparam TVertex The type of vertex used in the graph, defaults to Core::Vertex.
+ * @tparam DirectionPolicy Directed, Undirected or RuntimeDirection.
+ * @tparam WeightPolicy Weighted, Unweighted or RuntimeWeighted.
+ * @tparam TWeight The arithmetic type of edge weights, defaults to double.
  */
-template <typename TVertex = Vertex>
-class AdjacencyList : public Graph<TVertex> {
+template <typename TVertex = Vertex, typename DirectionPolicy = RuntimeDirection, typename WeightPolicy = RuntimeWeighted,
+          typename TWeight = double>
+class AdjacencyList : public Graph<TVertex, TWeight> {
 private:
-    bool m_directed;                                      ///< True if the graph is directed.
-    bool m_weighted;                                      ///< True if the graph is weighted.
+    using Base = Graph<TVertex, TWeight>;
+    using EdgeType = BasicEdge<TWeight>;
+    using Entry = AdjacencyEntry<TWeight, WeightPolicy::storesWeights>;
+
+    [[no_unique_address]] DirectionPolicy m_direction;   ///< Whether the graph is directed.
+    [[no_unique_address]] WeightPolicy m_weighting;      ///< Whether the graph is weighted.
     std::vector<std::unique_ptr<TVertex>> m_vertices;     ///< Container for vertices.
-    std::vector<std::list<Edge>> m_adjList;               ///< The adjacency list storing edges for each vertex.
+    std::vector<std::vector<Entry>> m_adjList;            ///< Contiguous per-vertex arrays of outgoing edges.
+    std::vector<std::size_t> m_inactiveCounts;            ///< Number of tombstoned edges in each row of m_adjList.
+    double m_compactionRatio = 0.5;                       ///< Tombstone share of a row above which the row is compacted.
+    bool m_inIndexEnabled = false;                        ///< True if m_inAdj is maintained (directed graphs only).
+    std::vector<std::vector<Entry>> m_inAdj;              ///< Reverse adjacency: source and weight of the active edges entering each vertex.
+    bool m_edgeIndexEnabled = false;                      ///< True if m_edgeIndex is maintained.
+    BasicEdgeIndex<TWeight> m_edgeIndex;                  ///< Hash index of all active edges, keyed on (from, to).
     std::stack<int> m_freeIds;                            ///< Stack of freed IDs ready for reuse.
-    std::vector<GraphObserver*> m_observers;              ///< List of registered graph observers.
+    GraphNotifier m_notifier;                             ///< Registered graph observers and the pending batch.
 
     /**
      * @brief Notifies observers that a vertex was added.
      * @param id The ID of the added vertex.
      */
-    void notifyVertexAdded(int id) { for (auto obs : m_observers) obs->onVertexAdded(id); }
+    void notifyVertexAdded(int id) { m_notifier.vertexAdded(id); }
 
     /**
      * @brief Notifies observers that a vertex was removed.
      * @param id The ID of the removed vertex.
      */
-    void notifyVertexRemoved(int id) { for (auto obs : m_observers) obs->onVertexRemoved(id); }
+    void notifyVertexRemoved(int id) { m_notifier.vertexRemoved(id); }
 
     /**
      * @brief Notifies observers that an edge was added.
@@ -45,26 +145,92 @@ private:
      * @param to The destination vertex ID.
      * @param weight The weight of the edge.
      */
-    void notifyEdgeAdded(int from, int to, double weight) { for (auto obs : m_observers) obs->onEdgeAdded(from, to, weight); }
+    void notifyEdgeAdded(int from, int to, TWeight weight) { m_notifier.edgeAdded(from, to, static_cast<double>(weight)); }
 
     /**
      * @brief Notifies observers that an edge was removed.
      * @param from The source vertex ID.
      * @param to The destination vertex ID.
      */
-    void notifyEdgeRemoved(int from, int to) { for (auto obs : m_observers) obs->onEdgeRemoved(from, to); }
+    void notifyEdgeRemoved(int from, int to) { m_notifier.edgeRemoved(from, to); }
+
+    /**
+     * @brief Deactivates the first active edge from one vertex to another.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @param unindex False if the caller clears the in-edge list of @p to itself.
+     * @return True if an active edge was found and deactivated.
+     */
+    bool deactivateEdge(int from, int to, bool unindex = true) {
+        for (auto& edge : m_adjList[from]) {
+            if (edge.m_destination == to) {
+                edge.markInactive();
+                ++m_inactiveCounts[from];
+                if (unindex && usesInEdgeIndex()) unindexInEdge(from, to);
+                if (m_edgeIndexEnabled) m_edgeIndex.erase(from, to);
+                if (m_inactiveCounts[from] > m_compactionRatio * m_adjList[from].size()) {
+                    compactRow(from);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks if incoming edges are looked up through m_inAdj.
+     * * Undirected graphs store every edge in both rows, so their outgoing rows already are the reverse index.
+     * @return True if the graph is directed and the in-edge index is enabled.
+     */
+    bool usesInEdgeIndex() const { return m_direction.isDirected() && m_inIndexEnabled; }
+
+    /**
+     * @brief Removes one occurrence of a source vertex from the in-edge list of a destination.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     */
+    void unindexInEdge(int from, int to) {
+        auto& sources = m_inAdj[to];
+        auto it = std::find_if(sources.begin(), sources.end(), [from](const Entry& in) { return in.m_destination == from; });
+        if (it != sources.end()) {
+            *it = sources.back();
+            sources.pop_back();
+        }
+    }
+
+    /**
+     * @brief Erases all inactive edges of a single row, keeping the order of the remaining edges.
+     * @param id The ID of the row's source vertex.
+     * @return The number of edges erased.
+     */
+    std::size_t compactRow(int id) {
+        std::size_t removed = std::erase_if(m_adjList[id], [](const Entry& edge) { return !edge.isActive(); });
+        m_inactiveCounts[id] = 0;
+        return removed;
+    }
+
+    /**
+     * @brief Sums the allocated capacity of all edge rows.
+     * @return The number of bytes reserved for edges.
+     */
+    std::size_t edgeCapacityBytes() const {
+        std::size_t bytes = 0;
+        for (const auto& row : m_adjList) bytes += row.capacity() * sizeof(Entry);
+        return bytes;
+    }
 
 public:
     /**
      * @brief Constructor for AdjacencyList.
+     * * The arguments only matter for the runtime policies; compile-time policies ignore them.
      * @param directed True if the graph should be directed (default is true).
      * @param weighted True if the graph edges have weights (default is true).
      */
     explicit AdjacencyList(bool directed = true, bool weighted = true)
-        : m_directed(directed), m_weighted(weighted) {}
+        : m_direction(directed), m_weighting(weighted) {}
 
-    bool isDirected() const override { return m_directed; }
-    bool isWeighted() const override { return m_weighted; }
+    bool isDirected() const override { return m_direction.isDirected(); }
+    bool isWeighted() const override { return m_weighting.isWeighted(); }
 
     bool hasVertex(int id) const override {
         return id >= 0 && id < m_vertices.size() && m_vertices[id] && m_vertices[id]->isActive();
@@ -80,12 +246,16 @@ public:
             vertex->markActive();
             m_vertices[id] = std::move(vertex);
             m_adjList[id].clear();
+            m_inactiveCounts[id] = 0;
+            if (m_inIndexEnabled) m_inAdj[id].clear();
         } else {
             id = static_cast<int>(m_vertices.size());
             vertex->setId(id);
             vertex->markActive();
             m_vertices.push_back(std::move(vertex));
             m_adjList.emplace_back();
+            m_inactiveCounts.push_back(0);
+            if (m_inIndexEnabled) m_inAdj.emplace_back();
         }
 
         if (m_vertices[id]->getName().empty()) {
@@ -100,24 +270,38 @@ public:
         if (!hasVertex(id)) return;
         m_vertices[id]->markInactive();
 
-        std::vector<int> to_remove_out;
+        // Out-edges are dropped in one pass and the row is cleared once, instead of searching it per edge.
         for (const auto& edge : m_adjList[id]) {
-            if (edge.isActive()) to_remove_out.push_back(edge.m_destination);
-        }
-        for (int to_id : to_remove_out) {
-            removeEdge(id, to_id);
+            if (!edge.isActive()) continue;
+            int to_id = edge.m_destination;
+            if (m_edgeIndexEnabled) m_edgeIndex.erase(id, to_id);
+            if (to_id != id && usesInEdgeIndex()) unindexInEdge(id, to_id);
+            notifyEdgeRemoved(id, to_id);
+            if (!m_direction.isDirected() && to_id != id && deactivateEdge(to_id, id)) {
+                notifyEdgeRemoved(to_id, id);
+            }
         }
+        m_adjList[id].clear();
+        m_inactiveCounts[id] = 0;
 
-        for (int i = 0; i < m_adjList.size(); ++i) {
-            if (i == id || !hasVertex(i)) continue;
-            std::vector<int> to_remove_in;
-            for (const auto& edge : m_adjList[i]) {
-                if (edge.m_destination == id && edge.isActive()) {
-                    to_remove_in.push_back(i);
-                }
+        if (usesInEdgeIndex()) {
+            // Unindexing each edge would search the list being emptied, so it is cleared once instead.
+            for (const auto& in : m_inAdj[id]) {
+                if (deactivateEdge(in.m_destination, id, false)) notifyEdgeRemoved(in.m_destination, id);
             }
-            for (int from_id : to_remove_in) {
-                removeEdge(from_id, id);
+            m_inAdj[id].clear();
+        } else if (m_direction.isDirected()) {
+            for (int i = 0; i < static_cast<int>(m_adjList.size()); ++i) {
+                if (i == id || !hasVertex(i)) continue;
+                std::vector<int> to_remove_in;
+                for (const auto& edge : m_adjList[i]) {
+                    if (edge.m_destination == id) {
+                        to_remove_in.push_back(i);
+                    }
+                }
+                for (int from_id : to_remove_in) {
+                    removeEdge(from_id, id);
+                }
             }
         }
 
@@ -125,44 +309,38 @@ public:
         notifyVertexRemoved(id);
     }
 
-    void addEdge(int from, int to, double weight = 1.0) override {
+    void addEdge(int from, int to, TWeight weight = 1) override {
         if (!hasVertex(from) || !hasVertex(to)) return;
         if (hasEdge(from, to)) return;
-        if (!m_weighted) weight = 1.0;
+        if (!m_weighting.isWeighted()) weight = 1;
 
-        m_adjList[from].emplace_back(from, to, weight, true);
+        m_adjList[from].emplace_back(to, weight);
+        if (usesInEdgeIndex()) m_inAdj[to].emplace_back(from, weight);
+        if (m_edgeIndexEnabled) m_edgeIndex.insert(from, to, weight);
         notifyEdgeAdded(from, to, weight);
-        if (!m_directed && from != to) {
-            m_adjList[to].emplace_back(to, from, weight, true);
+        if (!m_direction.isDirected() && from != to) {
+            m_adjList[to].emplace_back(from, weight);
+            if (m_edgeIndexEnabled) m_edgeIndex.insert(to, from, weight);
             notifyEdgeAdded(to, from, weight);
         }
     }
 
+    void addEdges(std::span<const EdgeType> edges) override {
+        reserveEdges(edges.size());
+        beginBatch();
+        for (const auto& edge : edges) AdjacencyList::addEdge(edge.m_source, edge.m_destination, edge.m_weight);
+        endBatch();
+    }
+
     void removeEdge(int from, int to) override {
-        if (from < 0 || from >= m_adjList.size()) return;
+        if (from < 0 || from >= m_adjList.size() || to < 0) return;
 
-        bool removed = false;
-        for (auto& edge : m_adjList[from]) {
-            if (edge.m_destination == to && edge.isActive()) {
-                edge.markInactive();
-                removed = true;
-                break;
-            }
-        }
-        if (removed) {
+        if (deactivateEdge(from, to)) {
             notifyEdgeRemoved(from, to);
         }
 
-        if (!m_directed && from != to && to < m_adjList.size()) {
-            bool removedRev = false;
-            for (auto& edge : m_adjList[to]) {
-                if (edge.m_destination == from && edge.isActive()) {
-                    edge.markInactive();
-                    removedRev = true;
-                    break;
-                }
-            }
-            if (removedRev) {
+        if (!m_direction.isDirected() && from != to && to < m_adjList.size()) {
+            if (deactivateEdge(to, from)) {
                 notifyEdgeRemoved(to, from);
             }
         }
@@ -170,8 +348,9 @@ public:
 
     bool hasEdge(int from, int to) const override {
         if (!hasVertex(from) || !hasVertex(to)) return false;
+        if (m_edgeIndexEnabled) return m_edgeIndex.contains(from, to);
         for (const auto& edge : m_adjList[from]) {
-            if (edge.m_destination == to && edge.isActive()) return true;
+            if (edge.m_destination == to) return true;
         }
         return false;
     }
@@ -194,14 +373,14 @@ public:
         return active;
     }
 
-    std::vector<Edge> getEdges() const override {
-        std::vector<Edge> edges;
+    std::vector<EdgeType> getEdges() const override {
+        std::vector<EdgeType> edges;
         for (int i = 0; i < m_adjList.size(); ++i) {
             if (!hasVertex(i)) continue;
             for (const auto& edge : m_adjList[i]) {
                 if (edge.isActive() && hasVertex(edge.m_destination)) {
-                    if (!m_directed && edge.m_source > edge.m_destination) continue;
-                    edges.push_back(edge);
+                    if (!m_direction.isDirected() && i > edge.m_destination) continue;
+                    edges.emplace_back(i, edge.m_destination, edge.weight());
                 }
             }
         }
@@ -218,36 +397,243 @@ public:
         return neighbors;
     }
 
-    std::vector<Edge> getEdgesFrom(int id) const override {
-        std::vector<Edge> edges;
+    std::vector<EdgeType> getEdgesFrom(int id) const override {
+        std::vector<EdgeType> edges;
         if (hasVertex(id)) {
             for (const auto& edge : m_adjList[id]) {
-                if (edge.isActive() && hasVertex(edge.m_destination)) edges.push_back(edge);
+                if (edge.isActive() && hasVertex(edge.m_destination)) edges.emplace_back(id, edge.m_destination, edge.weight());
             }
         }
         return edges;
     }
 
-    double getEdgeWeight(int from, int to) const override {
-        if (!hasVertex(from) || !hasVertex(to)) return std::numeric_limits<double>::infinity();
+    void forEachNeighbor(int id, FunctionRef<void(int)> visit) const override {
+        if (!hasVertex(id)) return;
+        for (const auto& edge : m_adjList[id]) {
+            if (edge.isActive() && hasVertex(edge.m_destination)) visit(edge.m_destination);
+        }
+    }
+
+    void forEachEdgeFrom(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!hasVertex(id)) return;
+        for (const auto& edge : m_adjList[id]) {
+            if (edge.isActive() && hasVertex(edge.m_destination)) visit(edge.m_destination, edge.weight());
+        }
+    }
+
+    void forEachVertex(FunctionRef<void(const TVertex&)> visit) const override {
+        for (const auto& v : m_vertices) {
+            if (v && v->isActive()) visit(*v);
+        }
+    }
+
+    void forEachEdge(FunctionRef<void(const EdgeType&)> visit) const override {
+        for (int i = 0; i < static_cast<int>(m_adjList.size()); ++i) {
+            if (!hasVertex(i)) continue;
+            for (const auto& edge : m_adjList[i]) {
+                if (edge.isActive() && hasVertex(edge.m_destination)) {
+                    if (!m_direction.isDirected() && i > edge.m_destination) continue;
+                    visit(EdgeType(i, edge.m_destination, edge.weight()));
+                }
+            }
+        }
+    }
+
+    void forEachEdgeTo(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!usesInEdgeIndex()) {
+            Base::forEachEdgeTo(id, visit);
+            return;
+        }
+        if (!hasVertex(id)) return;
+        for (const auto& in : m_inAdj[id]) {
+            if (hasVertex(in.m_destination)) visit(in.m_destination, in.weight());
+        }
+    }
+
+    int getInDegree(int id) const override {
+        if (!hasVertex(id)) return 0;
+        if (!m_direction.isDirected()) return static_cast<int>(m_adjList[id].size() - m_inactiveCounts[id]);
+        if (usesInEdgeIndex()) return static_cast<int>(m_inAdj[id].size());
+        return Base::getInDegree(id);
+    }
+
+    TWeight getEdgeWeight(int from, int to) const override {
+        if (!hasVertex(from) || !hasVertex(to)) return WeightTraits<TWeight>::missing();
+        if (m_edgeIndexEnabled) {
+            const TWeight* weight = m_edgeIndex.find(from, to);
+            return weight ? *weight : TWeight{1};
+        }
         for (const auto& edge : m_adjList[from]) {
-            if (edge.m_destination == to && edge.isActive()) return edge.m_weight;
+            if (edge.m_destination == to) return edge.weight();
         }
-        return 1.0;
+        return 1;
     }
 
     void clear() override {
         m_vertices.clear();
         m_adjList.clear();
+        m_inactiveCounts.clear();
+        m_inAdj.clear();
+        m_edgeIndex.clear();
         while (!m_freeIds.empty()) m_freeIds.pop();
-        for (auto obs : m_observers) obs->onGraphCleared();
+        m_notifier.graphCleared();
     }
 
     int getVertexCount() const override { return m_vertices.size(); }
 
-    void addObserver(GraphObserver* observer) override { if (observer) m_observers.push_back(observer); }
-    void removeObserver(GraphObserver* observer) override {
-        m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+    /**
+     * @brief Enables or disables the reverse (in-edge) index.
+     * * While enabled, removeVertex(), forEachEdgeTo(), getEdgesTo(), getPredecessors() and getInDegree() run in time
+     * proportional to the vertex's in-degree instead of scanning the whole graph, at the cost of one
+     * extra row entry (source and weight) per directed edge. Enabling it builds the index from the current edges in O(V + E).
+     * Undirected graphs answer these queries from their own rows and never need the index.
+     * @param enabled True to build and maintain the index, false to drop it.
+     */
+    void setInEdgeIndexEnabled(bool enabled) {
+        m_inIndexEnabled = enabled;
+        m_inAdj.clear();
+        if (!enabled) {
+            m_inAdj.shrink_to_fit();
+            return;
+        }
+        m_inAdj.resize(m_adjList.size());
+        if (!m_direction.isDirected()) return;
+        for (int i = 0; i < static_cast<int>(m_adjList.size()); ++i) {
+            for (const auto& edge : m_adjList[i]) {
+                if (edge.isActive()) m_inAdj[edge.m_destination].emplace_back(i, edge.weight());
+            }
+        }
     }
+
+    /**
+     * @brief Checks if the reverse (in-edge) index is enabled.
+     * @return True if the index is maintained.
+     */
+    bool isInEdgeIndexEnabled() const { return m_inIndexEnabled; }
+
+    /**
+     * @brief Enables or disables the (from, to) hash index of all edges.
+     * * While enabled, hasEdge(), getEdgeWeight() and the duplicate check in addEdge() take
+     * expected constant time instead of scanning the source vertex's row, which keeps
+     * bulk imports of graphs with high-degree hubs linear. Enabling it indexes the current edges in O(V + E).
+     * @param enabled True to build and maintain the index, false to drop it.
+     */
+    void setEdgeIndexEnabled(bool enabled) {
+        m_edgeIndexEnabled = enabled;
+        m_edgeIndex.clear();
+        if (!enabled) return;
+        for (int i = 0; i < static_cast<int>(m_adjList.size()); ++i) {
+            for (const auto& edge : m_adjList[i]) {
+                if (edge.isActive()) m_edgeIndex.insert(i, edge.m_destination, edge.weight());
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if the (from, to) hash index is enabled.
+     * @return True if the index is maintained.
+     */
+    bool isEdgeIndexEnabled() const { return m_edgeIndexEnabled; }
+
+    /**
+     * @brief Prepares the edge storage for a bulk import.
+     * * Pre-sizes the hash index (when enabled) so that inserting @p edges edges does not rehash.
+     * Undirected edges occupy two index entries.
+     * @param edges The number of edges about to be added.
+     */
+    void reserveEdges(std::size_t edges) {
+        if (m_edgeIndexEnabled) m_edgeIndex.reserve(m_edgeIndex.size() + (m_direction.isDirected() ? edges : 2 * edges));
+    }
+
+    /**
+     * @brief Sets the share of tombstoned edges in a row that triggers automatic compaction.
+     * * After an edge is removed, its row is compacted once the number of inactive edges
+     * exceeds @p ratio times the row length. A ratio of 0 compacts on every removal,
+     * a ratio of 1 or more disables automatic compaction.
+     * @param ratio The new compaction threshold.
+     */
+    void setCompactionRatio(double ratio) { m_compactionRatio = std::max(0.0, ratio); }
+
+    /**
+     * @brief Gets the current automatic compaction threshold.
+     * @return The tombstone ratio set by setCompactionRatio().
+     */
+    double getCompactionRatio() const { return m_compactionRatio; }
+
+    /**
+     * @brief Gets the number of inactive edges still held in the edge arrays.
+     * @return The total tombstone count over all rows.
+     */
+    std::size_t getInactiveEdgeCount() const {
+        std::size_t count = 0;
+        for (std::size_t c : m_inactiveCounts) count += c;
+        return count;
+    }
+
+    /**
+     * @brief Erases every inactive edge, leaving spare row capacity for future insertions.
+     * * No memory is released, so reclaimedBytes is always 0; use shrinkToFit() to give the capacity back.
+     * @return The number of erased edges and the bytes of edge slots they occupied.
+     */
+    CompactionStats compact() {
+        CompactionStats stats;
+        for (int i = 0; i < static_cast<int>(m_adjList.size()); ++i) {
+            if (m_inactiveCounts[i] > 0) stats.removedEdges += compactRow(i);
+        }
+        stats.compactedBytes = stats.removedEdges * sizeof(Entry);
+        return stats;
+    }
+
+    /**
+     * @brief Compacts all rows and releases their unused capacity back to the allocator.
+     * @return The number of erased edges and the bytes of capacity actually released.
+     */
+    CompactionStats shrinkToFit() {
+        std::size_t before = edgeCapacityBytes();
+        CompactionStats stats = compact();
+        for (auto& row : m_adjList) row.shrink_to_fit();
+        stats.reclaimedBytes = before - edgeCapacityBytes();
+        return stats;
+    }
+
+    void addObserver(GraphObserver* observer) override { m_notifier.addObserver(observer); }
+    void removeObserver(GraphObserver* observer) override { m_notifier.removeObserver(observer); }
+
+    void beginBatch() override { m_notifier.beginBatch(); }
+    void endBatch() override { m_notifier.endBatch(); }
 };
+
+/**
+ * @brief Creates an AdjacencyList specialised at compile time for runtime direction and weight settings.
+ * * The returned graph is handled through the Graph interface, so callers such as the GUI can choose
+ * the variant at runtime while the list itself runs with the branches of the chosen policies folded away.
+ * @tparam TVertex The type of vertex used in the graph.
+ * @tparam TWeight The arithmetic type of edge weights.
+ * @param directed True for a Directed list, false for an Undirected one.
+ * @param weighted True for a Weighted list, false for an Unweighted one.
+ * @param configure Generic callable invoked with the concrete list before it is returned,
+ * e.g. to enable its indexes.
+ * @return The new, empty graph.
+ */
+template <typename TVertex = Vertex, typename TWeight = double, typename Configure>
+std::unique_ptr<Graph<TVertex, TWeight>> makeAdjacencyList(bool directed, bool weighted, Configure&& configure) {
+    return dispatchPolicies(directed, weighted, [&]<typename D, typename W>() -> std::unique_ptr<Graph<TVertex, TWeight>> {
+        auto list = std::make_unique<AdjacencyList<TVertex, D, W, TWeight>>();
+        configure(*list);
+        return list;
+    });
+}
+
+/**
+ * @brief Creates an AdjacencyList specialised at compile time for runtime direction and weight settings.
+ * @tparam TVertex The type of vertex used in the graph.
+ * @tparam TWeight The arithmetic type of edge weights.
+ * @param directed True for a Directed list, false for an Undirected one.
+ * @param weighted True for a Weighted list, false for an Unweighted one.
+ * @return The new, empty graph.
+ */
+template <typename TVertex = Vertex, typename TWeight = double>
+std::unique_ptr<Graph<TVertex, TWeight>> makeAdjacencyList(bool directed, bool weighted) {
+    return makeAdjacencyList<TVertex, TWeight>(directed, weighted, [](auto&) {});
+}
 }
\ No newline at end of file
@@ -5,38 +5,65 @@
 
 #pragma once
 #include "Graph.h"
+#include "GraphNotifier.h"
+#include "GraphPolicies.h"
+#include "CpuFeatures.h"
 #include <vector>
 #include <stack>
-#include <optional>
 #include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <span>
 
 namespace Core {
 
 /**
  * @brief Graph implementation using an adjacency matrix.
+ * * Cells live in flat row-major buffers whose side length (the capacity) grows by a quarter
+ * when exceeded, so appending a vertex costs amortized O(N) instead of resizing every row,
+ * and the buffers never exceed about 1.56 times the area actually used.
+ * Edge presence is a bitmap of 64-bit words per row; weights are a dense array
+ * that is only allocated for weighted graphs. Neighbour enumeration ANDs a row
+ * with the active-vertex mask and walks the set bits, 64 columns per word
+ * (256 per step on CPUs with AVX2, detected at runtime).
+ * Direction and weighting are policies, as in AdjacencyList; with compile-time policies the
+ * mirroring and weight branches are resolved when the template is instantiated.
  * @tparam TVertex The type of vertex used in the graph.
+ * @tparam DirectionPolicy Directed, Undirected or RuntimeDirection.
+ * @tparam WeightPolicy Weighted, Unweighted or RuntimeWeighted.
+ * @tparam TWeight The arithmetic type of edge weights, defaults to double.
  */
-template <typename TVertex>
-class AdjacencyMatrix : public Graph<TVertex> {
+template <typename TVertex, typename DirectionPolicy = RuntimeDirection, typename WeightPolicy = RuntimeWeighted,
+          typename TWeight = double>
+class AdjacencyMatrix : public Graph<TVertex, TWeight> {
 private:
-    bool m_directed;                                                 ///< True if the graph is directed.
-    bool m_weighted;                                                 ///< True if the graph is weighted.
+    using Base = Graph<TVertex, TWeight>;
+    using EdgeType = BasicEdge<TWeight>;
+
+    [[no_unique_address]] DirectionPolicy m_direction;              ///< Whether the graph is directed.
+    [[no_unique_address]] WeightPolicy m_weighting;                 ///< Whether the graph is weighted.
     std::vector<std::unique_ptr<TVertex>> m_vertices;                ///< Container for vertices.
-    std::vector<std::vector<std::optional<double>>> m_matrix;        ///< 2D matrix storing edge weights.
+    int m_capacity = 0;                                              ///< Number of rows (and columns) allocated in the buffers.
+    std::size_t m_rowWords = 0;                                      ///< Number of 64-bit words per row of the presence bitmap.
+    std::vector<std::uint64_t> m_present;                            ///< Row-major presence bitmap, bit `to` of row `from` marks an edge.
+    std::vector<TWeight> m_weights;                                  ///< Row-major dense weight matrix, empty for unweighted graphs.
+    std::vector<std::uint64_t> m_activeMask;                         ///< Bitmap of active vertex IDs, m_rowWords words long.
     std::stack<int> m_freeIds;                                       ///< Stack of freed IDs ready for reuse.
-    std::vector<GraphObserver*> m_observers;                         ///< List of registered graph observers.
+    GraphNotifier m_notifier;                                        ///< Registered graph observers and the pending batch.
 
     /**
      * @brief Notifies observers that a vertex was added.
      * @param id The ID of the added vertex.
      */
-    void notifyVertexAdded(int id) { for (auto obs : m_observers) obs->onVertexAdded(id); }
+    void notifyVertexAdded(int id) { m_notifier.vertexAdded(id); }
 
     /**
      * @brief Notifies observers that a vertex was removed.
      * @param id The ID of the removed vertex.
      */
-    void notifyVertexRemoved(int id) { for (auto obs : m_observers) obs->onVertexRemoved(id); }
+    void notifyVertexRemoved(int id) { m_notifier.vertexRemoved(id); }
 
     /**
      * @brief Notifies observers that an edge was added.
@@ -44,31 +71,166 @@ private:
      * @param to The destination vertex ID.
      * @param weight The weight of the edge.
      */
-    void notifyEdgeAdded(int from, int to, double weight) { for (auto obs : m_observers) obs->onEdgeAdded(from, to, weight); }
+    void notifyEdgeAdded(int from, int to, TWeight weight) { m_notifier.edgeAdded(from, to, static_cast<double>(weight)); }
 
     /**
      * @brief Notifies observers that an edge was removed.
      * @param from The source vertex ID.
      * @param to The destination vertex ID.
      */
-    void notifyEdgeRemoved(int from, int to) { for (auto obs : m_observers) obs->onEdgeRemoved(from, to); }
+    void notifyEdgeRemoved(int from, int to) { m_notifier.edgeRemoved(from, to); }
 
     /**
      * @brief Notifies observers that the graph was completely cleared.
      */
-    void notifyGraphCleared() { for (auto obs : m_observers) obs->onGraphCleared(); }
+    void notifyGraphCleared() { m_notifier.graphCleared(); }
+
+    /**
+     * @brief Checks the presence bit of a cell. Both IDs must be below the capacity.
+     * @param from The row (source vertex ID).
+     * @param to The column (destination vertex ID).
+     * @return True if the cell holds an edge.
+     */
+    bool cellPresent(int from, int to) const {
+        return (m_present[from * m_rowWords + (to >> 6)] >> (to & 63)) & 1u;
+    }
+
+    /**
+     * @brief Gets the weight stored in a cell, 1 for unweighted graphs.
+     * @param from The row (source vertex ID).
+     * @param to The column (destination vertex ID).
+     * @return The stored weight.
+     */
+    TWeight cellWeight(int from, int to) const {
+        return m_weighting.isWeighted() ? m_weights[static_cast<std::size_t>(from) * m_capacity + to] : TWeight{1};
+    }
+
+    /**
+     * @brief Stores an edge in a cell.
+     * @param from The row (source vertex ID).
+     * @param to The column (destination vertex ID).
+     * @param weight The weight to store (ignored for unweighted graphs).
+     */
+    void setCell(int from, int to, TWeight weight) {
+        m_present[from * m_rowWords + (to >> 6)] |= std::uint64_t{1} << (to & 63);
+        if (m_weighting.isWeighted()) m_weights[static_cast<std::size_t>(from) * m_capacity + to] = weight;
+    }
+
+    /**
+     * @brief Clears the presence bit of a cell.
+     * @param from The row (source vertex ID).
+     * @param to The column (destination vertex ID).
+     */
+    void clearCell(int from, int to) {
+        m_present[from * m_rowWords + (to >> 6)] &= ~(std::uint64_t{1} << (to & 63));
+    }
+
+    /**
+     * @brief Sets or clears the bit of a vertex in the active-vertex mask.
+     * @param id The vertex ID, below the capacity.
+     * @param active The new state of the bit.
+     */
+    void setActiveBit(int id, bool active) {
+        std::uint64_t bit = std::uint64_t{1} << (id & 63);
+        if (active) m_activeMask[id >> 6] |= bit;
+        else m_activeMask[id >> 6] &= ~bit;
+    }
+
+    /**
+     * @brief Calls a function with the column of every set bit of a word.
+     * @param word The bits to enumerate.
+     * @param base The column of bit 0.
+     * @param visit The function to call with each column.
+     */
+    template <typename Fn>
+    static void forEachBit(std::uint64_t word, int base, Fn& visit) {
+        while (word) {
+            visit(base + std::countr_zero(word));
+            word &= word - 1;
+        }
+    }
+
+    /**
+     * @brief Calls a function with every active neighbour of a vertex, in increasing ID order.
+     * * The row is ANDed with the active-vertex mask one word at a time, or four words
+     * at a time when the CPU supports AVX2, and all-zero blocks are skipped without inspecting their bits.
+     * @param id The row (source vertex ID), below the capacity.
+     * @param visit The function to call with each neighbour ID.
+     */
+    template <typename Fn>
+    void forEachRowNeighbor(int id, Fn&& visit) const {
+        const std::uint64_t* row = m_present.data() + id * m_rowWords;
+        const std::uint64_t* mask = m_activeMask.data();
+        std::size_t w = 0;
+#if CORE_AVX2_KERNELS
+        if (cpuSupportsAvx2()) w = forEachRowNeighborAvx2(row, mask, m_rowWords, visit);
+#endif
+        for (; w < m_rowWords; ++w) {
+            forEachBit(row[w] & mask[w], static_cast<int>(w * 64), visit);
+        }
+    }
+
+#if CORE_AVX2_KERNELS
+    /**
+     * @brief AVX2 part of forEachRowNeighbor(): enumerates whole blocks of four words.
+     * @param row The presence words of the row.
+     * @param mask The active-vertex mask.
+     * @param rowWords The number of words in the row.
+     * @param visit The function to call with each neighbour ID.
+     * @return The number of words handled, a multiple of four.
+     */
+    template <typename Fn>
+    CORE_AVX2_TARGET static std::size_t forEachRowNeighborAvx2(const std::uint64_t* row, const std::uint64_t* mask,
+                                                               std::size_t rowWords, Fn& visit) {
+        std::size_t w = 0;
+        for (; w + 4 <= rowWords; w += 4) {
+            __m256i bits = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + w)),
+                                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask + w)));
+            if (_mm256_testz_si256(bits, bits)) continue;
+            alignas(32) std::uint64_t words[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words), bits);
+            for (int k = 0; k < 4; ++k) forEachBit(words[k], static_cast<int>((w + k) * 64), visit);
+        }
+        return w;
+    }
+#endif
+
+    /**
+     * @brief Reallocates the buffers with a new side length, preserving every stored cell.
+     * @param capacity The new number of rows and columns, at least the current capacity.
+     */
+    void reallocate(int capacity) {
+        std::size_t rowWords = (static_cast<std::size_t>(capacity) + 63) / 64;
+        std::vector<std::uint64_t> present(capacity * rowWords, 0);
+        std::vector<TWeight> weights(m_weighting.isWeighted() ? static_cast<std::size_t>(capacity) * capacity : 0, TWeight{});
+
+        for (int i = 0; i < m_capacity; ++i) {
+            std::copy_n(m_present.begin() + i * m_rowWords, m_rowWords, present.begin() + i * rowWords);
+            if (m_weighting.isWeighted()) {
+                std::copy_n(m_weights.begin() + static_cast<std::size_t>(i) * m_capacity, m_capacity,
+                            weights.begin() + static_cast<std::size_t>(i) * capacity);
+            }
+        }
+
+        m_activeMask.resize(rowWords, 0);
+        m_present = std::move(present);
+        m_weights = std::move(weights);
+        m_rowWords = rowWords;
+        m_capacity = capacity;
+    }
 
 public:
     /**
      * @brief Constructor for AdjacencyMatrix.
+     * * The arguments only matter for the runtime policies; compile-time policies ignore them.
      * @param directed True if the graph should be directed (default is true).
      * @param weighted True if the graph edges have weights (default is true).
      */
     explicit AdjacencyMatrix(bool directed = true, bool weighted = true)
-        : m_directed(directed), m_weighted(weighted) {}
+        : m_direction(directed), m_weighting(weighted) {}
 
-    bool isDirected() const override { return m_directed; }
-    bool isWeighted() const override { return m_weighted; }
+    bool isDirected() const override { return m_direction.isDirected(); }
+    bool isWeighted() const override { return m_weighting.isWeighted(); }
 
     int addVertex(std::unique_ptr<TVertex> vertex) override {
         if (!vertex) return -1;
@@ -79,22 +241,19 @@ public:
             vertex->setId(id);
             vertex->markActive();
             m_vertices[id] = std::move(vertex);
+            setActiveBit(id, true);
 
-            for(int i = 0; i < m_matrix.size(); ++i) {
-                m_matrix[id][i] = std::nullopt;
-                m_matrix[i][id] = std::nullopt;
+            std::fill_n(m_present.begin() + id * m_rowWords, m_rowWords, 0);
+            for (int i = 0; i < static_cast<int>(m_vertices.size()); ++i) {
+                clearCell(i, id);
             }
         } else {
             id = static_cast<int>(m_vertices.size());
+            if (id >= m_capacity) reallocate(std::max(8, m_capacity + m_capacity / 4));
             vertex->setId(id);
             vertex->markActive();
             m_vertices.push_back(std::move(vertex));
-
-            int newSize = m_vertices.size();
-            m_matrix.resize(newSize);
-            for (auto& row : m_matrix) {
-                row.resize(newSize, std::nullopt);
-            }
+            setActiveBit(id, true);
         }
 
         if (m_vertices[id]->getName().empty()) {
@@ -112,41 +271,57 @@ public:
     void removeVertex(int id) override {
         if (!hasVertex(id)) return;
 
-        for (int i = 0; i < m_matrix.size(); ++i) {
-            if (m_matrix[id][i].has_value()) removeEdge(id, i);
-            if (m_matrix[i][id].has_value()) removeEdge(i, id);
+        for (int i = 0; i < static_cast<int>(m_vertices.size()); ++i) {
+            if (cellPresent(id, i)) removeEdge(id, i);
+            if (cellPresent(i, id)) removeEdge(i, id);
         }
 
         m_vertices[id]->markInactive();
+        setActiveBit(id, false);
         m_freeIds.push(id);
         notifyVertexRemoved(id);
     }
 
-    void addEdge(int from, int to, double weight = 1.0) override {
+    void addEdge(int from, int to, TWeight weight = 1) override {
         if (!hasVertex(from) || !hasVertex(to)) return;
-        if (m_matrix[from][to].has_value()) return;
+        if (cellPresent(from, to)) return;
 
-        if (!m_weighted) weight = 1.0;
+        if (!m_weighting.isWeighted()) weight = 1;
 
-        m_matrix[from][to] = weight;
+        setCell(from, to, weight);
         notifyEdgeAdded(from, to, weight);
 
-        if (!m_directed && from != to) {
-            m_matrix[to][from] = weight;
+        if (!m_direction.isDirected() && from != to) {
+            setCell(to, from, weight);
             notifyEdgeAdded(to, from, weight);
         }
     }
 
+    std::vector<int> addVertices(int count) override {
+        if (count < 0) return {};
+        if (m_freeIds.size() < static_cast<std::size_t>(count)) {
+            int needed = static_cast<int>(m_vertices.size() + count - m_freeIds.size());
+            if (needed > m_capacity) reserve(std::max(needed, m_capacity + m_capacity / 4));
+        }
+        return Base::addVertices(count);
+    }
+
+    void addEdges(std::span<const EdgeType> edges) override {
+        beginBatch();
+        for (const auto& edge : edges) AdjacencyMatrix::addEdge(edge.m_source, edge.m_destination, edge.m_weight);
+        endBatch();
+    }
+
     void removeEdge(int from, int to) override {
-        if (from < 0 || from >= m_matrix.size() || to < 0 || to >= m_matrix.size()) return;
+        if (from < 0 || from >= m_vertices.size() || to < 0 || to >= m_vertices.size()) return;
 
-        if (m_matrix[from][to].has_value()) {
-            m_matrix[from][to] = std::nullopt;
+        if (cellPresent(from, to)) {
+            clearCell(from, to);
             notifyEdgeRemoved(from, to);
         }
 
-        if (!m_directed && from != to && m_matrix[to][from].has_value()) {
-            m_matrix[to][from] = std::nullopt;
+        if (!m_direction.isDirected() && from != to && cellPresent(to, from)) {
+            clearCell(to, from);
             notifyEdgeRemoved(to, from);
         }
     }
@@ -169,15 +344,13 @@ public:
         return active;
     }
 
-    std::vector<Edge> getEdges() const override {
-        std::vector<Edge> edges;
-        for (int i = 0; i < m_matrix.size(); ++i) {
+    std::vector<EdgeType> getEdges() const override {
+        std::vector<EdgeType> edges;
+        for (int i = 0; i < static_cast<int>(m_vertices.size()); ++i) {
             if (!hasVertex(i)) continue;
-            for (int j = (m_directed ? 0 : i); j < m_matrix.size(); ++j) {
-                if (hasVertex(j) && m_matrix[i][j].has_value()) {
-                    edges.emplace_back(i, j, m_matrix[i][j].value());
-                }
-            }
+            forEachRowNeighbor(i, [&](int j) {
+                if (m_direction.isDirected() || j >= i) edges.emplace_back(i, j, cellWeight(i, j));
+            });
         }
         return edges;
     }
@@ -185,40 +358,67 @@ public:
     std::vector<int> getNeighbors(int id) const override {
         std::vector<int> neighbors;
         if (hasVertex(id)) {
-            for (int j = 0; j < m_matrix.size(); ++j) {
-                if (hasVertex(j) && m_matrix[id][j].has_value()) {
-                    neighbors.push_back(j);
-                }
-            }
+            forEachRowNeighbor(id, [&](int j) { neighbors.push_back(j); });
         }
         return neighbors;
     }
 
-    std::vector<Edge> getEdgesFrom(int id) const override {
-        std::vector<Edge> edges;
+    std::vector<EdgeType> getEdgesFrom(int id) const override {
+        std::vector<EdgeType> edges;
         if (hasVertex(id)) {
-            for (int j = 0; j < m_matrix.size(); ++j) {
-                if (hasVertex(j) && m_matrix[id][j].has_value()) {
-                    edges.emplace_back(id, j, m_matrix[id][j].value());
-                }
-            }
+            forEachRowNeighbor(id, [&](int j) { edges.emplace_back(id, j, cellWeight(id, j)); });
         }
         return edges;
     }
 
+    void forEachNeighbor(int id, FunctionRef<void(int)> visit) const override {
+        if (hasVertex(id)) forEachRowNeighbor(id, visit);
+    }
+
+    void forEachEdgeFrom(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!hasVertex(id)) return;
+        forEachRowNeighbor(id, [&](int j) { visit(j, cellWeight(id, j)); });
+    }
+
+    void forEachVertex(FunctionRef<void(const TVertex&)> visit) const override {
+        for (const auto& v : m_vertices) {
+            if (v && v->isActive()) visit(*v);
+        }
+    }
+
+    void forEachEdge(FunctionRef<void(const EdgeType&)> visit) const override {
+        for (int i = 0; i < static_cast<int>(m_vertices.size()); ++i) {
+            if (!hasVertex(i)) continue;
+            forEachRowNeighbor(i, [&](int j) {
+                if (m_direction.isDirected() || j >= i) visit(EdgeType(i, j, cellWeight(i, j)));
+            });
+        }
+    }
+
+    void forEachEdgeTo(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!hasVertex(id)) return;
+        for (int i = 0; i < static_cast<int>(m_vertices.size()); ++i) {
+            if (hasVertex(i) && cellPresent(i, id)) visit(i, cellWeight(i, id));
+        }
+    }
+
     bool hasEdge(int from, int to) const override {
         if (!hasVertex(from) || !hasVertex(to)) return false;
-        return m_matrix[from][to].has_value();
+        return cellPresent(from, to);
     }
 
-    double getEdgeWeight(int from, int to) const override {
-        if (!hasVertex(from) || !hasVertex(to)) return 1.0;
-        return m_matrix[from][to].value_or(1.0);
+    TWeight getEdgeWeight(int from, int to) const override {
+        if (!hasVertex(from) || !hasVertex(to)) return 1;
+        return cellPresent(from, to) ? cellWeight(from, to) : TWeight{1};
     }
 
     void clear() override {
         m_vertices.clear();
-        m_matrix.clear();
+        m_present.clear();
+        m_weights.clear();
+        m_activeMask.clear();
+        m_capacity = 0;
+        m_rowWords = 0;
         while (!m_freeIds.empty()) m_freeIds.pop();
         notifyGraphCleared();
     }
@@ -227,12 +427,101 @@ public:
         return m_vertices.size();
     }
 
+    /**
+     * @brief Counts the active vertices adjacent from both given vertices.
+     * * Computed word-parallel as the popcount of (row(a) AND row(b) AND active mask).
+     * @param a The first vertex ID.
+     * @param b The second vertex ID.
+     * @return The number of common out-neighbours, or 0 if either vertex does not exist.
+     */
+    int countCommonNeighbors(int a, int b) const {
+        if (!hasVertex(a) || !hasVertex(b)) return 0;
+        const std::uint64_t* rowA = m_present.data() + a * m_rowWords;
+        const std::uint64_t* rowB = m_present.data() + b * m_rowWords;
+        int count = 0;
+        for (std::size_t w = 0; w < m_rowWords; ++w) {
+            count += std::popcount(rowA[w] & rowB[w] & m_activeMask[w]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Gets the out-degree of a vertex as the popcount of its masked row.
+     * @param id The vertex ID.
+     * @return The number of active out-neighbours, or 0 if the vertex does not exist.
+     */
+    int getOutDegree(int id) const {
+        return countCommonNeighbors(id, id);
+    }
+
+    /**
+     * @brief Preallocates the matrix for bulk construction.
+     * * Adding vertices up to @p n IDs afterwards performs no reallocation.
+     * @param n The number of vertex IDs to make room for.
+     */
+    void reserve(int n) {
+        if (n > m_capacity) reallocate(n);
+        m_vertices.reserve(n);
+    }
+
+    /**
+     * @brief Gets the number of vertex IDs the matrix can hold without reallocating.
+     * @return The current side length of the buffers.
+     */
+    int getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Gets the presence bitmap of one row, without the active-vertex mask applied.
+     * * Bit `to & 63` of word `to / 64` marks an edge to `to`; AND the words with getActiveMask()
+     * to keep only existing neighbours. Undirected edges are stored in both rows.
+     * @param id The row (source vertex ID).
+     * @return A view of the row's words, empty if id is outside the capacity.
+     */
+    std::span<const std::uint64_t> getPresenceRow(int id) const {
+        if (id < 0 || id >= m_capacity) return {};
+        return std::span<const std::uint64_t>(m_present.data() + id * m_rowWords, m_rowWords);
+    }
+
+    /**
+     * @brief Gets the bitmap of active vertex IDs, as long as a presence row.
+     * @return A view of the mask words.
+     */
+    std::span<const std::uint64_t> getActiveMask() const { return m_activeMask; }
+
+    /**
+     * @brief Gets the dense weights of one row, indexed by target ID.
+     * * Cells without an edge hold stale values, so read only those marked in getPresenceRow().
+     * @param id The row (source vertex ID).
+     * @return A view of getCapacity() weights, empty for unweighted graphs or if id is outside the capacity.
+     */
+    std::span<const TWeight> getWeightRow(int id) const {
+        if (m_weights.empty() || id < 0 || id >= m_capacity) return {};
+        return std::span<const TWeight>(m_weights.data() + static_cast<std::size_t>(id) * m_capacity, m_capacity);
+    }
+
+    /**
+     * @brief Estimates the heap memory held by the matrix buffers.
+     * @return The number of bytes used by the presence bitmap and the weight array.
+     */
+    std::size_t getMemoryFootprint() const {
+        return (m_present.capacity() + m_activeMask.capacity()) * sizeof(std::uint64_t)
+             + m_weights.capacity() * sizeof(TWeight);
+    }
+
     void addObserver(GraphObserver* observer) override {
-        if (observer) m_observers.push_back(observer);
+        m_notifier.addObserver(observer);
     }
 
     void removeObserver(GraphObserver* observer) override {
-        m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+        m_notifier.removeObserver(observer);
+    }
+
+    void beginBatch() override {
+        m_notifier.beginBatch();
+    }
+
+    void endBatch() override {
+        m_notifier.endBatch();
     }
 };
 }
\ No newline at end of file
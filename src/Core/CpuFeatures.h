@@ -0,0 +1,44 @@
+/**
+* @file CpuFeatures.h
+ * @brief Runtime selection of the optional AVX2 kernels.
+ */
+
+#pragma once
+
+// CORE_AVX2_KERNELS is 1 when the AVX2 kernels can be compiled, and CORE_AVX2_TARGET marks the functions
+// holding them. GCC and Clang compile such functions for AVX2 without any build flag; builds that already
+// target AVX2 (-mavx2, /arch:AVX2) compile everything for it and need no marker.
+#if defined(__AVX2__)
+#define CORE_AVX2_KERNELS 1
+#define CORE_AVX2_TARGET
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CORE_AVX2_KERNELS 1
+#define CORE_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#else
+#define CORE_AVX2_KERNELS 0
+#define CORE_AVX2_TARGET
+#endif
+
+namespace Core {
+
+/**
+ * @brief Checks whether the AVX2 kernels may run on this CPU.
+ * * The CPU is queried once; later calls only read the cached answer.
+ * @return True if the kernels were compiled and the CPU supports AVX2.
+ */
+inline bool cpuSupportsAvx2() {
+#if defined(__AVX2__)
+    return true;
+#elif CORE_AVX2_KERNELS
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+}
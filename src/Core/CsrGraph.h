@@ -0,0 +1,288 @@
+/**
+* @file CsrGraph.h
+ * @brief Immutable graph snapshot stored in compressed sparse row (CSR) form.
+ */
+
+#pragma once
+#include "Graph.h"
+#include <vector>
+#include <span>
+#include <limits>
+#include <cstddef>
+
+namespace Core {
+
+/**
+ * @brief Read-only snapshot of a graph laid out as compressed sparse row arrays.
+ * * The outgoing edges of vertex @c id occupy the half-open range
+ * [m_offsets[id], m_offsets[id + 1]) of the destination and weight arrays.
+ * Removed vertices and inactive edges of the source graph are dropped while
+ * building, so traversals never skip tombstones. Vertex IDs are preserved,
+ * which keeps results (distances, visited flags) directly comparable with the source graph.
+ * * Directed snapshots also store the transposed arrays, so forEachEdgeTo() visits the incoming
+ * edges of a vertex in time proportional to its in-degree. Undirected snapshots answer it from
+ * their own rows.
+ * * All mutating methods of the Graph interface are no-ops and observers are
+ * never notified, because the snapshot never changes after construction.
+ * @tparam TVertex The type of vertex used in the graph, defaults to Core::Vertex.
+ * @tparam TWeight The arithmetic type of edge weights, defaults to double.
+ */
+template <typename TVertex = Vertex, typename TWeight = double>
+class CsrGraph : public Graph<TVertex, TWeight> {
+private:
+    using EdgeType = BasicEdge<TWeight>;
+
+    bool m_directed;                                      ///< True if the graph is directed.
+    bool m_weighted;                                      ///< True if the graph is weighted.
+    std::vector<std::unique_ptr<TVertex>> m_vertices;     ///< Copies of the active vertices, nullptr for removed IDs.
+    std::vector<std::size_t> m_offsets;                   ///< Start of each vertex's edge range, size is vertex count + 1.
+    std::vector<int> m_destinations;                      ///< Destination vertex IDs of all edges, grouped by source.
+    std::vector<TWeight> m_weights;                       ///< Edge weights, parallel to m_destinations.
+    std::vector<std::size_t> m_inOffsets;                 ///< Start of each vertex's in-edge range; empty if undirected.
+    std::vector<int> m_sources;                           ///< Source vertex IDs of all edges, grouped by destination.
+    std::vector<TWeight> m_inWeights;                     ///< Edge weights, parallel to m_sources.
+
+public:
+    /**
+     * @brief Freezes the current state of a graph into CSR arrays.
+     * * Runs in O(V + E) for list-based sources (O(V^2) for an adjacency matrix,
+     * since enumerating its edges is quadratic). The neighbour order of every vertex matches the source,
+     * and the in-edges of a vertex are ordered by source ID.
+     * @param source The graph to snapshot.
+     */
+    explicit CsrGraph(const Graph<TVertex, TWeight>& source)
+        : m_directed(source.isDirected()), m_weighted(source.isWeighted())
+    {
+        int count = source.getVertexCount();
+        m_vertices.resize(count);
+        m_offsets.assign(count + 1, 0);
+
+        for (int id = 0; id < count; ++id) {
+            if (source.hasVertex(id)) {
+                m_vertices[id] = std::make_unique<TVertex>(*source.getVertex(id));
+                source.forEachEdgeFrom(id, [&](int to, TWeight weight) {
+                    m_destinations.push_back(to);
+                    m_weights.push_back(weight);
+                });
+            }
+            m_offsets[id + 1] = m_destinations.size();
+        }
+        m_destinations.shrink_to_fit();
+        m_weights.shrink_to_fit();
+        if (m_directed) buildTranspose();
+    }
+
+    bool isDirected() const override { return m_directed; }
+    bool isWeighted() const override { return m_weighted; }
+
+    int addVertex(std::unique_ptr<TVertex>) override { return -1; }
+    void removeVertex(int) override {}
+    void addEdge(int, int, TWeight = 1) override {}
+    void removeEdge(int, int) override {}
+    void clear() override {}
+    void beginBatch() override {}
+    void endBatch() override {}
+
+    bool hasVertex(int id) const override {
+        return id >= 0 && id < static_cast<int>(m_vertices.size()) && m_vertices[id];
+    }
+
+    bool hasEdge(int from, int to) const override {
+        if (!hasVertex(from) || !hasVertex(to)) return false;
+        for (int dest : getNeighborSpan(from)) {
+            if (dest == to) return true;
+        }
+        return false;
+    }
+
+    const TVertex* getVertex(int id) const override {
+        if (hasVertex(id)) return m_vertices[id].get();
+        return nullptr;
+    }
+
+    TVertex* getVertex(int id) override {
+        if (hasVertex(id)) return m_vertices[id].get();
+        return nullptr;
+    }
+
+    std::vector<const TVertex*> getVertices() const override {
+        std::vector<const TVertex*> active;
+        for (const auto& v : m_vertices) {
+            if (v) active.push_back(v.get());
+        }
+        return active;
+    }
+
+    std::vector<EdgeType> getEdges() const override {
+        std::vector<EdgeType> edges;
+        for (int i = 0; i < getVertexCount(); ++i) {
+            for (std::size_t e = m_offsets[i]; e < m_offsets[i + 1]; ++e) {
+                if (!m_directed && i > m_destinations[e]) continue;
+                edges.emplace_back(i, m_destinations[e], m_weights[e]);
+            }
+        }
+        return edges;
+    }
+
+    std::vector<int> getNeighbors(int id) const override {
+        auto span = getNeighborSpan(id);
+        return std::vector<int>(span.begin(), span.end());
+    }
+
+    std::vector<EdgeType> getEdgesFrom(int id) const override {
+        std::vector<EdgeType> edges;
+        if (hasVertex(id)) {
+            for (std::size_t e = m_offsets[id]; e < m_offsets[id + 1]; ++e) {
+                edges.emplace_back(id, m_destinations[e], m_weights[e]);
+            }
+        }
+        return edges;
+    }
+
+    void forEachNeighbor(int id, FunctionRef<void(int)> visit) const override {
+        for (int dest : getNeighborSpan(id)) visit(dest);
+    }
+
+    void forEachEdgeFrom(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!hasVertex(id)) return;
+        for (std::size_t e = m_offsets[id]; e < m_offsets[id + 1]; ++e) {
+            visit(m_destinations[e], m_weights[e]);
+        }
+    }
+
+    void forEachEdgeTo(int id, FunctionRef<void(int, TWeight)> visit) const override {
+        if (!hasVertex(id)) return;
+        if (!m_directed) {
+            forEachEdgeFrom(id, visit);
+            return;
+        }
+        for (std::size_t e = m_inOffsets[id]; e < m_inOffsets[id + 1]; ++e) {
+            visit(m_sources[e], m_inWeights[e]);
+        }
+    }
+
+    void forEachVertex(FunctionRef<void(const TVertex&)> visit) const override {
+        for (const auto& v : m_vertices) {
+            if (v) visit(*v);
+        }
+    }
+
+    void forEachEdge(FunctionRef<void(const EdgeType&)> visit) const override {
+        for (int i = 0; i < getVertexCount(); ++i) {
+            for (std::size_t e = m_offsets[i]; e < m_offsets[i + 1]; ++e) {
+                if (!m_directed && i > m_destinations[e]) continue;
+                visit(EdgeType(i, m_destinations[e], m_weights[e]));
+            }
+        }
+    }
+
+    TWeight getEdgeWeight(int from, int to) const override {
+        if (!hasVertex(from) || !hasVertex(to)) return WeightTraits<TWeight>::missing();
+        for (std::size_t e = m_offsets[from]; e < m_offsets[from + 1]; ++e) {
+            if (m_destinations[e] == to) return m_weights[e];
+        }
+        return 1;
+    }
+
+    int getVertexCount() const override { return m_vertices.size(); }
+
+    void addObserver(GraphObserver*) override {}
+    void removeObserver(GraphObserver*) override {}
+
+    /**
+     * @brief Gets the destinations of all outgoing edges of a vertex without copying.
+     * @param id The ID of the source vertex.
+     * @return A view into the destination array, empty if the vertex does not exist.
+     */
+    std::span<const int> getNeighborSpan(int id) const {
+        if (!hasVertex(id)) return {};
+        return std::span<const int>(m_destinations.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+    }
+
+    /**
+     * @brief Gets the weights of all outgoing edges of a vertex, parallel to getNeighborSpan().
+     * @param id The ID of the source vertex.
+     * @return A view into the weight array, empty if the vertex does not exist.
+     */
+    std::span<const TWeight> getWeightSpan(int id) const {
+        if (!hasVertex(id)) return {};
+        return std::span<const TWeight>(m_weights.data() + m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+    }
+
+    /**
+     * @brief Gets the sources of all incoming edges of a vertex without copying.
+     * * Undirected snapshots return the same view as getNeighborSpan().
+     * @param id The ID of the destination vertex.
+     * @return A view into the source array, ordered by source ID, empty if the vertex does not exist.
+     */
+    std::span<const int> getInNeighborSpan(int id) const {
+        if (!m_directed) return getNeighborSpan(id);
+        if (!hasVertex(id)) return {};
+        return std::span<const int>(m_sources.data() + m_inOffsets[id], m_inOffsets[id + 1] - m_inOffsets[id]);
+    }
+
+    /**
+     * @brief Gets the number of stored edges. Undirected edges are stored once per direction.
+     * @return The length of the destination array.
+     */
+    std::size_t getEdgeCount() const { return m_destinations.size(); }
+
+    /**
+     * @brief Gets the row offset array (vertex count + 1 entries).
+     * @return A constant reference to the offsets.
+     */
+    const std::vector<std::size_t>& getOffsets() const { return m_offsets; }
+
+    /**
+     * @brief Gets the flat destination array.
+     * @return A constant reference to the destinations.
+     */
+    const std::vector<int>& getDestinations() const { return m_destinations; }
+
+    /**
+     * @brief Gets the flat weight array.
+     * @return A constant reference to the weights.
+     */
+    const std::vector<TWeight>& getWeights() const { return m_weights; }
+
+    /**
+     * @brief Estimates the heap memory held by the snapshot.
+     * @return The number of bytes used by the CSR arrays and the vertex copies.
+     */
+    std::size_t getMemoryFootprint() const {
+        std::size_t bytes = m_offsets.capacity() * sizeof(std::size_t)
+                          + m_destinations.capacity() * sizeof(int)
+                          + m_weights.capacity() * sizeof(TWeight)
+                          + m_inOffsets.capacity() * sizeof(std::size_t)
+                          + m_sources.capacity() * sizeof(int)
+                          + m_inWeights.capacity() * sizeof(TWeight)
+                          + m_vertices.capacity() * sizeof(std::unique_ptr<TVertex>);
+        for (const auto& v : m_vertices) {
+            if (v) bytes += sizeof(TVertex);
+        }
+        return bytes;
+    }
+
+private:
+    /**
+     * @brief Fills the in-edge arrays from the out-edge arrays with a counting sort on destinations.
+     */
+    void buildTranspose() {
+        int count = getVertexCount();
+        m_inOffsets.assign(count + 1, 0);
+        for (int dest : m_destinations) ++m_inOffsets[dest + 1];
+        for (int id = 0; id < count; ++id) m_inOffsets[id + 1] += m_inOffsets[id];
+
+        m_sources.resize(m_destinations.size());
+        m_inWeights.resize(m_weights.size());
+        std::vector<std::size_t> next(m_inOffsets.begin(), m_inOffsets.end() - 1);
+        for (int id = 0; id < count; ++id) {
+            for (std::size_t e = m_offsets[id]; e < m_offsets[id + 1]; ++e) {
+                std::size_t slot = next[m_destinations[e]]++;
+                m_sources[slot] = id;
+                m_inWeights[slot] = m_weights[e];
+            }
+        }
+    }
+};
+}
\ No newline at end of file
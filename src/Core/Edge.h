@@ -5,32 +5,36 @@
 
 #pragma once
 #include <functional>
+#include <cstdint>
+#include <cstddef>
 
 namespace Core {
 
     /**
      * @brief Represents a directed or undirected connection between two vertices.
+     * * Graphs only hand out edges that exist, so the record carries no activity flag:
+     * with 32-bit weights it is 12 bytes, with double weights 16.
+     * @tparam TWeight The arithmetic type of the edge weight.
      */
-    struct Edge {
-        int m_source = -1;       ///< The ID of the source vertex.
-        int m_destination = -1;  ///< The ID of the destination vertex.
-        double m_weight = 1.0;   ///< The weight or cost of the edge.
-        bool m_active = true;    ///< Flag indicating if the edge is active.
+    template <typename TWeight = double>
+    struct BasicEdge {
+        int m_source = -1;          ///< The ID of the source vertex.
+        int m_destination = -1;     ///< The ID of the destination vertex.
+        TWeight m_weight = 1;       ///< The weight or cost of the edge.
 
         /**
          * @brief Default constructor.
          */
-        Edge() = default;
+        BasicEdge() = default;
 
         /**
          * @brief Constructs an edge with specified properties.
          * @param source The source vertex ID.
          * @param destination The destination vertex ID.
-         * @param weight The weight of the edge (default is 1.0).
-         * @param active The active status of the edge (default is true).
+         * @param weight The weight of the edge (default is 1).
          */
-        Edge(int source, int destination, double weight = 1.0, bool active = true)
-            : m_source(source), m_destination(destination), m_weight(weight), m_active(active) {}
+        BasicEdge(int source, int destination, TWeight weight = 1)
+            : m_source(source), m_destination(destination), m_weight(weight) {}
 
         /**
          * @brief Gets the source vertex ID.
@@ -48,45 +52,64 @@ namespace Core {
          * @brief Gets the weight of the edge.
          * @return The edge weight.
          */
-        double getWeight() const { return m_weight; }
-
-        /**
-         * @brief Marks the edge as inactive.
-         */
-        void markInactive() { m_active = false; }
-
-        /**
-         * @brief Marks the edge as active.
-         */
-        void markActive() { m_active = true; }
-
-        /**
-         * @brief Checks if the edge is active.
-         * @return True if active, false otherwise.
-         */
-        bool isActive() const { return m_active; }
+        TWeight getWeight() const { return m_weight; }
 
         /**
          * @brief Equality operator for edges.
          * @param other The other edge to compare with.
          * @return True if both source and destination match, false otherwise.
          */
-        bool operator==(const Edge& other) const {
+        bool operator==(const BasicEdge& other) const {
             return m_source == other.m_source && m_destination == other.m_destination;
         }
     };
 
+    /**
+     * @brief Edge with a double weight, the type used by the GUI and observers.
+     */
+    using Edge = BasicEdge<double>;
+
+    /**
+     * @brief Packs an ordered pair of vertex IDs into a single 64-bit key.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @return The source in the high 32 bits and the destination in the low 32 bits.
+     */
+    inline std::uint64_t packEdgeKey(int from, int to) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(from)) << 32) | static_cast<std::uint32_t>(to);
+    }
+
+    /**
+     * @brief Hashes an ordered pair of vertex IDs.
+     * * Applies the splitmix64 finalizer to the packed key, so every input bit affects every
+     * output bit. Unlike XOR-combining the two IDs, (a, b) and (b, a) and nearby pairs do not collide.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @return The hash value.
+     */
+    inline std::size_t hashEdgeKey(int from, int to) {
+        std::uint64_t x = packEdgeKey(from, to);
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<std::size_t>(x);
+    }
+
     /**
      * @brief Hash function object for the Edge structure.
      */
     struct EdgeHash {
         /**
-         * @brief Computes the hash value for an Edge.
+         * @brief Computes the hash value for an edge.
+         * @tparam TWeight The weight type of the edge.
          * @param e The edge to hash.
          * @return The computed hash value.
          */
-        std::size_t operator()(const Edge& e) const {
-            return std::hash<int>()(e.m_source) ^ (std::hash<int>()(e.m_destination) << 1);
+        template <typename TWeight>
+        std::size_t operator()(const BasicEdge<TWeight>& e) const {
+            return hashEdgeKey(e.m_source, e.m_destination);
         }
     };
 }
\ No newline at end of file
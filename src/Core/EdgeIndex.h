@@ -0,0 +1,187 @@
+/**
+* @file EdgeIndex.h
+ * @brief Open-addressing hash index from (source, destination) pairs to edge weights.
+ */
+
+#pragma once
+#include "Edge.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Core {
+
+/**
+ * @brief Hash table mapping an ordered vertex pair to the weight of the edge between them.
+ * * Uses open addressing with linear probing over a power-of-two slot array, keyed on
+ * packEdgeKey() and hashed with hashEdgeKey(). Erased slots become tombstones, and the table
+ * is rebuilt once live entries plus tombstones exceed 70% of the slots. Lookups, insertions and
+ * removals are expected O(1) and never allocate except when the table grows.
+ * @tparam TWeight The arithmetic type of the stored weights.
+ */
+template <typename TWeight = double>
+class BasicEdgeIndex {
+private:
+    /**
+     * @brief A single table slot.
+     */
+    struct Slot {
+        std::uint64_t key;  ///< Packed (from, to) key, or one of the EMPTY/ERASED markers.
+        TWeight weight;     ///< Weight of the edge stored in the slot.
+    };
+
+    static constexpr std::uint64_t EMPTY = ~std::uint64_t{0};   ///< Key of a never-used slot, packEdgeKey(-1, -1).
+    static constexpr std::uint64_t ERASED = EMPTY - 1;          ///< Key of a tombstone slot, packEdgeKey(-1, -2).
+
+    std::vector<Slot> m_slots;      ///< The slot array; its size is zero or a power of two.
+    std::size_t m_size = 0;         ///< Number of live entries.
+    std::size_t m_erased = 0;       ///< Number of tombstone slots.
+
+    /**
+     * @brief Finds the slot holding a key.
+     * @param key The packed key to look up.
+     * @param from The source vertex ID, used for hashing.
+     * @param to The destination vertex ID, used for hashing.
+     * @return The slot index, or the slot array size if the key is absent.
+     */
+    std::size_t findSlot(std::uint64_t key, int from, int to) const {
+        if (m_slots.empty()) return 0;
+        std::size_t mask = m_slots.size() - 1;
+        for (std::size_t i = hashEdgeKey(from, to) & mask;; i = (i + 1) & mask) {
+            if (m_slots[i].key == key) return i;
+            if (m_slots[i].key == EMPTY) return m_slots.size();
+        }
+    }
+
+    /**
+     * @brief Rebuilds the table with a new slot count, dropping all tombstones.
+     * @param slotCount The new number of slots, a power of two larger than the live entry count.
+     */
+    void rehash(std::size_t slotCount) {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.assign(slotCount, Slot{EMPTY, TWeight{}});
+        m_erased = 0;
+        std::size_t mask = slotCount - 1;
+        for (const Slot& slot : old) {
+            if (slot.key == EMPTY || slot.key == ERASED) continue;
+            int from = static_cast<int>(slot.key >> 32);
+            int to = static_cast<int>(slot.key & 0xffffffffu);
+            std::size_t i = hashEdgeKey(from, to) & mask;
+            while (m_slots[i].key != EMPTY) i = (i + 1) & mask;
+            m_slots[i] = slot;
+        }
+    }
+
+    /**
+     * @brief Computes the smallest power-of-two slot count that keeps a given number of entries under the load limit.
+     * @param entries The number of entries to hold.
+     * @return The slot count.
+     */
+    static std::size_t slotsFor(std::size_t entries) {
+        std::size_t slots = 16;
+        while (entries * 10 >= slots * 7) slots *= 2;
+        return slots;
+    }
+
+public:
+    /**
+     * @brief Checks if an edge is indexed.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @return True if the pair is present.
+     */
+    bool contains(int from, int to) const {
+        return findSlot(packEdgeKey(from, to), from, to) < m_slots.size();
+    }
+
+    /**
+     * @brief Looks up the weight of an indexed edge.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @return A pointer to the stored weight, or nullptr if the pair is absent.
+     */
+    const TWeight* find(int from, int to) const {
+        std::size_t i = findSlot(packEdgeKey(from, to), from, to);
+        return i < m_slots.size() ? &m_slots[i].weight : nullptr;
+    }
+
+    /**
+     * @brief Adds an edge to the index.
+     * @param from The source vertex ID (non-negative).
+     * @param to The destination vertex ID (non-negative).
+     * @param weight The weight to store.
+     * @return True if inserted, false if the pair was already present.
+     */
+    bool insert(int from, int to, TWeight weight) {
+        if ((m_size + m_erased + 1) * 10 >= m_slots.size() * 7) {
+            rehash(slotsFor(m_size + 1));
+        }
+        std::uint64_t key = packEdgeKey(from, to);
+        std::size_t mask = m_slots.size() - 1;
+        std::size_t target = m_slots.size();
+        for (std::size_t i = hashEdgeKey(from, to) & mask;; i = (i + 1) & mask) {
+            if (m_slots[i].key == key) return false;
+            if (m_slots[i].key == ERASED && target == m_slots.size()) target = i;
+            if (m_slots[i].key == EMPTY) {
+                if (target == m_slots.size()) target = i;
+                break;
+            }
+        }
+        if (m_slots[target].key == ERASED) --m_erased;
+        m_slots[target] = Slot{key, weight};
+        ++m_size;
+        return true;
+    }
+
+    /**
+     * @brief Removes an edge from the index.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @return True if the pair was present and removed.
+     */
+    bool erase(int from, int to) {
+        std::size_t i = findSlot(packEdgeKey(from, to), from, to);
+        if (i >= m_slots.size()) return false;
+        m_slots[i].key = ERASED;
+        --m_size;
+        ++m_erased;
+        return true;
+    }
+
+    /**
+     * @brief Makes room for a number of entries without further rehashing.
+     * @param entries The number of entries to prepare for.
+     */
+    void reserve(std::size_t entries) {
+        std::size_t slots = slotsFor(entries);
+        if (slots > m_slots.size()) rehash(slots);
+    }
+
+    /**
+     * @brief Removes all entries and releases the slot array.
+     */
+    void clear() {
+        m_slots.clear();
+        m_slots.shrink_to_fit();
+        m_size = 0;
+        m_erased = 0;
+    }
+
+    /**
+     * @brief Gets the number of indexed edges.
+     * @return The live entry count.
+     */
+    std::size_t size() const { return m_size; }
+
+    /**
+     * @brief Estimates the heap memory held by the index.
+     * @return The number of bytes of the slot array.
+     */
+    std::size_t getMemoryFootprint() const { return m_slots.capacity() * sizeof(Slot); }
+};
+
+/**
+ * @brief Edge index with double weights.
+ */
+using EdgeIndex = BasicEdgeIndex<double>;
+}
\ No newline at end of file
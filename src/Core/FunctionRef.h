@@ -0,0 +1,53 @@
+/**
+* @file FunctionRef.h
+ * @brief Non-owning, non-allocating reference to a callable.
+ */
+
+#pragma once
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Core {
+
+    template <typename Signature>
+    class FunctionRef;
+
+    /**
+     * @brief Lightweight reference to any callable with a matching signature.
+     * * Unlike std::function it never allocates and never copies the callable; it only stores
+     * a pointer to it and a trampoline. It is meant for callback parameters (such as graph visitors)
+     * and must not outlive the callable it refers to.
+     * @tparam R The return type of the callable.
+     * @tparam Args The parameter types of the callable.
+     */
+    template <typename R, typename... Args>
+    class FunctionRef<R(Args...)> {
+    private:
+        void* m_object;                      ///< Address of the referenced callable.
+        R (*m_callback)(void*, Args...);     ///< Trampoline that casts m_object back and invokes it.
+
+    public:
+        /**
+         * @brief Binds the reference to a callable.
+         * @tparam F The type of the callable.
+         * @param f The callable to refer to. It must stay alive while the reference is used.
+         */
+        template <typename F>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> && std::is_invocable_r_v<R, F&, Args...>)
+        FunctionRef(F&& f) noexcept
+            : m_object(const_cast<void*>(static_cast<const void*>(std::addressof(f)))),
+              m_callback([](void* object, Args... args) -> R {
+                  return (*static_cast<std::remove_reference_t<F>*>(object))(std::forward<Args>(args)...);
+              }) {}
+
+        /**
+         * @brief Invokes the referenced callable.
+         * @param args The arguments to forward.
+         * @return Whatever the callable returns.
+         */
+        R operator()(Args... args) const {
+            return m_callback(m_object, std::forward<Args>(args)...);
+        }
+    };
+}
\ No newline at end of file
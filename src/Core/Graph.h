@@ -6,19 +6,28 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <algorithm>
 #include "Edge.h"
+#include "WeightTraits.h"
 #include "Vertex.h"
 #include "GraphObserver.h"
+#include "FunctionRef.h"
 
 namespace Core {
 
     /**
      * @brief Abstract base class defining the interface for a graph data structure.
      * @tparam TVertex The type of vertex used in the graph, defaults to Core::Vertex.
+     * @tparam TWeight The arithmetic type of edge weights, defaults to double. Observers always receive double weights.
      */
-    template <typename TVertex = Vertex>
+    template <typename TVertex = Vertex, typename TWeight = double>
     class Graph {
     public:
+        using WeightType = TWeight;             ///< The type of edge weights.
+        using EdgeType = BasicEdge<TWeight>;    ///< The type of edges handed out by the graph.
+
         /**
          * @brief Virtual destructor.
          */
@@ -53,9 +62,50 @@ namespace Core {
          * @brief Adds an edge between two vertices.
          * @param from The source vertex ID.
          * @param to The destination vertex ID.
-         * @param weight The weight of the edge (default is 1.0).
+         * @param weight The weight of the edge (default is 1).
+         */
+        virtual void addEdge(int from, int to, TWeight weight = 1) = 0;
+
+        /**
+         * @brief Adds several default-constructed vertices at once.
+         * * The additions are wrapped in a batch, so observers receive a single onBatchApplied() event.
+         * @param count The number of vertices to add.
+         * @return The IDs assigned to the new vertices, in insertion order.
          */
-        virtual void addEdge(int from, int to, double weight = 1.0) = 0;
+        virtual std::vector<int> addVertices(int count) {
+            std::vector<int> ids;
+            if constexpr (std::is_default_constructible_v<TVertex>) {
+                ids.reserve(std::max(count, 0));
+                beginBatch();
+                for (int i = 0; i < count; ++i) ids.push_back(addVertex(std::make_unique<TVertex>()));
+                endBatch();
+            }
+            return ids;
+        }
+
+        /**
+         * @brief Adds several edges at once, with the same rules as addEdge().
+         * * The additions are wrapped in a batch, so observers receive a single onBatchApplied() event.
+         * @param edges The edges to add.
+         */
+        virtual void addEdges(std::span<const EdgeType> edges) {
+            beginBatch();
+            for (const auto& edge : edges) addEdge(edge.m_source, edge.m_destination, edge.m_weight);
+            endBatch();
+        }
+
+        /**
+         * @brief Opens a batch of modifications.
+         * * Until the matching endBatch(), observers are not notified of individual changes;
+         * the net changes are delivered once through GraphObserver::onBatchApplied(). Batches nest.
+         */
+        virtual void beginBatch() = 0;
+
+        /**
+         * @brief Closes a batch of modifications opened by beginBatch().
+         * * Closing the outermost batch notifies every observer once with the accumulated changes.
+         */
+        virtual void endBatch() = 0;
 
         /**
          * @brief Removes an edge between two vertices.
@@ -108,7 +158,7 @@ namespace Core {
          * @brief Gets a list of all active edges in the graph.
          * @return A vector of active edges.
          */
-        virtual std::vector<Edge> getEdges() const = 0;
+        virtual std::vector<EdgeType> getEdges() const = 0;
 
         /**
          * @brief Gets a list of neighbor vertex IDs for a given vertex.
@@ -122,15 +172,100 @@ namespace Core {
          * @param id The ID of the source vertex.
          * @return A vector of edges originating from the given vertex.
          */
-        virtual std::vector<Edge> getEdgesFrom(int id) const = 0;
+        virtual std::vector<EdgeType> getEdgesFrom(int id) const = 0;
+
+        /**
+         * @brief Calls a function with the ID of every active neighbour of a vertex, without allocating.
+         * * Neighbours are visited in the same order getNeighbors() returns them.
+         * The visitor must not modify the graph.
+         * @param id The ID of the source vertex.
+         * @param visit The function to call with each neighbour ID.
+         */
+        virtual void forEachNeighbor(int id, FunctionRef<void(int)> visit) const = 0;
+
+        /**
+         * @brief Calls a function with the destination and weight of every outgoing edge of a vertex, without allocating.
+         * * Edges are visited in the same order getEdgesFrom() returns them.
+         * The visitor must not modify the graph.
+         * @param id The ID of the source vertex.
+         * @param visit The function to call with each destination ID and edge weight.
+         */
+        virtual void forEachEdgeFrom(int id, FunctionRef<void(int, TWeight)> visit) const = 0;
+
+        /**
+         * @brief Calls a function with every active vertex, without allocating.
+         * @param visit The function to call with each vertex.
+         */
+        virtual void forEachVertex(FunctionRef<void(const TVertex&)> visit) const = 0;
+
+        /**
+         * @brief Calls a function with every active edge, without allocating.
+         * * Edges are visited as getEdges() returns them, so undirected edges are reported once.
+         * @param visit The function to call with each edge.
+         */
+        virtual void forEachEdge(FunctionRef<void(const EdgeType&)> visit) const = 0;
+
+        /**
+         * @brief Calls a function with the source and weight of every incoming edge of a vertex, without allocating.
+         * * The default implementation scans the outgoing edges of every vertex, which is
+         * O(V + E). Representations that can answer faster (e.g. with an in-edge index) override it.
+         * @param id The ID of the destination vertex.
+         * @param visit The function to call with each source ID and edge weight.
+         */
+        virtual void forEachEdgeTo(int id, FunctionRef<void(int, TWeight)> visit) const {
+            if (!hasVertex(id)) return;
+            if (!isDirected()) {
+                forEachEdgeFrom(id, visit);
+                return;
+            }
+            for (int i = 0; i < getVertexCount(); ++i) {
+                if (!hasVertex(i)) continue;
+                forEachEdgeFrom(i, [&](int to, TWeight weight) {
+                    if (to == id) visit(i, weight);
+                });
+            }
+        }
+
+        /**
+         * @brief Gets all incoming edges of a specific vertex.
+         * @param id The ID of the destination vertex.
+         * @return A vector of edges ending at the given vertex, with the vertex as their destination.
+         */
+        virtual std::vector<EdgeType> getEdgesTo(int id) const {
+            std::vector<EdgeType> edges;
+            forEachEdgeTo(id, [&](int from, TWeight weight) { edges.emplace_back(from, id, weight); });
+            return edges;
+        }
+
+        /**
+         * @brief Gets the IDs of all vertices that have an edge to the given vertex.
+         * @param id The ID of the target vertex.
+         * @return A vector of predecessor vertex IDs.
+         */
+        virtual std::vector<int> getPredecessors(int id) const {
+            std::vector<int> predecessors;
+            forEachEdgeTo(id, [&](int from, TWeight) { predecessors.push_back(from); });
+            return predecessors;
+        }
+
+        /**
+         * @brief Gets the number of incoming edges of a vertex.
+         * @param id The ID of the target vertex.
+         * @return The in-degree, or 0 if the vertex does not exist.
+         */
+        virtual int getInDegree(int id) const {
+            int degree = 0;
+            forEachEdgeTo(id, [&](int, TWeight) { ++degree; });
+            return degree;
+        }
 
         /**
          * @brief Gets the weight of the edge between two vertices.
          * @param from The source vertex ID.
          * @param to The destination vertex ID.
-         * @return The weight of the edge, or infinity if it doesn't exist.
+         * @return The weight of the edge, or WeightTraits<TWeight>::missing() if a vertex doesn't exist.
          */
-        virtual double getEdgeWeight(int from, int to) const = 0;
+        virtual TWeight getEdgeWeight(int from, int to) const = 0;
 
         /**
          * @brief Gets the total count of vertices (including inactive ones that haven't been reused).
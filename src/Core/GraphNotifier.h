@@ -0,0 +1,167 @@
+/**
+* @file GraphNotifier.h
+ * @brief Observer registry shared by graph representations, with batch coalescing.
+ */
+
+#pragma once
+#include "GraphObserver.h"
+#include "Edge.h"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace Core {
+
+/**
+ * @brief Dispatches graph change notifications to registered observers.
+ * * Outside a batch every change is forwarded immediately. Between beginBatch() and the matching
+ * endBatch() changes are accumulated into a GraphBatch instead (cancelling an addition that is undone
+ * inside the same batch) and delivered with a single onBatchApplied() call per observer. Batches nest.
+ */
+class GraphNotifier {
+private:
+    std::vector<GraphObserver*> m_observers;                        ///< List of registered graph observers.
+    int m_batchDepth = 0;                                           ///< Number of currently open batches.
+    GraphBatch m_pending;                                           ///< Changes accumulated by the open batch.
+    std::unordered_map<int, std::size_t> m_addedVertexPos;          ///< Position of each pending added vertex in m_pending.
+    std::unordered_map<std::uint64_t, std::size_t> m_addedEdgePos;  ///< Position of each pending added edge in m_pending.
+
+    /**
+     * @brief Removes a pending addition by swapping it with the last element.
+     * @tparam T The element type of the pending list.
+     * @tparam TKey The key type of the position map.
+     * @param items The pending list.
+     * @param positions The position map of the list.
+     * @param key The key of the element to remove.
+     * @param keyOf Function computing the key of a list element.
+     * @return True if the key was pending and has been removed.
+     */
+    template <typename T, typename TKey, typename KeyOf>
+    static bool cancelPending(std::vector<T>& items, std::unordered_map<TKey, std::size_t>& positions,
+                              TKey key, KeyOf keyOf) {
+        auto it = positions.find(key);
+        if (it == positions.end()) return false;
+        std::size_t pos = it->second;
+        positions.erase(it);
+        if (pos + 1 != items.size()) {
+            items[pos] = items.back();
+            positions[keyOf(items[pos])] = pos;
+        }
+        items.pop_back();
+        return true;
+    }
+
+public:
+    /**
+     * @brief Registers an observer to receive graph modification events.
+     * @param observer Pointer to the observer instance.
+     */
+    void addObserver(GraphObserver* observer) { if (observer) m_observers.push_back(observer); }
+
+    /**
+     * @brief Unregisters a previously added observer.
+     * @param observer Pointer to the observer instance to remove.
+     */
+    void removeObserver(GraphObserver* observer) {
+        m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+    }
+
+    /**
+     * @brief Checks if a batch is currently open.
+     * @return True between an outermost beginBatch() and its endBatch().
+     */
+    bool inBatch() const { return m_batchDepth > 0; }
+
+    /**
+     * @brief Opens a (possibly nested) batch.
+     */
+    void beginBatch() { ++m_batchDepth; }
+
+    /**
+     * @brief Closes a batch; closing the outermost one delivers the accumulated changes.
+     */
+    void endBatch() {
+        if (m_batchDepth == 0 || --m_batchDepth > 0) return;
+        GraphBatch batch = std::move(m_pending);
+        m_pending = GraphBatch();
+        m_addedVertexPos.clear();
+        m_addedEdgePos.clear();
+        if (batch.empty()) return;
+        for (auto obs : m_observers) obs->onBatchApplied(batch);
+    }
+
+    /**
+     * @brief Reports that a vertex was added.
+     * @param id The ID of the added vertex.
+     */
+    void vertexAdded(int id) {
+        if (!inBatch()) {
+            for (auto obs : m_observers) obs->onVertexAdded(id);
+            return;
+        }
+        m_addedVertexPos[id] = m_pending.addedVertices.size();
+        m_pending.addedVertices.push_back(id);
+    }
+
+    /**
+     * @brief Reports that a vertex was removed.
+     * @param id The ID of the removed vertex.
+     */
+    void vertexRemoved(int id) {
+        if (!inBatch()) {
+            for (auto obs : m_observers) obs->onVertexRemoved(id);
+            return;
+        }
+        if (!cancelPending(m_pending.addedVertices, m_addedVertexPos, id, [](int v) { return v; })) {
+            m_pending.removedVertices.push_back(id);
+        }
+    }
+
+    /**
+     * @brief Reports that an edge was added.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     * @param weight The weight of the edge.
+     */
+    void edgeAdded(int from, int to, double weight) {
+        if (!inBatch()) {
+            for (auto obs : m_observers) obs->onEdgeAdded(from, to, weight);
+            return;
+        }
+        m_addedEdgePos[packEdgeKey(from, to)] = m_pending.addedEdges.size();
+        m_pending.addedEdges.emplace_back(from, to, weight);
+    }
+
+    /**
+     * @brief Reports that an edge was removed.
+     * @param from The source vertex ID.
+     * @param to The destination vertex ID.
+     */
+    void edgeRemoved(int from, int to) {
+        if (!inBatch()) {
+            for (auto obs : m_observers) obs->onEdgeRemoved(from, to);
+            return;
+        }
+        auto keyOf = [](const Edge& e) { return packEdgeKey(e.m_source, e.m_destination); };
+        if (!cancelPending(m_pending.addedEdges, m_addedEdgePos, packEdgeKey(from, to), keyOf)) {
+            m_pending.removedEdges.emplace_back(from, to);
+        }
+    }
+
+    /**
+     * @brief Reports that the graph was cleared. Inside a batch, all earlier pending changes are discarded.
+     */
+    void graphCleared() {
+        if (!inBatch()) {
+            for (auto obs : m_observers) obs->onGraphCleared();
+            return;
+        }
+        m_pending = GraphBatch();
+        m_pending.cleared = true;
+        m_addedVertexPos.clear();
+        m_addedEdgePos.clear();
+    }
+};
+}
\ No newline at end of file
@@ -4,13 +4,39 @@
  */
 
 #pragma once
+#include "Edge.h"
+#include <vector>
 
 namespace Core {
 
+    /**
+     * @brief Net set of changes made to a graph during a batch (see Graph::beginBatch()).
+     * * Changes that cancel out inside the batch (e.g. an edge added and removed again) are dropped.
+     * Observers should apply the parts in member order: clear, removed edges, removed vertices,
+     * added vertices, added edges.
+     */
+    struct GraphBatch {
+        bool cleared = false;               ///< True if the graph was cleared during the batch, before the listed changes.
+        std::vector<Edge> removedEdges;     ///< Edges removed during the batch (weights are not meaningful).
+        std::vector<int> removedVertices;   ///< IDs of vertices removed during the batch.
+        std::vector<int> addedVertices;     ///< IDs of vertices added during the batch.
+        std::vector<Edge> addedEdges;       ///< Edges added during the batch, with their weights.
+
+        /**
+         * @brief Checks if the batch carries no changes.
+         * @return True if nothing has to be applied.
+         */
+        bool empty() const {
+            return !cleared && removedEdges.empty() && removedVertices.empty()
+                && addedVertices.empty() && addedEdges.empty();
+        }
+    };
+
     /**
      * @brief Interface for observing changes in a graph.
      * * Implement this interface to receive notifications when vertices
      * or edges are added, removed, or when the graph is cleared.
+     * Changes made inside a batch are delivered together through onBatchApplied().
      */
     class GraphObserver {
     public:
@@ -50,5 +76,19 @@ namespace Core {
          * @brief Called when the entire graph is cleared.
          */
         virtual void onGraphCleared() = 0;
+
+        /**
+         * @brief Called once when an outermost batch ends, instead of the individual notifications.
+         * * The default implementation replays the batch through the individual callbacks;
+         * observers that can apply many changes at once should override it.
+         * @param batch The net changes made during the batch.
+         */
+        virtual void onBatchApplied(const GraphBatch& batch) {
+            if (batch.cleared) onGraphCleared();
+            for (const auto& e : batch.removedEdges) onEdgeRemoved(e.m_source, e.m_destination);
+            for (int id : batch.removedVertices) onVertexRemoved(id);
+            for (int id : batch.addedVertices) onVertexAdded(id);
+            for (const auto& e : batch.addedEdges) onEdgeAdded(e.m_source, e.m_destination, e.m_weight);
+        }
     };
 }
\ No newline at end of file
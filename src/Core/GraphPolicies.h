@@ -0,0 +1,133 @@
+/**
+* @file GraphPolicies.h
+ * @brief Direction and weight policies that configure graph representations at compile time.
+ */
+
+#pragma once
+
+namespace Core {
+
+/**
+ * @brief Direction policy of a graph whose edges are always directed.
+ * * Constructible from a bool only so it can stand in for RuntimeDirection; the value is ignored.
+ */
+struct Directed {
+    constexpr Directed(bool = true) noexcept {}
+
+    /**
+     * @brief Checks if the graph is directed.
+     * @return Always true.
+     */
+    static constexpr bool isDirected() noexcept { return true; }
+};
+
+/**
+ * @brief Direction policy of a graph whose edges are always undirected.
+ * * Constructible from a bool only so it can stand in for RuntimeDirection; the value is ignored.
+ */
+struct Undirected {
+    constexpr Undirected(bool = false) noexcept {}
+
+    /**
+     * @brief Checks if the graph is directed.
+     * @return Always false.
+     */
+    static constexpr bool isDirected() noexcept { return false; }
+};
+
+/**
+ * @brief Direction policy chosen when the graph is constructed.
+ */
+class RuntimeDirection {
+private:
+    bool m_directed;    ///< True if the graph is directed.
+
+public:
+    /**
+     * @brief Constructs the policy.
+     * @param directed True if the graph should be directed.
+     */
+    constexpr RuntimeDirection(bool directed = true) noexcept : m_directed(directed) {}
+
+    /**
+     * @brief Checks if the graph is directed.
+     * @return The value given at construction.
+     */
+    constexpr bool isDirected() const noexcept { return m_directed; }
+};
+
+/**
+ * @brief Weight policy of a graph whose edges always carry a weight.
+ * * Constructible from a bool only so it can stand in for RuntimeWeighted; the value is ignored.
+ */
+struct Weighted {
+    static constexpr bool storesWeights = true;     ///< True if edge storage has a weight field.
+
+    constexpr Weighted(bool = true) noexcept {}
+
+    /**
+     * @brief Checks if the graph is weighted.
+     * @return Always true.
+     */
+    static constexpr bool isWeighted() noexcept { return true; }
+};
+
+/**
+ * @brief Weight policy of a graph whose edges all have weight 1 and store none.
+ * * Constructible from a bool only so it can stand in for RuntimeWeighted; the value is ignored.
+ */
+struct Unweighted {
+    static constexpr bool storesWeights = false;    ///< True if edge storage has a weight field.
+
+    constexpr Unweighted(bool = false) noexcept {}
+
+    /**
+     * @brief Checks if the graph is weighted.
+     * @return Always false.
+     */
+    static constexpr bool isWeighted() noexcept { return false; }
+};
+
+/**
+ * @brief Weight policy chosen when the graph is constructed.
+ * * Edge storage always has a weight field; unweighted graphs store 1.0 in it.
+ */
+class RuntimeWeighted {
+private:
+    bool m_weighted;    ///< True if the graph is weighted.
+
+public:
+    static constexpr bool storesWeights = true;     ///< True if edge storage has a weight field.
+
+    /**
+     * @brief Constructs the policy.
+     * @param weighted True if the graph should be weighted.
+     */
+    constexpr RuntimeWeighted(bool weighted = true) noexcept : m_weighted(weighted) {}
+
+    /**
+     * @brief Checks if the graph is weighted.
+     * @return The value given at construction.
+     */
+    constexpr bool isWeighted() const noexcept { return m_weighted; }
+};
+
+/**
+ * @brief Calls a function template with the compile-time policies matching two runtime flags.
+ * * Used to build a policy-specialised graph from settings known only at runtime (e.g. in the GUI)
+ * and then handle it through the Graph interface.
+ * @param directed True to select Directed, false for Undirected.
+ * @param weighted True to select Weighted, false for Unweighted.
+ * @param fn Generic callable invoked as `fn.template operator()<DirectionPolicy, WeightPolicy>()`.
+ * @return Whatever @p fn returns.
+ */
+template <typename Fn>
+decltype(auto) dispatchPolicies(bool directed, bool weighted, Fn&& fn) {
+    if (directed) {
+        if (weighted) return fn.template operator()<Directed, Weighted>();
+        return fn.template operator()<Directed, Unweighted>();
+    }
+    if (weighted) return fn.template operator()<Undirected, Weighted>();
+    return fn.template operator()<Undirected, Unweighted>();
+}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+/**
+* @file SpscQueue.h
+ * @brief Bounded lock-free queue connecting exactly one producer thread to one consumer thread.
+ */
+
+#pragma once
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+namespace Core {
+
+/**
+ * @brief Fixed-capacity ring buffer for a single producer and a single consumer.
+ * * Only the producer writes m_tail and only the consumer writes m_head. Each side publishes its index
+ * with a release store and reads the other one with an acquire load, so elements are handed over
+ * without locks or read-modify-write instructions. The two indices live on separate cache lines, and
+ * each side keeps a private copy of the other's index that it refreshes only when the queue looks full
+ * (or empty), so the shared lines are touched rarely in steady state.
+ * @tparam T The element type; it must be default constructible and copy assignable.
+ */
+template <typename T>
+class SpscQueue {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;  ///< Assumed cache line size, used to separate the indices.
+
+    std::vector<T> m_slots;                                ///< The ring storage; its size is a power of two.
+    std::size_t m_mask;                                    ///< m_slots.size() - 1, maps an index to a slot.
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{0}; ///< Count of popped elements, written by the consumer.
+    std::size_t m_cachedTail = 0;                          ///< The consumer's last observed value of m_tail.
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{0}; ///< Count of pushed elements, written by the producer.
+    std::size_t m_cachedHead = 0;                          ///< The producer's last observed value of m_head.
+
+public:
+    /**
+     * @brief Constructs an empty queue.
+     * @param capacity The minimum number of elements the queue can hold, rounded up to a power of two.
+     */
+    explicit SpscQueue(std::size_t capacity) {
+        std::size_t slots = 2;
+        while (slots < capacity) slots *= 2;
+        m_slots.resize(slots);
+        m_mask = slots - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Appends an element. Producer thread only.
+     * @param value The element to append.
+     * @return True if appended, false if the queue is full.
+     */
+    bool tryPush(const T& value) {
+        std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == m_slots.size()) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == m_slots.size()) return false;
+        }
+        m_slots[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element. Consumer thread only.
+     * @param out Receives the element.
+     * @return True if an element was removed, false if the queue is empty.
+     */
+    bool tryPop(T& out) {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) return false;
+        }
+        out = m_slots[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes every element available at the time of the call and passes each to a function. Consumer thread only.
+     * * The consumed slots are released to the producer once, after the last call to @p fn.
+     * @param fn Function invoked with a const T& for each element, oldest first.
+     * @param maxCount Upper bound on the number of elements to remove.
+     * @return The number of elements removed.
+     */
+    template <typename Fn>
+    std::size_t drain(Fn&& fn, std::size_t maxCount = std::numeric_limits<std::size_t>::max()) {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        std::size_t available = m_cachedTail - head;
+        std::size_t count = available < maxCount ? available : maxCount;
+        for (std::size_t i = 0; i < count; ++i) fn(static_cast<const T&>(m_slots[(head + i) & m_mask]));
+        if (count > 0) m_head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Checks if the queue holds no element. Exact only when called by the consumer.
+     * @return True if empty.
+     */
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the maximum number of elements the queue can hold.
+     * @return The capacity, a power of two.
+     */
+    std::size_t capacity() const { return m_slots.size(); }
+};
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/**
+ * @file ThreadPool.h
+ * @brief Fixed set of worker threads that split index ranges between themselves and steal chunks when idle.
+ */
+
+#pragma once
+#include "FunctionRef.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core {
+
+/**
+ * @brief Pool of threads that run parallel loops over index ranges.
+ * * parallelFor() cuts the range into one contiguous slice per thread. Each thread claims chunks of
+ * its own slice from the front with a fetch_add on the slice's cursor; a thread that runs out visits
+ * the other slices and claims their remaining chunks the same way, so uneven work is balanced without
+ * a central queue. Cursors live on separate cache lines and are only shared while stealing.
+ * * The calling thread takes part as participant 0, so a pool of N threads starts N - 1 workers.
+ * Loops submitted from different threads run one after another. A loop body must not call
+ * parallelFor() on the same pool.
+ */
+class ThreadPool {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;  ///< Assumed cache line size, used to separate the cursors.
+
+    /**
+     * @brief The part of the current range first assigned to one participant.
+     */
+    struct alignas(CACHE_LINE) Slice {
+        std::atomic<std::size_t> next{0};  ///< First index not claimed yet.
+        std::size_t end = 0;               ///< One past the last index of the slice.
+    };
+
+    std::vector<std::jthread> m_workers;   ///< The started threads, participants 1 to N - 1.
+    std::unique_ptr<Slice[]> m_slices;     ///< One slice per participant.
+    std::size_t m_participants;            ///< Number of threads running a loop, including the caller.
+
+    std::mutex m_submit;                   ///< Serializes parallelFor() calls from different threads.
+    std::mutex m_mutex;                    ///< Guards the fields below.
+    std::condition_variable m_wake;        ///< Signals workers that a loop is ready or the pool is closing.
+    std::condition_variable m_idle;        ///< Signals the caller that every worker left the loop.
+    std::size_t m_generation = 0;          ///< Incremented for every loop, so workers can tell a new one.
+    std::size_t m_busy = 0;                ///< Workers still running the current loop.
+    bool m_closing = false;                ///< Set by the destructor.
+
+    FunctionRef<void(std::size_t, std::size_t, std::size_t)>* m_body = nullptr; ///< Body of the current loop.
+    std::size_t m_grain = 1;               ///< Chunk size of the current loop.
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threads The number of participants including the caller; 0 uses the hardware concurrency.
+     */
+    explicit ThreadPool(std::size_t threads = 0) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        m_participants = threads;
+        m_slices = std::make_unique<Slice[]>(threads);
+        m_workers.reserve(threads - 1);
+        for (std::size_t id = 1; id < threads; ++id) {
+            m_workers.emplace_back([this, id] { work(id); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Wakes the workers so they exit, and joins them.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closing = true;
+        }
+        m_wake.notify_all();
+        m_workers.clear();
+    }
+
+    /**
+     * @brief Gets the pool shared by the whole program, sized to the hardware concurrency.
+     * @return The shared pool, created on first use.
+     */
+    static ThreadPool& shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Gets the number of threads that run a loop, including the caller.
+     * @return The participant count.
+     */
+    std::size_t getThreadCount() const { return m_participants; }
+
+    /**
+     * @brief Runs a body over [0, count) in chunks, in parallel, and returns when every chunk is done.
+     * * Ranges of at most one chunk run on the calling thread without waking the workers.
+     * @param count The number of indices.
+     * @param grain The maximum number of indices per chunk, at least 1.
+     * @param body Called as body(begin, end, participant) for each chunk; participant is below getThreadCount()
+     * and identifies the calling thread, so it can index per-thread buffers.
+     */
+    void parallelFor(std::size_t count, std::size_t grain, FunctionRef<void(std::size_t, std::size_t, std::size_t)> body) {
+        if (count == 0) return;
+        grain = std::max<std::size_t>(grain, 1);
+        if (count <= grain || m_participants == 1) {
+            for (std::size_t begin = 0; begin < count; begin += grain) body(begin, std::min(count, begin + grain), 0);
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(m_submit);
+        std::size_t share = (count + m_participants - 1) / m_participants;
+        for (std::size_t id = 0; id < m_participants; ++id) {
+            std::size_t begin = std::min(count, id * share);
+            m_slices[id].next.store(begin, std::memory_order_relaxed);
+            m_slices[id].end = std::min(count, begin + share);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_body = &body;
+            m_grain = grain;
+            m_busy = m_workers.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        runChunks(0, body, grain);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_busy == 0; });
+        m_body = nullptr;
+    }
+
+private:
+    /**
+     * @brief The loop of a worker thread: wait for a loop, run chunks, report back.
+     * @param id The participant index of the worker.
+     */
+    void work(std::size_t id) {
+        std::size_t seen = 0;
+        while (true) {
+            FunctionRef<void(std::size_t, std::size_t, std::size_t)>* body;
+            std::size_t grain;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_closing || m_generation != seen; });
+                if (m_closing) return;
+                seen = m_generation;
+                body = m_body;
+                grain = m_grain;
+            }
+            runChunks(id, *body, grain);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_busy > 0) continue;
+            }
+            m_idle.notify_one();
+        }
+    }
+
+    /**
+     * @brief Claims and runs chunks from the participant's own slice, then from the others' slices.
+     * @param id The participant index of the calling thread.
+     * @param body The loop body.
+     * @param grain The chunk size.
+     */
+    void runChunks(std::size_t id, FunctionRef<void(std::size_t, std::size_t, std::size_t)>& body, std::size_t grain) {
+        for (std::size_t offset = 0; offset < m_participants; ++offset) {
+            Slice& slice = m_slices[(id + offset) % m_participants];
+            while (true) {
+                std::size_t begin = slice.next.fetch_add(grain, std::memory_order_relaxed);
+                if (begin >= slice.end) break;
+                body(begin, std::min(slice.end, begin + grain), id);
+            }
+        }
+    }
+};
+}
@@ -16,6 +16,9 @@ namespace Core {
         int m_id = -1;           ///< The unique identifier of the vertex.
         std::string m_name;      ///< The display name or label of the vertex.
         bool m_active = true;    ///< Flag indicating whether the vertex is active (exists in the graph).
+        double m_x = 0.0;        ///< Horizontal layout coordinate, valid if m_hasPosition.
+        double m_y = 0.0;        ///< Vertical layout coordinate, valid if m_hasPosition.
+        bool m_hasPosition = false; ///< Flag indicating whether a layout position has been stored.
 
     public:
         /**
@@ -73,5 +76,34 @@ namespace Core {
          * @brief Marks the vertex as active.
          */
         void markActive() { m_active = true; }
+
+        /**
+         * @brief Checks if a layout position has been stored for the vertex.
+         * @return True if setPosition() has been called.
+         */
+        bool hasPosition() const { return m_hasPosition; }
+
+        /**
+         * @brief Gets the horizontal layout coordinate.
+         * @return The x coordinate, 0 if no position is stored.
+         */
+        double getX() const { return m_x; }
+
+        /**
+         * @brief Gets the vertical layout coordinate.
+         * @return The y coordinate, 0 if no position is stored.
+         */
+        double getY() const { return m_y; }
+
+        /**
+         * @brief Stores the layout position of the vertex, used by geometric heuristics.
+         * @param x The horizontal coordinate.
+         * @param y The vertical coordinate.
+         */
+        void setPosition(double x, double y) {
+            m_x = x;
+            m_y = y;
+            m_hasPosition = true;
+        }
     };
 }
\ No newline at end of file
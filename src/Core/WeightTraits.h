@@ -0,0 +1,51 @@
+/**
+* @file WeightTraits.h
+ * @brief Properties of the arithmetic types usable as edge weights.
+ */
+
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Core {
+
+/**
+ * @brief Describes an edge weight type and the type used to accumulate path lengths over it.
+ * * Integer weights accumulate in 64-bit integers so that shortest-path searches compare integers
+ * and a sum of many 32-bit weights cannot overflow; floating-point weights accumulate in at least double.
+ * The largest representable distance stands in for infinity when the type has no infinity.
+ * @tparam TWeight The arithmetic type of the edge weight.
+ */
+template <typename TWeight>
+struct WeightTraits {
+    static_assert(std::is_arithmetic_v<TWeight>, "Edge weights must be arithmetic");
+
+    /**
+     * @brief The type of a sum of weights.
+     */
+    using Distance = std::conditional_t<std::is_integral_v<TWeight>,
+                                        std::conditional_t<std::is_signed_v<TWeight>, std::int64_t, std::uint64_t>,
+                                        decltype(TWeight{} + 0.0)>;
+
+    static constexpr bool isIntegral = std::is_integral_v<TWeight>;  ///< True if weights and distances are integers.
+
+    /**
+     * @brief Gets the distance of an unreachable vertex.
+     * @return Infinity for floating-point distances, the largest value for integers.
+     */
+    static constexpr Distance infinity() {
+        if constexpr (std::numeric_limits<Distance>::has_infinity) return std::numeric_limits<Distance>::infinity();
+        else return std::numeric_limits<Distance>::max();
+    }
+
+    /**
+     * @brief Gets the weight reported for an edge between vertices that do not exist.
+     * @return Infinity for floating-point weights, the largest value for integers.
+     */
+    static constexpr TWeight missing() {
+        if constexpr (std::numeric_limits<TWeight>::has_infinity) return std::numeric_limits<TWeight>::infinity();
+        else return std::numeric_limits<TWeight>::max();
+    }
+};
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <QPushButton>
 #include <QComboBox>
 #include <QSlider>
+#include <QProgressBar>
 #include <QVariant>
 #include <cmath>
 #include <algorithm>
@@ -20,6 +21,10 @@ ControlPanel::ControlPanel(QWidget* parent)
     ui->algorithmComboBox->addItem("BFS", QVariant::fromValue(AlgorithmType::BFS));
     ui->algorithmComboBox->addItem("DFS", QVariant::fromValue(AlgorithmType::DFS));
     ui->algorithmComboBox->addItem("Dijkstra", QVariant::fromValue(AlgorithmType::Dijkstra));
+    ui->algorithmComboBox->addItem("Bidirectional BFS", QVariant::fromValue(AlgorithmType::BidirectionalBFS));
+    ui->algorithmComboBox->addItem("Bidirectional Dijkstra", QVariant::fromValue(AlgorithmType::BidirectionalDijkstra));
+    ui->algorithmComboBox->addItem("A*", QVariant::fromValue(AlgorithmType::AStar));
+    ui->algorithmComboBox->addItem("Delta-stepping", QVariant::fromValue(AlgorithmType::DeltaStepping));
 
     QStringList exportFormats = {"PNG", "SVG", "DOT", "PDF", "JSON", "JPEG"};
     ui->exportFormatComboBox->addItems(exportFormats);
@@ -42,12 +47,14 @@ ControlPanel::ControlPanel(QWidget* parent)
     connect(ui->prevButton, &QPushButton::clicked, this, &ControlPanel::prevClicked);
     connect(ui->playButton, &QPushButton::clicked, this, &ControlPanel::onPlayAlgorithmClicked);
     connect(ui->pauseButton, &QPushButton::clicked, this, &ControlPanel::onPauseAlgorithmClicked);
+    connect(ui->cancelButton, &QPushButton::clicked, this, &ControlPanel::cancelAlgorithmClicked);
     connect(ui->speedSlider, &QSlider::valueChanged, this, &ControlPanel::onSpeedSliderChanged);
     connect(ui->algorithmComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &ControlPanel::onAlgorithmChanged);
 
     setGraphEditingEnabled(false);
     setAlgorithmControlsEnabled(false);
     setExportEnabled(false);
+    setRunInProgress(false);
     onSpeedSliderChanged(ui->speedSlider->value());
 }
 
@@ -113,12 +120,22 @@ void ControlPanel::resetPlayerControls() {
     ui->algorithmBox->setEnabled(true);
 }
 
+void ControlPanel::setRunInProgress(bool running) {
+    ui->progressBar->setVisible(running);
+    ui->cancelButton->setVisible(running);
+    if (running) ui->progressBar->setValue(0);
+}
+
+void ControlPanel::setRunProgress(double fraction) {
+    ui->progressBar->setValue(static_cast<int>(std::lround(std::clamp(fraction, 0.0, 1.0) * 100)));
+}
+
 void ControlPanel::onStartAlgorithmClicked() {
     if (ui->startVertexComboBox->count() == 0) return;
 
     int startId = ui->startVertexComboBox->currentData().toInt();
     AlgorithmType type = ui->algorithmComboBox->currentData().value<AlgorithmType>();
-    int endId = (type == AlgorithmType::Dijkstra) ? ui->endVertexComboBox->currentData().toInt() : -1;
+    int endId = usesTargetVertex(type) ? ui->endVertexComboBox->currentData().toInt() : -1;
 
     ui->setupGraphButton->setEnabled(false);
     ui->graphEditBox->setEnabled(false);
@@ -159,10 +176,10 @@ void ControlPanel::onResetClicked() {
 
 void ControlPanel::onAlgorithmChanged(int index) {
     AlgorithmType type = ui->algorithmComboBox->itemData(index).value<AlgorithmType>();
-    bool isDijkstra = (type == AlgorithmType::Dijkstra);
+    bool hasTarget = usesTargetVertex(type);
 
-    ui->endVertexLabel->setVisible(isDijkstra);
-    ui->endVertexComboBox->setVisible(isDijkstra);
+    ui->endVertexLabel->setVisible(hasTarget);
+    ui->endVertexComboBox->setVisible(hasTarget);
 
     emit algorithmChanged(type);
 }
@@ -62,6 +62,18 @@ public:
      */
     void resetPlayerControls();
 
+    /**
+     * @brief Shows or hides the progress bar and cancel button of a background algorithm run.
+     * @param running True while the algorithm is still producing steps.
+     */
+    void setRunInProgress(bool running);
+
+    /**
+     * @brief Updates the progress bar of a background algorithm run.
+     * @param fraction The estimated progress, between 0 and 1.
+     */
+    void setRunProgress(double fraction);
+
     /** @name Control Buttons Getters */
     ///@{
     QPushButton* getNextButton() const;
@@ -76,6 +88,7 @@ signals:
     ///@{
     void startAlgorithmClicked(int startId, int endId);
     void pauseAlgorithmClicked();
+    void cancelAlgorithmClicked();
     void playAlgorithmClicked();
     void speedChanged(int speed);
     void resetClicked();
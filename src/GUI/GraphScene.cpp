@@ -47,6 +47,19 @@ VertexItem* GraphScene::addVertexItem(int id, const QString& label) {
     return item;
 }
 
+void GraphScene::addItemsBatch(const std::vector<std::pair<int, QString>>& vertices,
+                               const std::vector<Core::Edge>& edges, bool isDirected, bool isWeighted) {
+    ItemIndexMethod previousIndex = itemIndexMethod();
+    setItemIndexMethod(QGraphicsScene::NoIndex);
+    m_vertexItems.reserve(m_vertexItems.size() + vertices.size());
+    m_edgeItems.reserve(m_edgeItems.size() + edges.size());
+
+    for (const auto& [id, label] : vertices) addVertexItem(id, label);
+    for (const auto& e : edges) addEdgeItem(e.m_source, e.m_destination, e.m_weight, isDirected, isWeighted);
+
+    setItemIndexMethod(previousIndex);
+}
+
 void GraphScene::removeVertexItem(int id) {
     auto it = m_vertexItems.find(id);
     if (it != m_vertexItems.end()) {
@@ -6,6 +6,9 @@
 #pragma once
 #include <QGraphicsScene>
 #include <unordered_map>
+#include <vector>
+#include <utility>
+#include "Edge.h"
 #include "VertexItem.h"
 #include "EdgeItem.h"
 
@@ -71,6 +74,18 @@ public:
      */
     EdgeItem* addEdgeItem(int fromId, int toId, double weight, bool isDirected, bool isWeighted);
 
+    /**
+     * @brief Adds many vertices and edges in a single pass.
+     * * Item indexing is suspended while the items are inserted and the lookup maps are reserved up front,
+     * so loading a large graph does not rebuild the scene index after every insertion.
+     * @param vertices Pairs of vertex ID and label to add, in placement order.
+     * @param edges The edges to add; edges whose endpoints have no item are skipped.
+     * @param isDirected Whether the edges should display an arrowhead.
+     * @param isWeighted Whether the edges should display their weight text.
+     */
+    void addItemsBatch(const std::vector<std::pair<int, QString>>& vertices, const std::vector<Core::Edge>& edges,
+                       bool isDirected, bool isWeighted);
+
     /**
      * @brief Removes a visual vertex from the scene by its ID.
      * @param id The ID of the vertex to remove.
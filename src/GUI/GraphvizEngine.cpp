@@ -62,16 +62,14 @@ Agraph_t* GraphvizEngine::createGvGraph(const Core::Graph<Core::Vertex>* graph)
     }
 
     for (const auto& e : graph->getEdges()) {
-        if (e.isActive()) {
-            Agnode_t* src = vertexMap.value(e.getSource(), nullptr);
-            Agnode_t* dst = vertexMap.value(e.getDestination(), nullptr);
-
-            if (src && dst) {
-                Agedge_t* edge = agedge(g, src, dst, nullptr, 1);
-                if (graph->isWeighted()) {
-                    std::string s_weight = QString::number(e.getWeight(), 'f', 1).toStdString();
-                    agsafeset(edge, const_cast<char*>("label"), const_cast<char*>(s_weight.c_str()), const_cast<char*>(""));
-                }
+        Agnode_t* src = vertexMap.value(e.getSource(), nullptr);
+        Agnode_t* dst = vertexMap.value(e.getDestination(), nullptr);
+
+        if (src && dst) {
+            Agedge_t* edge = agedge(g, src, dst, nullptr, 1);
+            if (graph->isWeighted()) {
+                std::string s_weight = QString::number(e.getWeight(), 'f', 1).toStdString();
+                agsafeset(edge, const_cast<char*>("label"), const_cast<char*>(s_weight.c_str()), const_cast<char*>(""));
             }
         }
     }
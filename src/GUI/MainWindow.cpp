@@ -50,6 +50,8 @@ MainWindow::MainWindow(QWidget* parent)
     m_graphicsView->centerOn(0, 0);
     m_algoController = std::make_unique<AlgorithmController<Vertex>>();
     m_playTimer = new QTimer(this);
+    m_pollTimer = new QTimer(this);
+    m_pollTimer->setInterval(30);
     m_graphvizEngine = std::make_unique<GraphvizEngine>();
 
     createMenus();
@@ -67,11 +69,13 @@ MainWindow::MainWindow(QWidget* parent)
     connect(m_controlPanel, &ControlPanel::startAlgorithmClicked, this, &MainWindow::onStartAlgorithm);
     connect(m_controlPanel, &ControlPanel::playAlgorithmClicked, this, &MainWindow::onPlayClicked);
     connect(m_controlPanel, &ControlPanel::pauseAlgorithmClicked, this, &MainWindow::onPauseClicked);
+    connect(m_controlPanel, &ControlPanel::cancelAlgorithmClicked, this, &MainWindow::onCancelAlgorithm);
     connect(m_controlPanel, &ControlPanel::nextClicked, this, &MainWindow::nextStep);
     connect(m_controlPanel, &ControlPanel::prevClicked, this, &MainWindow::prevStep);
     connect(m_controlPanel, &ControlPanel::resetClicked, this, &MainWindow::resetAlgorithm);
     connect(m_controlPanel, &ControlPanel::speedChanged, this, &MainWindow::onSpeedChanged);
     connect(m_playTimer, &QTimer::timeout, this, &MainWindow::nextStep);
+    connect(m_pollTimer, &QTimer::timeout, this, &MainWindow::onPollAlgorithm);
 
     setCentralWidget(m_graphicsView);
     setWindowTitle("Algorithm Visualiser");
@@ -92,7 +96,10 @@ void MainWindow::createGraph(bool directed, bool weighted) {
     }
 
     m_scene->clearScene();
-    m_graph = std::make_unique<AdjacencyList<Vertex>>(directed, weighted);
+    m_graph = makeAdjacencyList<Vertex>(directed, weighted, [](auto& list) {
+        list.setInEdgeIndexEnabled(true);
+        list.setEdgeIndexEnabled(true);
+    });
 
     m_graph->addObserver(this);
     m_algoController->setGraph(m_graph.get());
@@ -104,15 +111,18 @@ void MainWindow::createGraph(bool directed, bool weighted) {
 }
 
 void MainWindow::onVertexAdded(int id) {
+    m_algoController->graphChanged();
     const Vertex* v = m_graph->getVertex(id);
     if (v) m_scene->addVertexItem(id, QString::fromStdString(v->getName()));
 }
 
 void MainWindow::onVertexRemoved(int id) {
+    m_algoController->graphChanged();
     m_scene->removeVertexItem(id);
 }
 
 void MainWindow::onEdgeAdded(int from, int to, double weight) {
+    m_algoController->graphChanged();
     if (!m_graph->isDirected()) {
         if (m_scene->getEdgeItem(to, from)) return;
     }
@@ -120,6 +130,7 @@ void MainWindow::onEdgeAdded(int from, int to, double weight) {
 }
 
 void MainWindow::onEdgeRemoved(int from, int to) {
+    m_algoController->graphChanged();
     m_scene->removeEdgeItem(from, to);
     if (!m_graph->isDirected()) {
         m_scene->removeEdgeItem(to, from);
@@ -127,9 +138,32 @@ void MainWindow::onEdgeRemoved(int from, int to) {
 }
 
 void MainWindow::onGraphCleared() {
+    m_algoController->graphChanged();
     m_scene->clearScene();
 }
 
+void MainWindow::onBatchApplied(const GraphBatch& batch) {
+    m_algoController->graphChanged();
+    if (batch.cleared) onGraphCleared();
+    for (const auto& e : batch.removedEdges) onEdgeRemoved(e.m_source, e.m_destination);
+    for (int id : batch.removedVertices) onVertexRemoved(id);
+
+    std::vector<std::pair<int, QString>> vertices;
+    vertices.reserve(batch.addedVertices.size());
+    for (int id : batch.addedVertices) {
+        if (const Vertex* v = m_graph->getVertex(id)) vertices.emplace_back(id, QString::fromStdString(v->getName()));
+    }
+
+    bool directed = m_graph->isDirected();
+    std::vector<Edge> edges;
+    edges.reserve(batch.addedEdges.size());
+    for (const auto& e : batch.addedEdges) {
+        if (!directed && (e.m_source > e.m_destination || m_scene->getEdgeItem(e.m_destination, e.m_source))) continue;
+        edges.push_back(e);
+    }
+    m_scene->addItemsBatch(vertices, edges, directed, m_graph->isWeighted());
+}
+
 void MainWindow::setupGraph() {
     onPauseClicked();
     GraphSetupDialog dialog(this);
@@ -138,21 +172,21 @@ void MainWindow::setupGraph() {
         GraphSettings settings = dialog.getSettings();
         createGraph(settings.directed, settings.weighted);
 
-        int vertexCount = dialog.getVertexCount();
-        for (int i = 0; i < vertexCount; ++i) {
-            m_graph->addVertex(std::make_unique<Vertex>(""));
-        }
+        m_graph->beginBatch();
+        m_graph->addVertices(dialog.getVertexCount());
 
-        auto edges = dialog.getEdges();
-        for (const auto& edgeTuple : edges) {
+        auto edgeTuples = dialog.getEdges();
+        std::vector<Edge> edges;
+        edges.reserve(edgeTuples.size());
+        for (const auto& edgeTuple : edgeTuples) {
             int fromId = std::get<0>(edgeTuple);
             int toId = std::get<1>(edgeTuple);
             double weight = settings.weighted ? std::get<2>(edgeTuple) : 1.0;
 
-            if (fromId != toId && m_graph->hasVertex(fromId) && m_graph->hasVertex(toId) && !m_graph->hasEdge(fromId, toId)) {
-                m_graph->addEdge(fromId, toId, weight);
-            }
+            if (fromId != toId) edges.emplace_back(fromId, toId, weight);
         }
+        m_graph->addEdges(edges);
+        m_graph->endBatch();
         updateGraphUI();
         onApplyLayout();
     } else if (!m_graph) {
@@ -274,8 +308,8 @@ void MainWindow::updateGraphUI() {
 }
 
 void MainWindow::onAlgorithmChanged(AlgorithmType type) {
-    if (type == AlgorithmType::Dijkstra && m_graph && !m_graph->isWeighted()) {
-        QMessageBox::information(this, "Info", "Dijkstra's algorithm is better used on a weighted graph.");
+    if (reportsDistances(type) && m_graph && !m_graph->isWeighted()) {
+        QMessageBox::information(this, "Info", "Shortest-path algorithms are better used on a weighted graph.");
     }
     m_algoController->setAlgorithm(type);
     resetAlgorithm();
@@ -286,21 +320,59 @@ void MainWindow::onStartAlgorithm(int startVertexId, int endVertexId) {
     resetAlgorithmStyles();
     m_algoController->reset();
 
-    if (m_algoController->start(startVertexId, endVertexId, m_currentState)) {
-        applyState(m_currentState);
+    // A* estimates distances from the layout, so store the current positions in the graph.
+    bool moved = false;
+    for (int id = 0; id < m_graph->getVertexCount(); ++id) {
+        Vertex* v = m_graph->getVertex(id);
+        VertexItem* vItem = m_scene->getVertexItem(id);
+        if (!v || !vItem) continue;
+        QPointF pos = vItem->pos();
+        if (v->hasPosition() && v->getX() == pos.x() && v->getY() == pos.y()) continue;
+        v->setPosition(pos.x(), pos.y());
+        moved = true;
+    }
+    if (moved) m_algoController->graphChanged();
+
+    if (m_algoController->startInBackground(startVertexId, endVertexId)) {
+        m_currentState = AlgoState();
         m_controlPanel->getPrevButton()->setEnabled(false);
         m_controlPanel->getNextButton()->setEnabled(true);
         m_controlPanel->getPlayButton()->setEnabled(true);
+        m_controlPanel->setRunInProgress(true);
+        m_pollTimer->start();
+        onPollAlgorithm();
     } else {
         QMessageBox::warning(this, "Error", "Algorithm failed to start.");
         resetAlgorithm();
     }
 }
 
+void MainWindow::onPollAlgorithm() {
+    bool hadSteps = m_algoController->getStepCount() > 0;
+    m_algoController->poll();
+    if (!hadSteps && m_algoController->seek(0, m_currentState)) {
+        applyState(m_currentState);
+    }
+
+    m_controlPanel->setRunProgress(m_algoController->getProgress());
+    if (!m_algoController->isRunningInBackground()) {
+        m_pollTimer->stop();
+        m_controlPanel->setRunInProgress(false);
+    }
+}
+
+void MainWindow::onCancelAlgorithm() {
+    m_algoController->cancel();
+    onPollAlgorithm();
+}
+
 void MainWindow::nextStep() {
     if (m_algoController->nextStep(m_currentState)) {
         applyState(m_currentState);
         m_controlPanel->getPrevButton()->setEnabled(true);
+    } else if (!m_algoController->isComplete()) {
+        // The background run has not produced the next step yet; playback retries on the next tick.
+        return;
     } else {
         if (m_playTimer->isActive()) onPauseClicked();
         applyState(m_currentState);
@@ -324,7 +396,9 @@ void MainWindow::prevStep() {
 
 void MainWindow::resetAlgorithm() {
     onPauseClicked();
+    m_pollTimer->stop();
     m_algoController->reset();
+    m_controlPanel->setRunInProgress(false);
     resetAlgorithmStyles();
     m_currentState = AlgoState();
     m_controlPanel->resetPlayerControls();
@@ -367,9 +441,9 @@ void MainWindow::applyState(const AlgoState& state) {
     const QColor treeEdgeColor(QColor(0, 100, 0));
     const QColor pathColor(Qt::magenta);
 
-    bool isDijkstra = (m_algoController->getAlgorithm() == AlgorithmType::Dijkstra);
+    bool showDistances = reportsDistances(m_algoController->getAlgorithm());
 
-    if (isDijkstra && !state.distances.empty()) {
+    if (showDistances && !state.distances.empty()) {
         for (const auto* v : m_graph->getVertices()) {
             if (v && v->isActive() && v->getId() < static_cast<int>(state.distances.size())) {
                 VertexItem* vItem = m_scene->getVertexItem(v->getId());
@@ -377,6 +451,10 @@ void MainWindow::applyState(const AlgoState& state) {
                     double dist = state.distances[v->getId()];
                     if (dist == std::numeric_limits<double>::infinity()) {
                         vItem->setDistanceText("<b>&infin;</b>");
+                    } else if (v->getId() < static_cast<int>(state.estimates.size())
+                               && state.estimates[v->getId()] != std::numeric_limits<double>::infinity()) {
+                        vItem->setDistanceText(QString("<b>%1</b> (f %2)").arg(QString::number(dist, 'f', 1),
+                                               QString::number(state.estimates[v->getId()], 'f', 1)));
                     } else {
                         vItem->setDistanceText(QString("<b>%1</b>").arg(QString::number(dist, 'f', 1)));
                     }
@@ -78,6 +78,13 @@ public:
      */
     void onGraphCleared() override;
 
+    /**
+     * @brief Callback invoked once at the end of a batch of graph modifications.
+     * * Removals are applied first, then all new vertex and edge items are built in one pass.
+     * @param batch The net changes made during the batch.
+     */
+    void onBatchApplied(const Core::GraphBatch& batch) override;
+
 private slots:
     /**
      * @brief Opens a dialog to setup initial graph properties and applies them.
@@ -117,6 +124,17 @@ private slots:
      */
     void onStartAlgorithm(int startVertexId, int endVertexId);
 
+    /**
+     * @brief Collects the steps produced by the background algorithm run and updates its progress.
+     * * Shows the first step as soon as it arrives and hides the progress indicator once the run is over.
+     */
+    void onPollAlgorithm();
+
+    /**
+     * @brief Stops the background algorithm run, keeping the steps produced so far.
+     */
+    void onCancelAlgorithm();
+
     /**
      * @brief Advances the algorithm visualization by one step.
      */
@@ -198,12 +216,13 @@ private:
     QGraphicsView* m_graphicsView;                                          ///< Pointer to the graphics view displaying the graph.
     GraphScene* m_scene;                                                    ///< Pointer to the custom QGraphicsScene managing graph items.
 
-    std::unique_ptr<Core::AdjacencyList<Core::Vertex>> m_graph;             ///< Underlying graph data structure.
+    std::unique_ptr<Core::Graph<Core::Vertex>> m_graph;                     ///< Underlying graph data structure, specialised for its settings.
     std::unique_ptr<Algorithms::AlgorithmController<Core::Vertex>> m_algoController; ///< Controller managing algorithm steps.
     std::unique_ptr<GraphvizEngine> m_graphvizEngine;                       ///< Engine for graph layout and exporting.
 
     AlgoState m_currentState;                                               ///< The current step state of an executing algorithm.
     QTimer* m_playTimer;                                                    ///< Timer governing the automatic algorithm playback.
+    QTimer* m_pollTimer;                                                    ///< Timer collecting steps from the background algorithm run.
     int m_playSpeedMs;                                                      ///< Current interval between algorithm steps in milliseconds.
     QString m_currentExportDir;                                             ///< Directory where graph exports are saved.
 };
\ No newline at end of file
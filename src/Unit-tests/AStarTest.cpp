@@ -0,0 +1,197 @@
+/**
+ * @file AStarTest.cpp
+ * @brief Unit tests for the A* search and its coordinate heuristics.
+ */
+
+#include "doctest.h"
+#include "AStar.h"
+#include "Dijkstra.h"
+#include "AlgorithmController.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to count the vertices a run settles.
+ * @param algorithm The algorithm to run.
+ * @param g The graph to search.
+ * @param start The start vertex.
+ * @param target The target vertex.
+ * @return The number of Visiting events.
+ */
+template <typename TAlgorithm, typename TGraph>
+static int countVisits(TAlgorithm& algorithm, const TGraph& g, int start, int target) {
+    int visits = 0;
+    auto count = [&](const AlgorithmEvent& e) { visits += e.type == EventType::Visiting; };
+    REQUIRE(algorithm.run(&g, start, target, count));
+    return visits;
+}
+
+/**
+ * @brief Test suite for A*.
+ */
+TEST_SUITE("AStar") {
+    /**
+     * @brief Checks the layout distances and the scale that keeps them below the edge weights.
+     */
+    TEST_CASE("Coordinate heuristics and consistency") {
+        AdjacencyList<Vertex> g(true, true);
+        g.addVertices(3);
+        g.getVertex(0)->setPosition(0, 0);
+        g.getVertex(1)->setPosition(3, 4);
+        g.getVertex(2)->setPosition(3, 0);
+        g.addEdge(0, 1, 10.0);
+        g.addEdge(1, 2, 2.0);
+
+        CHECK(layoutDistance(g.getVertex(0), g.getVertex(1), HeuristicMetric::Euclidean) == 5.0);
+        CHECK(layoutDistance(g.getVertex(0), g.getVertex(1), HeuristicMetric::Manhattan) == 7.0);
+        CHECK(consistentScale(g, HeuristicMetric::Euclidean) == 0.5);
+        CHECK(consistentScale(g, HeuristicMetric::Manhattan) == 0.5);
+
+        auto consistent = makeCoordinateHeuristic(HeuristicMetric::Euclidean, 0.5);
+        auto inflated = makeCoordinateHeuristic(HeuristicMetric::Euclidean, 2.0);
+        CHECK(consistent(g, 0, 2) == 1.5);
+        CHECK(isConsistent(g, consistent, 2));
+        CHECK_FALSE(isConsistent(g, inflated, 2));
+        CHECK_FALSE(isConsistent(g, consistent, 7));
+
+        AdjacencyList<Vertex> unplaced(true, true);
+        unplaced.addVertices(2);
+        unplaced.addEdge(0, 1, 3.0);
+        CHECK(consistentScale(unplaced, HeuristicMetric::Euclidean) == 1.0);
+        CHECK(makeCoordinateHeuristic(HeuristicMetric::Euclidean)(unplaced, 0, 1) == 0.0);
+    }
+
+    /**
+     * @brief Checks that A* finds the Dijkstra distance with both metrics, on a list and its CSR snapshot.
+     */
+    TEST_CASE("A* matches Dijkstra on a positioned grid") {
+        const int side = 30;
+        AdjacencyList<Vertex> g(false, true);
+        fillGrid(g, side, 7, [](std::mt19937& rng) { return 1 + rng() % 5; });
+        CsrGraph<Vertex> csr(g);
+
+        Dijkstra<Vertex> dijkstra;
+        REQUIRE(dijkstra.run(&g, 0));
+        for (HeuristicMetric metric : {HeuristicMetric::Euclidean, HeuristicMetric::Manhattan}) {
+            auto heuristic = makeCoordinateHeuristic(metric, consistentScale(g, metric));
+            AStar<Vertex> astar(heuristic);
+            for (int target : {1, side * side - 1, side * side / 2 + 3, side * 7}) {
+                REQUIRE(isConsistent(g, heuristic, target));
+                REQUIRE(astar.run(&csr, 0, target));
+                CHECK(astar.getWorkspace().getDistance(target) == dijkstra.getWorkspace().getDistance(target));
+                REQUIRE(astar.run(&g, 0, target));
+                CHECK(astar.getWorkspace().getDistance(target) == dijkstra.getWorkspace().getDistance(target));
+            }
+        }
+
+        AStar<Vertex> unguided;
+        REQUIRE(unguided.run(&g, 0));
+        for (int v = 0; v < side * side; ++v) {
+            CHECK(unguided.getWorkspace().getDistance(v) == dijkstra.getWorkspace().getDistance(v));
+        }
+        CHECK_FALSE(unguided.run(&g, -1, 0));
+    }
+
+    /**
+     * @brief Checks that an overestimating heuristic still reaches the target, and that integer estimates round down.
+     */
+    TEST_CASE("Inadmissible heuristic and integer weights") {
+        AdjacencyList<Vertex, Directed, Weighted, std::uint32_t> g;
+        g.addVertices(4);
+        g.addEdge(0, 1, 1);
+        g.addEdge(0, 2, 4);
+        g.addEdge(1, 2, 1);
+        g.addEdge(2, 3, 1);
+
+        Heuristic<Vertex, std::uint32_t> skewed = [](const Graph<Vertex, std::uint32_t>&, int v, int) {
+            return v == 1 ? 10.0 : 0.0;
+        };
+        CHECK_FALSE(isConsistent(g, skewed, 3));
+        AStar<Vertex, std::uint32_t> astar(skewed);
+        REQUIRE(astar.run(&g, 0, 3));
+        CHECK(astar.getWorkspace().getDistance(3) == 5);
+
+        astar.setHeuristic([](const Graph<Vertex, std::uint32_t>&, int v, int) { return v == 3 ? 0.0 : 0.9; });
+        REQUIRE(astar.run(&g, 0, 3));
+        CHECK(astar.getWorkspace().getDistance(3) == 3);
+        CHECK(astar.getSettledCount() == 4);
+    }
+
+    /**
+     * @brief Checks that the heuristic steers the search: far fewer vertices are settled than by Dijkstra.
+     */
+    TEST_CASE("Fewer settled vertices than Dijkstra") {
+        const int side = 60;
+        AdjacencyList<Vertex> g(false, true);
+        g.addVertices(side * side);
+        for (int row = 0; row < side; ++row) {
+            for (int col = 0; col < side; ++col) {
+                int id = row * side + col;
+                g.getVertex(id)->setPosition(col * 10.0, row * 10.0);
+                if (col + 1 < side) g.addEdge(id, id + 1, 1.0);
+                if (row + 1 < side) g.addEdge(id, id + side, 1.0);
+            }
+        }
+        int start = (side / 2) * side + side / 4;
+        int target = (side / 2) * side + 3 * side / 4;
+
+        Dijkstra<Vertex> dijkstra;
+        AStar<Vertex> astar(makeCoordinateHeuristic(HeuristicMetric::Manhattan,
+                                                    consistentScale(g, HeuristicMetric::Manhattan)));
+        int plain = countVisits(dijkstra, g, start, target);
+        int guided = countVisits(astar, g, start, target);
+        CHECK(astar.getWorkspace().getDistance(target) == side / 2);
+        CHECK(guided * 4 < plain);
+        CHECK(static_cast<std::size_t>(guided) == astar.getSettledCount());
+    }
+
+    /**
+     * @brief Checks the controller type: the path is found and the trace carries the f-scores.
+     */
+    TEST_CASE("Controller runs A* and records estimates") {
+        AdjacencyList<Vertex> g(true, true);
+        g.addVertices(5);
+        g.getVertex(0)->setPosition(0, 0);
+        g.getVertex(1)->setPosition(1, 0);
+        g.getVertex(2)->setPosition(2, 0);
+        g.getVertex(3)->setPosition(0, 1);
+        g.getVertex(4)->setPosition(3, 0);
+        g.addEdge(0, 1, 1.0);
+        g.addEdge(1, 2, 1.0);
+        g.addEdge(2, 4, 1.0);
+        g.addEdge(0, 3, 1.0);
+        g.addEdge(3, 4, 5.0);
+
+        CHECK(usesTargetVertex(AlgorithmType::AStar));
+        CHECK(reportsDistances(AlgorithmType::AStar));
+        AlgorithmController<Vertex> controller;
+        controller.setAlgorithm(AlgorithmType::AStar);
+        controller.setGraph(&g);
+        AlgoState state;
+        REQUIRE(controller.start(0, 4, state));
+        CHECK(state.estimates.empty());
+        REQUIRE(controller.seek(1, state));
+        REQUIRE(state.estimates.size() == 5);
+        CHECK(state.estimates[0] == 3.0);
+        CHECK(state.estimates[1] == std::numeric_limits<double>::infinity());
+
+        controller.runToEnd();
+        REQUIRE(controller.seek(controller.getStepCount() - 1, state));
+        std::vector<EdgeId> expected{{0, 1}, {1, 2}, {2, 4}};
+        std::sort(state.shortestPathEdges.begin(), state.shortestPathEdges.end());
+        CHECK(state.shortestPathEdges == expected);
+        CHECK(state.distances[4] == 3.0);
+        CHECK(state.estimates[4] == 3.0);
+        CHECK(state.distances[3] == 1.0);
+    }
+}
\ No newline at end of file
@@ -9,6 +9,9 @@
 #include "Edge.h"
 #include <algorithm>
 #include <memory>
+#include <cstdint>
+#include <limits>
+#include <chrono>
 
 using namespace Core;
 
@@ -194,4 +197,288 @@ TEST_CASE("AdjacencyList: edge weights sum correctness") {
         totalWeight += edge.getWeight();
     }
     CHECK(totalWeight == 55.0);
+}
+
+/**
+ * @brief Tests that removed edges are reclaimed automatically and through the explicit compaction API.
+ */
+TEST_CASE("AdjacencyList: tombstone compaction") {
+    AdjacencyList<Vertex> g(true);
+    int hub = g.addVertex(makeVertex("Hub"));
+    for (int i = 0; i < 8; ++i) {
+        int leaf = g.addVertex(makeVertex(""));
+        g.addEdge(hub, leaf, static_cast<double>(i));
+    }
+
+    /**
+     * @brief Verifies that a row is compacted once tombstones exceed the configured ratio.
+     */
+    SUBCASE("Automatic compaction bounds tombstones") {
+        g.setCompactionRatio(0.5);
+        for (int leaf = 1; leaf <= 4; ++leaf) g.removeEdge(hub, leaf);
+        CHECK(g.getInactiveEdgeCount() == 4);
+
+        g.removeEdge(hub, 5);
+        CHECK(g.getInactiveEdgeCount() == 0);
+        CHECK(g.getNeighbors(hub).size() == 3);
+        CHECK(g.getEdgeWeight(hub, 8) == 7.0);
+    }
+
+    /**
+     * @brief Verifies that compact() and shrinkToFit() report what they reclaimed.
+     */
+    SUBCASE("Explicit compaction reports reclaimed storage") {
+        g.setCompactionRatio(1.0);
+        for (int leaf = 1; leaf <= 6; ++leaf) g.removeEdge(hub, leaf);
+        CHECK(g.getInactiveEdgeCount() == 6);
+
+        CompactionStats stats = g.shrinkToFit();
+        CHECK(stats.removedEdges == 6);
+        CHECK(stats.compactedBytes > 0);
+        CHECK(stats.reclaimedBytes > 0);
+        CHECK(g.getInactiveEdgeCount() == 0);
+        CHECK(g.hasEdge(hub, 7));
+        CHECK(g.hasEdge(hub, 8));
+
+        CHECK(g.compact().removedEdges == 0);
+
+        g.removeEdge(hub, 7);
+        stats = g.compact();
+        CHECK(stats.removedEdges == 1);
+        CHECK(stats.compactedBytes > 0);
+        CHECK(stats.reclaimedBytes == 0);
+    }
+}
+
+/**
+ * @brief Tests incoming-edge queries with and without the reverse index.
+ */
+TEST_CASE("AdjacencyList: in-edge index") {
+    AdjacencyList<Vertex> g(true);
+    int hub = g.addVertex(makeVertex("Hub"));
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    int c = g.addVertex(makeVertex("C"));
+
+    g.addEdge(a, hub, 1.0);
+    g.addEdge(b, hub, 2.0);
+    g.addEdge(hub, c, 3.0);
+
+    /**
+     * @brief Verifies that the index built from existing edges agrees with the full scan.
+     */
+    SUBCASE("Indexed queries match the unindexed scan") {
+        auto scanned = g.getPredecessors(hub);
+        g.setInEdgeIndexEnabled(true);
+        auto indexed = g.getPredecessors(hub);
+
+        std::sort(scanned.begin(), scanned.end());
+        std::sort(indexed.begin(), indexed.end());
+        CHECK(indexed == scanned);
+        CHECK(g.getInDegree(hub) == 2);
+        CHECK(g.getInDegree(c) == 1);
+
+        auto in = g.getEdgesTo(hub);
+        REQUIRE(in.size() == 2);
+        for (const auto& e : in) {
+            CHECK(e.getDestination() == hub);
+            CHECK(e.getWeight() == g.getEdgeWeight(e.getSource(), hub));
+        }
+    }
+
+    /**
+     * @brief Verifies that the index follows edge and vertex removals.
+     */
+    SUBCASE("Removing a hub vertex clears its incoming edges") {
+        g.setInEdgeIndexEnabled(true);
+        g.removeEdge(a, hub);
+        CHECK(g.getPredecessors(hub) == std::vector<int>{b});
+
+        g.removeVertex(hub);
+        CHECK_FALSE(g.hasEdge(b, hub));
+        CHECK(g.getNeighbors(b).empty());
+        CHECK(g.getInDegree(c) == 0);
+
+        int reused = g.addVertex(makeVertex("D"));
+        CHECK(reused == hub);
+        CHECK(g.getPredecessors(reused).empty());
+    }
+
+    /**
+     * @brief Verifies that indexed in-edges report the weights of edges added before and after enabling the index.
+     */
+    SUBCASE("Indexed in-edges carry their weights") {
+        g.setInEdgeIndexEnabled(true);
+        g.addEdge(c, hub, 4.5);
+
+        double weightSum = 0.0;
+        g.forEachEdgeTo(hub, [&](int, double weight) { weightSum += weight; });
+        CHECK(weightSum == 7.5);
+
+        g.removeEdge(b, hub);
+        auto in = g.getEdgesTo(hub);
+        REQUIRE(in.size() == 2);
+        for (const auto& e : in) CHECK(e.getWeight() == (e.getSource() == a ? 1.0 : 4.5));
+    }
+}
+
+/**
+ * @brief Tests that removing a hub through the in-edge index stays linear in its in-degree.
+ * * A quadratic removal takes seconds at this size, while the unindexed full scan takes milliseconds.
+ */
+TEST_CASE("AdjacencyList: removing a hub with the in-edge index is linear") {
+    const int inDegree = 100000;
+    auto removeHubMs = [&](bool indexed) {
+        AdjacencyList<Vertex> g(true, true);
+        g.addVertices(inDegree + 1);
+        if (indexed) g.setInEdgeIndexEnabled(true);
+        for (int i = 1; i <= inDegree; ++i) g.addEdge(i, 0, 1.0);
+
+        auto start = std::chrono::steady_clock::now();
+        g.removeVertex(0);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        CHECK_FALSE(g.hasEdge(1, 0));
+        CHECK(g.getNeighbors(inDegree).empty());
+        return std::chrono::duration<double, std::milli>(elapsed).count();
+    };
+
+    double scanned = removeHubMs(false);
+    double indexed = removeHubMs(true);
+    CHECK(indexed < 10.0 * scanned + 50.0);
+}
+
+/**
+ * @brief Tests that removing a vertex with many out-edges stays linear in its out-degree.
+ * * Removing the edges one by one rescans the row each time, which takes over a second at this size.
+ */
+TEST_CASE("AdjacencyList: removing a vertex with many out-edges is linear") {
+    const int outDegree = 100000;
+    for (bool directed : {true, false}) {
+        AdjacencyList<Vertex> g(directed, true);
+        g.setEdgeIndexEnabled(true);
+        g.setInEdgeIndexEnabled(true);
+        g.addVertices(outDegree + 1);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 1; i <= outDegree; ++i) g.addEdge(0, i, 1.0);
+        auto built = std::chrono::steady_clock::now();
+        g.removeVertex(0);
+        auto removed = std::chrono::steady_clock::now();
+
+        CHECK_FALSE(g.hasEdge(0, 1));
+        CHECK_FALSE(g.hasEdge(outDegree, 0));
+        CHECK(g.getPredecessors(outDegree).empty());
+        CHECK(g.getEdges().empty());
+        double buildMs = std::chrono::duration<double, std::milli>(built - start).count();
+        double removeMs = std::chrono::duration<double, std::milli>(removed - built).count();
+        CHECK(removeMs < 10.0 * buildMs + 50.0);
+    }
+}
+
+/**
+ * @brief Tests that the visitor API reports exactly what the vector-returning accessors return.
+ */
+TEST_CASE("AdjacencyList: visitors match the vector accessors") {
+    AdjacencyList<Vertex> g(false, true);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    int c = g.addVertex(makeVertex("C"));
+    g.addEdge(a, b, 1.5);
+    g.addEdge(a, c, 2.5);
+    g.addEdge(b, c, 3.5);
+    g.removeEdge(a, b);
+
+    std::vector<int> neighbors;
+    g.forEachNeighbor(a, [&](int id) { neighbors.push_back(id); });
+    CHECK(neighbors == g.getNeighbors(a));
+
+    double weightSum = 0.0;
+    g.forEachEdgeFrom(c, [&](int, double weight) { weightSum += weight; });
+    CHECK(weightSum == 6.0);
+
+    int vertexCount = 0, edgeCount = 0;
+    g.forEachVertex([&](const Vertex&) { ++vertexCount; });
+    g.forEachEdge([&](const Edge&) { ++edgeCount; });
+    CHECK(vertexCount == 3);
+    CHECK(edgeCount == static_cast<int>(g.getEdges().size()));
+}
+
+/**
+ * @brief Tests that compile-time policies behave like the equivalent runtime settings.
+ */
+TEST_CASE("AdjacencyList: compile-time direction and weight policies") {
+    static_assert(sizeof(AdjacencyEntry<double, false>) == sizeof(int));
+    static_assert(sizeof(AdjacencyEntry<double, true>) == 16);
+
+    AdjacencyList<Vertex, Undirected, Unweighted> fixed;
+    AdjacencyList<Vertex> runtime(false, false);
+    CHECK_FALSE(fixed.isDirected());
+    CHECK_FALSE(fixed.isWeighted());
+
+    for (Graph<Vertex>* g : std::initializer_list<Graph<Vertex>*>{&fixed, &runtime}) {
+        for (int i = 0; i < 4; ++i) g->addVertex(makeVertex(""));
+        g->addEdge(0, 1, 7.0);
+        g->addEdge(1, 2, 3.0);
+        g->addEdge(2, 3);
+        g->removeEdge(2, 1);
+    }
+
+    CHECK(fixed.getEdges() == runtime.getEdges());
+    CHECK(fixed.getNeighbors(1) == runtime.getNeighbors(1));
+    CHECK(fixed.hasEdge(1, 0));
+    CHECK_FALSE(fixed.hasEdge(1, 2));
+    CHECK(fixed.getEdgeWeight(0, 1) == 1.0);
+
+    AdjacencyList<Vertex, Directed, Weighted> directed(false, false);
+    CHECK(directed.isDirected());
+    CHECK(directed.isWeighted());
+}
+
+/**
+ * @brief Tests that the factory picks the variant matching the runtime settings and applies the configuration.
+ */
+TEST_CASE("AdjacencyList: makeAdjacencyList selects a specialised variant") {
+    auto g = makeAdjacencyList<Vertex>(true, false, [](auto& list) { list.setInEdgeIndexEnabled(true); });
+    REQUIRE(g);
+    CHECK(g->isDirected());
+    CHECK_FALSE(g->isWeighted());
+
+    auto* list = dynamic_cast<AdjacencyList<Vertex, Directed, Unweighted>*>(g.get());
+    REQUIRE(list);
+    CHECK(list->isInEdgeIndexEnabled());
+
+    int a = g->addVertex(makeVertex("A"));
+    int b = g->addVertex(makeVertex("B"));
+    g->addEdge(a, b, 5.0);
+    CHECK(g->getEdgeWeight(a, b) == 1.0);
+    CHECK(g->getInDegree(b) == 1);
+
+    auto undirected = makeAdjacencyList<Vertex>(false, true);
+    CHECK(dynamic_cast<AdjacencyList<Vertex, Undirected, Weighted>*>(undirected.get()));
+}
+
+/**
+ * @brief Tests the storage and interface of an AdjacencyList with 32-bit integer weights.
+ */
+TEST_CASE("AdjacencyList: integer edge weights") {
+    static_assert(sizeof(BasicEdge<std::uint32_t>) == 12);
+    static_assert(sizeof(AdjacencyEntry<std::uint32_t, true>) == 8);
+
+    AdjacencyList<Vertex, Undirected, Weighted, std::uint32_t> g;
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    g.addEdge(a, b, 7u);
+    g.setEdgeIndexEnabled(true);
+
+    CHECK(g.getEdgeWeight(b, a) == 7u);
+    CHECK(g.getEdgeWeight(a, 42) == std::numeric_limits<std::uint32_t>::max());
+
+    std::vector<BasicEdge<std::uint32_t>> edges = g.getEdges();
+    REQUIRE(edges.size() == 1);
+    CHECK(edges[0].m_weight == 7u);
+
+    std::uint32_t total = 0;
+    g.forEachEdgeFrom(a, [&](int, std::uint32_t weight) { total += weight; });
+    CHECK(total == 7u);
 }
\ No newline at end of file
@@ -108,4 +108,157 @@ TEST_CASE("AdjacencyMatrix: getNeighbors, weights sum and invalid IDs") {
 
     CHECK(g.getNeighbors(-1).empty());
     CHECK(g.getNeighbors(100).empty());
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Tests that growing and reserving the flat buffers preserves every stored edge.
+ */
+TEST_CASE("AdjacencyMatrix: capacity growth and reserve") {
+    AdjacencyMatrix<Vertex> g(true, true);
+    const int count = 100;
+    for (int i = 0; i < count; ++i) g.addVertex(makeVertex(""));
+    for (int i = 0; i + 1 < count; ++i) g.addEdge(i, i + 1, i * 0.5);
+
+    CHECK(g.getCapacity() >= count);
+    CHECK(g.getEdges().size() == count - 1);
+    CHECK(g.getEdgeWeight(70, 71) == 35.0);
+    CHECK(g.hasEdge(63, 64));
+    CHECK_FALSE(g.hasEdge(64, 63));
+
+    g.reserve(1000);
+    CHECK(g.getCapacity() == 1000);
+    CHECK(g.getEdgeWeight(98, 99) == 49.0);
+    CHECK(g.getEdgesTo(99).size() == 1);
+
+    int removed = 50;
+    g.removeVertex(removed);
+    int reused = g.addVertex(makeVertex("R"));
+    CHECK(reused == removed);
+    CHECK(g.getNeighbors(reused).empty());
+    CHECK(g.getEdgesTo(reused).empty());
+}
+
+/**
+ * @brief Tests that growth by addVertex() keeps the buffers close to the area actually used.
+ */
+TEST_CASE("AdjacencyMatrix: growth by addVertex stays near the used area") {
+    AdjacencyMatrix<Vertex> g(true, true);
+    const int count = 1100;
+    for (int i = 0; i < count; ++i) g.addVertex(makeVertex(""));
+
+    std::size_t cells = static_cast<std::size_t>(count) * count;
+    std::size_t exact = cells * sizeof(double) + cells / 8;
+    CHECK(g.getCapacity() >= count);
+    CHECK(g.getCapacity() <= count + count / 4);
+    CHECK(g.getMemoryFootprint() < exact * 8 / 5);
+}
+
+/**
+ * @brief Tests that repeated small addVertices() batches grow the buffers geometrically instead of to the exact size.
+ */
+TEST_CASE("AdjacencyMatrix: small addVertices batches reallocate rarely") {
+    AdjacencyMatrix<Vertex> g(true, true);
+    int reallocations = 0;
+    int capacity = g.getCapacity();
+    for (int i = 0; i < 1000; ++i) {
+        g.addVertices(1);
+        if (g.getCapacity() != capacity) {
+            ++reallocations;
+            capacity = g.getCapacity();
+        }
+    }
+    CHECK(g.getVertexCount() == 1000);
+    CHECK(capacity >= 1000);
+    CHECK(capacity <= 1000 + 1000 / 4);
+    CHECK(reallocations < 40);
+
+    g.reserve(1500);
+    CHECK(g.getCapacity() == 1500);
+}
+
+/**
+ * @brief Tests that unweighted matrices store presence bits only.
+ */
+TEST_CASE("AdjacencyMatrix: unweighted storage is bit-packed") {
+    AdjacencyMatrix<Vertex> g(false, false);
+    g.reserve(640);
+    for (int i = 0; i < 640; ++i) g.addVertex(makeVertex(""));
+    g.addEdge(0, 639, 42.0);
+
+    CHECK(g.getMemoryFootprint() == (640 * 10 + 10) * sizeof(std::uint64_t));
+    CHECK(g.hasEdge(639, 0));
+    CHECK(g.getEdgeWeight(0, 639) == 1.0);
+}
+
+/**
+ * @brief Tests word-parallel neighbour enumeration across word boundaries and the active-vertex mask.
+ */
+TEST_CASE("AdjacencyMatrix: bitset neighbour enumeration") {
+    AdjacencyMatrix<Vertex> g(true, false);
+    for (int i = 0; i < 300; ++i) g.addVertex(makeVertex(""));
+
+    std::vector<int> expected;
+    for (int j = 1; j < 300; j += 7) {
+        g.addEdge(0, j);
+        g.addEdge(1, j);
+        expected.push_back(j);
+    }
+    g.addEdge(1, 2);
+
+    CHECK(g.getNeighbors(0) == expected);
+    CHECK(g.getOutDegree(0) == static_cast<int>(expected.size()));
+    CHECK(g.countCommonNeighbors(0, 1) == static_cast<int>(expected.size()));
+
+    g.removeVertex(260);
+    expected.erase(std::find(expected.begin(), expected.end(), 260));
+    CHECK(g.getNeighbors(0) == expected);
+    CHECK(g.getEdgesFrom(0).size() == expected.size());
+    CHECK(g.countCommonNeighbors(0, 1) == static_cast<int>(expected.size()));
+    CHECK(g.countCommonNeighbors(0, 260) == 0);
+}
+
+/**
+ * @brief Tests an AdjacencyMatrix with compile-time policies.
+ */
+TEST_CASE("AdjacencyMatrix: compile-time direction and weight policies") {
+    AdjacencyMatrix<Vertex, Undirected, Unweighted> g;
+    CHECK_FALSE(g.isDirected());
+    CHECK_FALSE(g.isWeighted());
+
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    g.addEdge(a, b, 4.0);
+
+    CHECK(g.hasEdge(b, a));
+    CHECK(g.getEdgeWeight(a, b) == 1.0);
+    CHECK(g.getEdges().size() == 1);
+    CHECK(g.getMemoryFootprint() == (8 + 1) * sizeof(std::uint64_t));
+}
+/**
+ * @brief Tests the raw row views used by dense algorithms.
+ */
+TEST_CASE("AdjacencyMatrix: presence, weight and active-mask rows") {
+    AdjacencyMatrix<Vertex> g(true, true);
+    g.addVertices(70);
+    g.addEdge(3, 65, 2.5);
+    g.addEdge(3, 4, 1.5);
+    g.removeVertex(4);
+
+    std::span<const std::uint64_t> row = g.getPresenceRow(3);
+    std::span<const std::uint64_t> active = g.getActiveMask();
+    REQUIRE(row.size() == 2);
+    REQUIRE(active.size() == row.size());
+    CHECK(row[1] == std::uint64_t{1} << 1);
+    CHECK((row[0] & active[0]) == 0);
+    CHECK(g.getWeightRow(3).size() == static_cast<std::size_t>(g.getCapacity()));
+    CHECK(g.getWeightRow(3)[65] == 2.5);
+    CHECK(g.getPresenceRow(g.getCapacity()).empty());
+    CHECK(g.getWeightRow(-1).empty());
+
+    AdjacencyMatrix<Vertex> unweighted(true, false);
+    unweighted.addVertices(2);
+    CHECK(unweighted.getPresenceRow(0).size() == 1);
+    CHECK(unweighted.getWeightRow(0).empty());
+    CHECK(unweighted.addVertices(-3).empty());
+    CHECK(unweighted.getVertexCount() == 2);
+}
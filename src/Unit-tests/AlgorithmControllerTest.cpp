@@ -9,6 +9,8 @@
 #include "Vertex.h"
 #include "Edge.h"
 #include <memory>
+#include <cstdint>
+#include <vector>
 
 using namespace Core;
 using namespace Algorithms;
@@ -116,6 +118,35 @@ TEST_SUITE("AlgorithmController: Dijkstra's algorithm") {
         CHECK(state.shortestPathEdges[1].from == a);
         CHECK(state.shortestPathEdges[1].to == b);
     }
+
+    /**
+     * @brief Validates Dijkstra on a graph with 32-bit integer weights, whose sums exceed 32 bits.
+     */
+    TEST_CASE("Dijkstra with integer weights") {
+        AdjacencyList<Vertex, Directed, Weighted, std::uint32_t> g;
+        int a = g.addVertex(std::make_unique<Vertex>("A"));
+        int b = g.addVertex(std::make_unique<Vertex>("B"));
+        int c = g.addVertex(std::make_unique<Vertex>("C"));
+        int d = g.addVertex(std::make_unique<Vertex>("D"));
+
+        g.addEdge(a, b, 4000000000u);
+        g.addEdge(b, d, 4000000000u);
+        g.addEdge(a, c, 1u);
+        g.addEdge(c, d, 4294967295u);
+
+        AlgorithmController<Vertex, std::uint32_t> controller;
+        controller.setAlgorithm(AlgorithmType::Dijkstra);
+        controller.setGraph(&g);
+        AlgoState state;
+
+        REQUIRE(controller.start(a, d, state));
+        while(controller.nextStep(state));
+
+        CHECK(state.distances[d] == 4294967296.0);
+        REQUIRE(state.shortestPathEdges.size() == 2);
+        CHECK(state.shortestPathEdges[0].from == c);
+        CHECK(state.shortestPathEdges[1].from == a);
+    }
 }
 
 /**
@@ -146,4 +177,181 @@ TEST_SUITE("AlgorithmController: history navigation") {
         CHECK(controller.getCurrentStep() == stepIdx);
         CHECK(state.currentVertex == vertexAtStep1);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Test suite covering the typed event protocol of the algorithms.
+ */
+TEST_SUITE("Algorithms: typed events") {
+    /**
+     * @brief Checks the exact event sequence BFS reports to a statically typed sink.
+     */
+    TEST_CASE("BFS reports typed events in order") {
+        AdjacencyList<Vertex> g(true);
+        int a = g.addVertex(std::make_unique<Vertex>("A"));
+        int b = g.addVertex(std::make_unique<Vertex>("B"));
+        g.addEdge(a, b);
+
+        std::vector<AlgorithmEvent> events;
+        BFS<Vertex> bfs;
+        REQUIRE(bfs.run(&g, a, -1, [&](const AlgorithmEvent& e) { events.push_back(e); }));
+
+        std::vector<EventType> types;
+        for (const auto& e : events) types.push_back(e.type);
+        CHECK(types == std::vector<EventType>{EventType::Frontier, EventType::Visiting, EventType::Tree,
+                                              EventType::Frontier, EventType::Visited, EventType::Visiting,
+                                              EventType::Visited});
+        CHECK(events[2].vertex == a);
+        CHECK(events[2].target == b);
+    }
+
+    /**
+     * @brief Checks that Dijkstra carries distances as numeric payloads, and that the null sink and
+     * the type-erased sink produce the same results.
+     */
+    TEST_CASE("Dijkstra distance payloads and sink variants") {
+        AdjacencyList<Vertex> g(true, true);
+        int a = g.addVertex(std::make_unique<Vertex>("A"));
+        int b = g.addVertex(std::make_unique<Vertex>("B"));
+        g.addEdge(a, b, 2.5);
+
+        std::vector<double> distances(2, -1.0);
+        auto record = [&](const AlgorithmEvent& e) {
+            if (e.type == EventType::Distance) distances[e.vertex] = e.value;
+        };
+
+        Dijkstra<Vertex> dijkstra;
+        Algorithm<Vertex>& erased = dijkstra;
+        REQUIRE(erased.run(&g, a, b, record));
+        CHECK(distances[a] == 0.0);
+        CHECK(distances[b] == 2.5);
+
+        CHECK(dijkstra.run(&g, a));
+        CHECK(dijkstra.isFinished());
+        CHECK(erased.run(&g, a));
+    }
+}
+/**
+ * @brief Test suite covering resumable runs and on-demand step generation.
+ */
+TEST_SUITE("Algorithms: resumable runs") {
+    /**
+     * @brief Checks that begin() plus advance() reports the same events as run() for every algorithm.
+     */
+    TEST_CASE("Stepping reports the same events as a full run") {
+        AdjacencyList<Vertex> g(false, true);
+        for (int i = 0; i < 6; ++i) g.addVertex(std::make_unique<Vertex>(""));
+        g.addEdge(0, 1, 4.0);
+        g.addEdge(0, 2, 1.0);
+        g.addEdge(2, 1, 1.0);
+        g.addEdge(1, 3, 2.0);
+        g.addEdge(3, 4, 1.0);
+        g.addEdge(2, 5, 7.0);
+
+        auto compare = [&](Algorithm<Vertex>& algorithm, int endId) {
+            std::vector<AlgorithmEvent> full, stepped;
+            auto recordFull = [&](const AlgorithmEvent& e) { full.push_back(e); };
+            auto recordStepped = [&](const AlgorithmEvent& e) { stepped.push_back(e); };
+            REQUIRE(algorithm.run(&g, 0, endId, recordFull));
+
+            REQUIRE(algorithm.begin(&g, 0, endId, recordStepped));
+            int steps = 0;
+            while (algorithm.advance(recordStepped)) ++steps;
+            CHECK(steps > 0);
+            CHECK(algorithm.isFinished());
+            CHECK_FALSE(algorithm.advance(recordStepped));
+
+            REQUIRE(full.size() == stepped.size());
+            for (std::size_t i = 0; i < full.size(); ++i) {
+                CHECK(full[i].type == stepped[i].type);
+                CHECK(full[i].vertex == stepped[i].vertex);
+                CHECK(full[i].target == stepped[i].target);
+                CHECK(full[i].value == stepped[i].value);
+            }
+        };
+
+        BFS<Vertex> bfs;
+        DFS<Vertex> dfs;
+        Dijkstra<Vertex> dijkstra;
+        SUBCASE("BFS") { compare(bfs, -1); compare(bfs, 3); }
+        SUBCASE("DFS") { compare(dfs, -1); compare(dfs, 4); }
+        SUBCASE("Dijkstra") { compare(dijkstra, -1); compare(dijkstra, 4); }
+    }
+
+    /**
+     * @brief Checks that starting only generates the first steps, and that later steps appear as they are requested.
+     */
+    TEST_CASE("Controller generates steps on demand") {
+        AdjacencyList<Vertex> g(false);
+        const int n = 1000;
+        for (int i = 0; i < n; ++i) g.addVertex(std::make_unique<Vertex>(""));
+        for (int i = 0; i + 1 < n; ++i) g.addEdge(i, i + 1);
+
+        AlgorithmController<Vertex> lazy;
+        lazy.setGraph(&g);
+        AlgoState state;
+        REQUIRE(lazy.start(0, -1, state));
+        CHECK(state.frontier == std::vector<int>{0});
+        CHECK(lazy.getStepCount() < 10);
+        CHECK_FALSE(lazy.isComplete());
+
+        AlgoState sought;
+        REQUIRE(lazy.seek(100, sought));
+        CHECK(lazy.getStepCount() < 110);
+        CHECK_FALSE(lazy.isComplete());
+
+        AlgoState back;
+        REQUIRE(lazy.prevStep(back));
+        CHECK(lazy.getCurrentStep() == 99);
+
+        AlgorithmController<Vertex> eager;
+        eager.setGraph(&g);
+        AlgoState initial;
+        REQUIRE(eager.start(0, -1, initial));
+        eager.runToEnd();
+        CHECK(eager.isComplete());
+        CHECK(eager.getCurrentStep() == 0);
+
+        AlgoState expected;
+        REQUIRE(eager.seek(99, expected));
+        CHECK(back.frontier == expected.frontier);
+        CHECK(back.visitedVertices == expected.visitedVertices);
+        CHECK(back.visitedEdges == expected.visitedEdges);
+
+        AlgoState last;
+        while (lazy.nextStep(last));
+        CHECK(lazy.isComplete());
+        CHECK(lazy.getStepCount() == eager.getStepCount());
+        CHECK(static_cast<int>(last.visitedVertices.size()) == n);
+    }
+
+    /**
+     * @brief Checks that the A* heuristic scale is computed once per graph change instead of on every start.
+     */
+    TEST_CASE("A* heuristic scale is cached until the graph changes") {
+        AdjacencyList<Vertex> g(false, true);
+        g.addVertices(3);
+        g.getVertex(0)->setPosition(0.0, 0.0);
+        g.getVertex(1)->setPosition(4.0, 0.0);
+        g.getVertex(2)->setPosition(4.0, 2.0);
+        g.addEdge(0, 1, 2.0);
+
+        AlgorithmController<Vertex> controller;
+        controller.setAlgorithm(AlgorithmType::AStar);
+        controller.setGraph(&g);
+        AlgoState state;
+        REQUIRE(controller.start(0, 1, state));
+        CHECK(controller.getHeuristicScale() == 0.5);
+
+        g.addEdge(1, 2, 0.5);
+        REQUIRE(controller.start(0, 2, state));
+        CHECK(controller.getHeuristicScale() == 0.5);
+
+        controller.graphChanged();
+        CHECK(controller.getHeuristicScale() == 0.25);
+        REQUIRE(controller.start(0, 2, state));
+        controller.runToEnd();
+        REQUIRE(controller.seek(controller.getStepCount() - 1, state));
+        CHECK(state.distances[2] == 2.5);
+    }
+}
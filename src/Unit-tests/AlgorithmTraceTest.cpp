@@ -0,0 +1,121 @@
+/**
+ * @file AlgorithmTraceTest.cpp
+ * @brief Unit tests for the delta-encoded AlgorithmTrace and seeking in AlgorithmController.
+ */
+
+#include "doctest.h"
+#include "AlgorithmTrace.h"
+#include "AlgorithmController.h"
+#include "AdjacencyList.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Checks that two states are identical.
+ * @param a The first state.
+ * @param b The second state.
+ * @return True if every field matches.
+ */
+static bool sameState(const AlgoState& a, const AlgoState& b) {
+    return a.currentVertex == b.currentVertex && a.frontier == b.frontier
+        && a.visitedVertices == b.visitedVertices && a.visitedEdges == b.visitedEdges
+        && a.distances == b.distances && a.shortestPathEdges == b.shortestPathEdges;
+}
+
+/**
+ * @brief Tests that every step reconstructed by seek() equals a full copy taken while recording.
+ */
+TEST_CASE("AlgorithmTrace: seek matches full snapshots") {
+    AdjacencyList<Vertex> g(true, true);
+    fillRandom(g, 60, 240, 7, std::uniform_int_distribution<int>(1, 9));
+
+    AlgorithmTrace trace;
+    trace.setMinKeyframeInterval(4);
+    trace.reset(g.getVertexCount());
+
+    std::vector<AlgoState> snapshots;
+    AlgoState full;
+    full.distances.assign(g.getVertexCount(), std::numeric_limits<double>::infinity());
+    Dijkstra<Vertex> dijkstra;
+    REQUIRE(dijkstra.run(&g, 0, -1, [&](const AlgorithmEvent& e) {
+        trace.record(e);
+        AlgorithmTrace::apply(full, e);
+        snapshots.push_back(full);
+    }));
+
+    REQUIRE(trace.size() == snapshots.size());
+    CHECK(trace.getKeyframeCount() > 1);
+
+    bool allMatch = true;
+    for (std::size_t i = 0; i < snapshots.size(); ++i) allMatch &= sameState(trace.seek(i), snapshots[i]);
+    for (std::size_t i = snapshots.size(); i-- > 0;) allMatch &= sameState(trace.seek(i), snapshots[i]);
+    std::mt19937 rng(3);
+    for (int k = 0; k < 200; ++k) {
+        std::size_t i = rng() % snapshots.size();
+        allMatch &= sameState(trace.seek(i), snapshots[i]);
+    }
+    CHECK(allMatch);
+    CHECK(sameState(trace.seek(snapshots.size() + 10), snapshots.back()));
+}
+
+/**
+ * @brief Tests that trace memory stays linear in steps and vertices.
+ */
+TEST_CASE("AlgorithmTrace: memory is O(steps + V)") {
+    AdjacencyList<Vertex> g(false, true);
+    fillRandom(g, 2000, 8000, 7, std::uniform_int_distribution<int>(1, 9));
+
+    AlgorithmController<Vertex> controller;
+    controller.setAlgorithm(AlgorithmType::Dijkstra);
+    controller.setGraph(&g);
+    AlgoState state;
+    REQUIRE(controller.start(0, -1, state));
+    controller.runToEnd();
+
+    std::size_t steps = controller.getStepCount();
+    std::size_t vertices = g.getVertexCount();
+    std::size_t bound = 8 * (steps * sizeof(AlgorithmEvent) + vertices * sizeof(double)) + 4096;
+    CHECK(controller.getTrace().getMemoryFootprint() < bound);
+    CHECK(steps * vertices * sizeof(double) > 10 * bound);
+}
+
+/**
+ * @brief Tests seeking through the controller and its interaction with stepping.
+ */
+TEST_CASE("AlgorithmController: seek") {
+    AdjacencyList<Vertex> g(false);
+    fillRandom(g, 30, 60, 3, std::uniform_int_distribution<int>(1, 9));
+
+    AlgorithmController<Vertex> controller;
+    controller.setGraph(&g);
+    AlgoState state;
+    REQUIRE(controller.start(0, -1, state));
+    controller.runToEnd();
+    int last = controller.getStepCount() - 1;
+    REQUIRE(last > 3);
+
+    AlgoState walked;
+    while (controller.nextStep(walked));
+    CHECK(controller.getCurrentStep() == last);
+
+    AlgoState sought;
+    CHECK(controller.seek(2, sought));
+    CHECK(controller.getCurrentStep() == 2);
+    CHECK_FALSE(controller.seek(last + 1, sought));
+    CHECK(controller.getCurrentStep() == 2);
+
+    AlgoState next;
+    REQUIRE(controller.nextStep(next));
+    AlgoState direct;
+    REQUIRE(controller.seek(3, direct));
+    CHECK(sameState(next, direct));
+
+    REQUIRE(controller.seek(last, sought));
+    CHECK(sameState(sought, walked));
+}
\ No newline at end of file
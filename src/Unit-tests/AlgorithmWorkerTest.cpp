@@ -0,0 +1,162 @@
+/**
+ * @file AlgorithmWorkerTest.cpp
+ * @brief Unit tests for the SPSC event queue and background algorithm runs.
+ */
+
+#include "doctest.h"
+#include "SpscQueue.h"
+#include "AlgorithmController.h"
+#include "AlgorithmWorker.h"
+#include "AdjacencyList.h"
+#include "Vertex.h"
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to build a path graph 0 - 1 - ... - (n - 1).
+ * @param g The graph to fill.
+ * @param n The number of vertices.
+ */
+static void fillPath(AdjacencyList<Vertex>& g, int n) {
+    for (int i = 0; i < n; ++i) g.addVertex(std::make_unique<Vertex>(""));
+    for (int i = 0; i + 1 < n; ++i) g.addEdge(i, i + 1);
+}
+
+/**
+ * @brief Test suite for the bounded single-producer single-consumer queue.
+ */
+TEST_SUITE("SpscQueue") {
+    /**
+     * @brief Checks FIFO order, the capacity limit and draining.
+     */
+    TEST_CASE("FIFO order and capacity") {
+        SpscQueue<int> queue(3);
+        CHECK(queue.capacity() == 4);
+        CHECK(queue.empty());
+        for (int i = 0; i < 4; ++i) CHECK(queue.tryPush(i));
+        CHECK_FALSE(queue.tryPush(4));
+
+        int value = -1;
+        REQUIRE(queue.tryPop(value));
+        CHECK(value == 0);
+        CHECK(queue.tryPush(4));
+
+        std::vector<int> drained;
+        CHECK(queue.drain([&](int v) { drained.push_back(v); }, 2) == 2);
+        CHECK(queue.drain([&](int v) { drained.push_back(v); }) == 2);
+        CHECK(drained == std::vector<int>{1, 2, 3, 4});
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.tryPop(value));
+    }
+
+    /**
+     * @brief Streams many values through a small queue from another thread.
+     */
+    TEST_CASE("Producer and consumer threads") {
+        SpscQueue<int> queue(64);
+        const int count = 200000;
+        std::thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                while (!queue.tryPush(i)) std::this_thread::yield();
+            }
+        });
+
+        int expected = 0;
+        bool ordered = true;
+        while (expected < count) {
+            std::size_t got = queue.drain([&](int v) { ordered = ordered && v == expected; ++expected; });
+            if (got == 0) std::this_thread::yield();
+        }
+        producer.join();
+        CHECK(ordered);
+        CHECK(queue.empty());
+    }
+}
+
+/**
+ * @brief Test suite for algorithm runs on a worker thread.
+ */
+TEST_SUITE("AlgorithmController: background runs") {
+    /**
+     * @brief Checks that a background run yields the same steps as a foreground one, even if the graph changes meanwhile.
+     */
+    TEST_CASE("Background run matches a foreground run") {
+        AdjacencyList<Vertex> g(false, true);
+        fillPath(g, 500);
+        g.addEdge(0, 250, 3.0);
+
+        AlgorithmController<Vertex> foreground;
+        foreground.setAlgorithm(AlgorithmType::Dijkstra);
+        foreground.setGraph(&g);
+        AlgoState state;
+        REQUIRE(foreground.start(0, 499, state));
+        foreground.runToEnd();
+
+        AlgorithmController<Vertex> background;
+        background.setAlgorithm(AlgorithmType::Dijkstra);
+        background.setGraph(&g);
+        REQUIRE(background.startInBackground(0, 499));
+        CHECK(background.getStepCount() == 0);
+        g.clear();
+
+        while (!background.isComplete()) {
+            if (background.poll() == 0) std::this_thread::yield();
+        }
+        CHECK(background.getProgress() == 1.0);
+        REQUIRE(background.getStepCount() == foreground.getStepCount());
+
+        AlgoState expected, actual;
+        int last = foreground.getStepCount() - 1;
+        REQUIRE(foreground.seek(last, expected));
+        REQUIRE(background.seek(last, actual));
+        CHECK(actual.distances == expected.distances);
+        CHECK(actual.shortestPathEdges == expected.shortestPathEdges);
+        CHECK(actual.visitedVertices == expected.visitedVertices);
+    }
+
+    /**
+     * @brief Checks that cancelling keeps the collected steps and stops the run.
+     */
+    TEST_CASE("Cancelling keeps the steps produced so far") {
+        AdjacencyList<Vertex> g(false);
+        fillPath(g, 200000);
+
+        AlgorithmController<Vertex> controller;
+        controller.setGraph(&g);
+        REQUIRE(controller.startInBackground(0, -1));
+        while (controller.getStepCount() < 10) {
+            if (controller.poll() == 0) std::this_thread::yield();
+        }
+        controller.cancel();
+        CHECK(controller.isComplete());
+        CHECK_FALSE(controller.isRunningInBackground());
+
+        int steps = controller.getStepCount();
+        CHECK(steps >= 10);
+        CHECK(controller.poll() == 0);
+
+        AlgoState state;
+        CHECK(controller.seek(steps - 1, state));
+        CHECK_FALSE(controller.seek(steps, state));
+    }
+
+    /**
+     * @brief Checks that a worker can be destroyed while its queue is full and the run is blocked.
+     */
+    TEST_CASE("Destroying a blocked worker") {
+        AdjacencyList<Vertex> g(false);
+        fillPath(g, 10000);
+
+        AlgorithmWorker<Vertex> worker(std::make_unique<BFS<Vertex>>(), g, 0, -1, 16);
+        while (worker.getExpandedCount() == 0 && !worker.isFinished()) std::this_thread::yield();
+        worker.cancel();
+        CHECK(worker.wasCancelled());
+        std::size_t drained = worker.drain([](const AlgorithmEvent&) {});
+        CHECK(drained <= 16);
+        CHECK(worker.isFinished());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/**
+ * @file BidirectionalSearchTest.cpp
+ * @brief Unit tests for the bidirectional BFS and Dijkstra point-to-point searches.
+ */
+
+#include "doctest.h"
+#include "BidirectionalBFS.h"
+#include "BidirectionalDijkstra.h"
+#include "BFS.h"
+#include "Dijkstra.h"
+#include "AlgorithmController.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Draws an edge weight between 1 and 50.
+ * @param rng The generator of the graph being filled.
+ * @return The weight.
+ */
+static double edgeWeight(std::mt19937& rng) {
+    return 1 + rng() % 50;
+}
+
+/**
+ * @brief Follows the Path events of a run from the start and sums the weights of the edges taken.
+ * @param g The graph that was searched.
+ * @param path The Path events.
+ * @param startId The start vertex.
+ * @param endId The target vertex.
+ * @return The path length, or -1 if the events do not form a path from start to target over existing edges.
+ */
+template <typename TGraph>
+static double walkPath(const TGraph& g, const std::vector<AlgorithmEvent>& path, int startId, int endId) {
+    std::map<int, int> next;
+    for (const AlgorithmEvent& e : path) {
+        if (!g.hasEdge(e.vertex, e.target) || !next.emplace(e.vertex, e.target).second) return -1;
+    }
+    double length = 0;
+    int curr = startId;
+    while (curr != endId) {
+        auto it = next.find(curr);
+        if (it == next.end()) return -1;
+        length += static_cast<double>(g.getEdgeWeight(curr, it->second));
+        curr = it->second;
+        next.erase(it);
+    }
+    return next.empty() ? length : -1;
+}
+
+/**
+ * @brief Test suite for the bidirectional searches.
+ */
+TEST_SUITE("Bidirectional search") {
+    /**
+     * @brief Checks that the bidirectional BFS finds paths as short as a BFS, on directed and undirected graphs.
+     */
+    TEST_CASE("Bidirectional BFS matches BFS hop counts") {
+        for (bool directed : {true, false}) {
+            AdjacencyList<Vertex> g(directed, false);
+            fillRandom(g, 300, 600, directed ? 1 : 2, edgeWeight);
+
+            BFS<Vertex> bfs;
+            BidirectionalBFS<Vertex> bidirectional;
+            for (int target : {1, 57, 123, 299}) {
+                REQUIRE(bfs.run(&g, 0));
+                std::vector<AlgorithmEvent> path;
+                auto record = [&](const AlgorithmEvent& e) { if (e.type == EventType::Path) path.push_back(e); };
+                REQUIRE(bidirectional.run(&g, 0, target, record));
+
+                if (!bfs.getWorkspace().isReached(target)) {
+                    CHECK(bidirectional.getPathLength() == std::numeric_limits<double>::infinity());
+                    CHECK(path.empty());
+                    continue;
+                }
+                double hops = walkPath(g, path, 0, target);
+                CHECK(hops == static_cast<double>(path.size()));
+                CHECK(bidirectional.getPathLength() == path.size());
+
+                BidirectionalBFS<Vertex> reference;
+                REQUIRE(reference.run(&g, 0));
+                CHECK(reference.getWorkspace().getDistance(target) == path.size());
+            }
+        }
+    }
+
+    /**
+     * @brief Checks that the bidirectional Dijkstra returns the shortest distance and a matching path.
+     */
+    TEST_CASE("Bidirectional Dijkstra matches Dijkstra") {
+        AdjacencyList<Vertex> g(true, true);
+        fillRandom(g, 400, 1600, 3, edgeWeight);
+        CsrGraph<Vertex> csr(g);
+
+        Dijkstra<Vertex> dijkstra;
+        BidirectionalDijkstra<Vertex> bidirectional;
+        REQUIRE(dijkstra.run(&g, 5));
+        for (int target = 0; target < 400; target += 7) {
+            std::vector<AlgorithmEvent> path;
+            auto record = [&](const AlgorithmEvent& e) { if (e.type == EventType::Path) path.push_back(e); };
+            REQUIRE(bidirectional.run(&csr, 5, target, record));
+
+            double expected = dijkstra.getWorkspace().getDistance(target);
+            CHECK(bidirectional.getPathLength() == expected);
+            if (expected == std::numeric_limits<double>::infinity()) CHECK(path.empty());
+            else CHECK(walkPath(g, path, 5, target) == expected);
+        }
+    }
+
+    /**
+     * @brief Checks integer weights on the default bucket queues, and the degenerate queries.
+     */
+    TEST_CASE("Integer weights, same start and target, no target") {
+        AdjacencyList<Vertex, Undirected, Weighted, std::uint32_t> g;
+        fillRandom(g, 200, 500, 4, edgeWeight);
+
+        Dijkstra<Vertex, std::uint32_t> dijkstra;
+        BidirectionalDijkstra<Vertex, std::uint32_t> bidirectional;
+        REQUIRE(dijkstra.run(&g, 3));
+        for (int target : {0, 42, 199}) {
+            REQUIRE(bidirectional.run(&g, 3, target));
+            CHECK(bidirectional.getPathLength() == dijkstra.getWorkspace().getDistance(target));
+        }
+
+        std::vector<AlgorithmEvent> events;
+        auto record = [&](const AlgorithmEvent& e) { events.push_back(e); };
+        REQUIRE(bidirectional.run(&g, 3, 3, record));
+        CHECK(bidirectional.getPathLength() == 0);
+        for (const AlgorithmEvent& e : events) CHECK(e.type != EventType::Path);
+
+        REQUIRE(bidirectional.run(&g, 3));
+        for (int v = 0; v < 200; ++v) {
+            CHECK(bidirectional.getWorkspace().getDistance(v) == dijkstra.getWorkspace().getDistance(v));
+        }
+        CHECK_FALSE(bidirectional.run(&g, 500, 3));
+    }
+
+    /**
+     * @brief Checks that a point-to-point query on a grid settles far fewer vertices from both ends.
+     */
+    TEST_CASE("Fewer settled vertices than a one-sided search") {
+        const int side = 60;
+        AdjacencyList<Vertex> g(false, true);
+        fillGrid(g, side, 0, [](std::mt19937&) { return 1.0; });
+        int start = (side / 2) * side + side / 4;
+        int target = (side / 2) * side + 3 * side / 4;
+
+        auto countVisits = [&](auto& algorithm) {
+            int visits = 0;
+            auto count = [&](const AlgorithmEvent& e) { visits += e.type == EventType::Visiting; };
+            REQUIRE(algorithm.run(&g, start, target, count));
+            return visits;
+        };
+        Dijkstra<Vertex> dijkstra;
+        BidirectionalDijkstra<Vertex> bidirectional;
+        BFS<Vertex> bfs;
+        BidirectionalBFS<Vertex> bidirectionalBfs;
+        int oneSided = countVisits(dijkstra);
+        int twoSided = countVisits(bidirectional);
+        CHECK(bidirectional.getPathLength() == side / 2);
+        CHECK(twoSided * 3 / 2 < oneSided);
+        CHECK(countVisits(bidirectionalBfs) * 3 / 2 < countVisits(bfs));
+        CHECK(bidirectionalBfs.getPathLength() == side / 2);
+    }
+
+    /**
+     * @brief Checks the new algorithm types in the controller, stepping to the final path.
+     */
+    TEST_CASE("Controller runs the bidirectional types") {
+        AdjacencyList<Vertex> g(true, true);
+        g.addVertices(5);
+        g.addEdge(0, 1, 1.0);
+        g.addEdge(1, 2, 1.0);
+        g.addEdge(2, 4, 1.0);
+        g.addEdge(0, 3, 1.0);
+        g.addEdge(3, 4, 5.0);
+
+        for (AlgorithmType type : {AlgorithmType::BidirectionalBFS, AlgorithmType::BidirectionalDijkstra}) {
+            CHECK(usesTargetVertex(type));
+            AlgorithmController<Vertex> controller;
+            controller.setAlgorithm(type);
+            controller.setGraph(&g);
+            AlgoState state;
+            REQUIRE(controller.start(0, 4, state));
+            controller.runToEnd();
+            REQUIRE(controller.seek(controller.getStepCount() - 1, state));
+
+            std::vector<EdgeId> expected = type == AlgorithmType::BidirectionalBFS
+                ? std::vector<EdgeId>{{0, 3}, {3, 4}} : std::vector<EdgeId>{{0, 1}, {1, 2}, {2, 4}};
+            std::sort(state.shortestPathEdges.begin(), state.shortestPathEdges.end());
+            CHECK(state.shortestPathEdges == expected);
+        }
+        CHECK(reportsDistances(AlgorithmType::BidirectionalDijkstra));
+        CHECK_FALSE(reportsDistances(AlgorithmType::BidirectionalBFS));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+/**
+ * @file CsrGraphTest.cpp
+ * @brief Unit tests for the CsrGraph snapshot.
+ */
+
+#include "doctest.h"
+#include "CsrGraph.h"
+#include "AdjacencyList.h"
+#include "AdjacencyMatrix.h"
+#include "AlgorithmController.h"
+#include "Vertex.h"
+#include "Edge.h"
+#include <algorithm>
+#include <memory>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to create a dynamically allocated Vertex.
+ * @param name The string representation of the vertex name.
+ * @return std::unique_ptr<Vertex> containing the created vertex.
+ */
+static std::unique_ptr<Vertex> makeVertex(const std::string& name) {
+    return std::make_unique<Vertex>(name);
+}
+
+/**
+ * @brief Tests that a snapshot of an AdjacencyList drops removed vertices and edges.
+ */
+TEST_CASE("CsrGraph: snapshot of an AdjacencyList skips tombstones") {
+    AdjacencyList<Vertex> g(true);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    int c = g.addVertex(makeVertex("C"));
+    int d = g.addVertex(makeVertex("D"));
+
+    g.addEdge(a, b, 1.0);
+    g.addEdge(a, c, 2.0);
+    g.addEdge(b, d, 3.0);
+    g.addEdge(c, d, 4.0);
+    g.removeEdge(a, c);
+    g.removeVertex(b);
+
+    CsrGraph<Vertex> csr(g);
+
+    CHECK(csr.isDirected());
+    CHECK(csr.getVertexCount() == g.getVertexCount());
+    CHECK_FALSE(csr.hasVertex(b));
+    CHECK(csr.getVertex(c)->getName() == "C");
+    CHECK(csr.getEdgeCount() == 1);
+    CHECK(csr.getNeighborSpan(a).empty());
+    CHECK(csr.hasEdge(c, d));
+    CHECK(csr.getEdgeWeight(c, d) == 4.0);
+    CHECK(csr.getEdges().size() == g.getEdges().size());
+    CHECK(csr.getMemoryFootprint() > 0);
+}
+
+/**
+ * @brief Tests that a directed snapshot lists incoming edges from its transposed arrays.
+ */
+TEST_CASE("CsrGraph: incoming edges of a directed snapshot") {
+    AdjacencyList<Vertex> g(true, true);
+    g.addVertices(4);
+    g.addEdge(2, 0, 1.5);
+    g.addEdge(1, 0, 2.5);
+    g.addEdge(0, 3, 3.5);
+    g.addEdge(3, 0, 4.5);
+
+    CsrGraph<Vertex> csr(g);
+    std::vector<BasicEdge<double>> incoming = csr.getEdgesTo(0);
+    REQUIRE(incoming.size() == 3);
+    CHECK(incoming[0].m_source == 1);
+    CHECK(incoming[0].m_weight == 2.5);
+    CHECK(incoming[1].m_source == 2);
+    CHECK(incoming[2].m_source == 3);
+    CHECK(incoming[2].m_weight == 4.5);
+    CHECK(csr.getInDegree(3) == 1);
+    CHECK(csr.getPredecessors(1).empty());
+
+    auto sources = csr.getInNeighborSpan(0);
+    REQUIRE(sources.size() == 3);
+    CHECK(sources[0] == 1);
+    CHECK(sources[2] == 3);
+    CHECK(csr.getInNeighborSpan(9).empty());
+}
+
+/**
+ * @brief Tests that an undirected AdjacencyMatrix snapshot keeps neighbour order and reports each edge once.
+ */
+TEST_CASE("CsrGraph: snapshot of an undirected AdjacencyMatrix") {
+    AdjacencyMatrix<Vertex> g(false);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    int c = g.addVertex(makeVertex("C"));
+
+    g.addEdge(a, b, 5.0);
+    g.addEdge(a, c, 7.0);
+
+    CsrGraph<Vertex> csr(g);
+
+    CHECK(csr.getNeighbors(a) == g.getNeighbors(a));
+    CHECK(csr.getNeighbors(b) == g.getNeighbors(b));
+    CHECK(csr.getEdgeCount() == 4);
+    CHECK(csr.getEdges().size() == 2);
+
+    auto weights = csr.getWeightSpan(a);
+    REQUIRE(weights.size() == 2);
+    CHECK(weights[0] == 5.0);
+    CHECK(weights[1] == 7.0);
+    CHECK(csr.getInNeighborSpan(b).size() == 1);
+}
+
+/**
+ * @brief Tests that the snapshot ignores mutations and is not affected by later changes to the source.
+ */
+TEST_CASE("CsrGraph: snapshot is read-only and detached from the source") {
+    AdjacencyList<Vertex> g(false);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    g.addEdge(a, b);
+
+    CsrGraph<Vertex> csr(g);
+    g.removeVertex(b);
+
+    CHECK(csr.hasEdge(a, b));
+    CHECK(csr.addVertex(makeVertex("C")) == -1);
+    csr.removeEdge(a, b);
+    CHECK(csr.hasEdge(a, b));
+}
+
+/**
+ * @brief Tests that algorithms produce the same trace on the snapshot as on the source graph.
+ */
+TEST_CASE("CsrGraph: Dijkstra on the snapshot matches the source graph") {
+    AdjacencyList<Vertex> g(false, true);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    int c = g.addVertex(makeVertex("C"));
+    g.addEdge(a, c, 10.0);
+    g.addEdge(a, b, 2.0);
+    g.addEdge(b, c, 2.0);
+
+    CsrGraph<Vertex> csr(g);
+
+    AlgorithmController<Vertex> onList;
+    onList.setAlgorithm(AlgorithmType::Dijkstra);
+    onList.setGraph(&g);
+    AlgorithmController<Vertex> onCsr;
+    onCsr.setAlgorithm(AlgorithmType::Dijkstra);
+    onCsr.setGraph(&csr);
+
+    AlgoState listState, csrState;
+    REQUIRE(onList.start(a, c, listState));
+    REQUIRE(onCsr.start(a, c, csrState));
+    while (onList.nextStep(listState));
+    while (onCsr.nextStep(csrState));
+
+    CHECK(onList.getCurrentStep() == onCsr.getCurrentStep());
+    CHECK(csrState.distances == listState.distances);
+    CHECK(csrState.shortestPathEdges == listState.shortestPathEdges);
+}
\ No newline at end of file
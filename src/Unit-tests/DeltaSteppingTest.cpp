@@ -0,0 +1,185 @@
+/**
+ * @file DeltaSteppingTest.cpp
+ * @brief Unit tests for delta-stepping, sequential and parallel, cross-checked against Dijkstra.
+ */
+
+#include "doctest.h"
+#include "DeltaStepping.h"
+#include "ParallelDeltaStepping.h"
+#include "Dijkstra.h"
+#include "AlgorithmController.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "ThreadPool.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Draws an edge weight from a wide range, zero included.
+ * @param rng The generator of the graph being filled.
+ * @return The weight.
+ */
+static double wideWeight(std::mt19937& rng) {
+    unsigned weight = rng() % 10 == 0 ? 0 : 1 + rng() % 1000;
+    return static_cast<double>(weight) / 7.0;
+}
+
+/**
+ * @brief Test suite for delta-stepping.
+ */
+TEST_SUITE("Delta-stepping") {
+    /**
+     * @brief Checks exact distances for several bucket widths, on a list and on its CSR snapshot.
+     */
+    TEST_CASE("Sequential distances match Dijkstra") {
+        for (bool directed : {true, false}) {
+            AdjacencyList<Vertex> g(directed, true);
+            fillRandom(g, 2000, 12000, directed ? 3 : 4, wideWeight);
+            g.removeVertex(9);
+            CsrGraph<Vertex> csr(g);
+
+            Dijkstra<Vertex> dijkstra;
+            REQUIRE(dijkstra.run(&g, 0));
+            for (double delta : {0.0, 0.01, 3.0, 1e9}) {
+                DeltaStepping<Vertex> stepping(delta);
+                REQUIRE(stepping.run(&csr, 0));
+                bool same = true;
+                for (int v = 0; v < g.getVertexCount(); ++v) {
+                    same = same && stepping.getWorkspace().getDistance(v) == dijkstra.getWorkspace().getDistance(v);
+                }
+                CHECK(same);
+                CHECK(stepping.getDelta() > 0);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks that each advance() settles one bucket and that a target ends the run with its path.
+     */
+    TEST_CASE("One bucket per step and early exit at the target") {
+        AdjacencyList<Vertex> g(true, true);
+        g.addVertices(5);
+        g.addEdge(0, 1, 1.0);
+        g.addEdge(1, 2, 1.0);
+        g.addEdge(0, 2, 5.0);
+        g.addEdge(2, 3, 4.0);
+        g.addEdge(3, 4, 1.0);
+
+        DeltaStepping<Vertex> stepping(2.0);
+        REQUIRE(stepping.begin(&g, 0, -1));
+        int steps = 0;
+        while (stepping.advance()) ++steps;
+        CHECK(stepping.isFinished());
+        CHECK(stepping.getBucketCount() == 3);
+        CHECK(static_cast<std::size_t>(steps + 1) == stepping.getBucketCount());
+        CHECK(stepping.getWorkspace().getDistance(4) == 7.0);
+
+        std::vector<EdgeId> path;
+        auto record = [&](const AlgorithmEvent& e) {
+            if (e.type == EventType::Path) path.push_back({e.vertex, e.target});
+        };
+        REQUIRE(stepping.run(&g, 0, 2, record));
+        std::sort(path.begin(), path.end());
+        CHECK(path == std::vector<EdgeId>{{0, 1}, {1, 2}});
+        CHECK(stepping.getBucketCount() == 2);
+        CHECK(stepping.getWorkspace().getDistance(4) == std::numeric_limits<double>::infinity());
+        CHECK_FALSE(stepping.run(&g, 8));
+    }
+
+    /**
+     * @brief Checks the parallel engine against Dijkstra for several pool sizes, widths and integer weights.
+     */
+    TEST_CASE("Parallel distances match Dijkstra") {
+        AdjacencyList<Vertex> g(true, true);
+        fillRandom(g, 20000, 160000, 17, wideWeight);
+        CsrGraph<Vertex> csr(g);
+        Dijkstra<Vertex> dijkstra;
+        REQUIRE(dijkstra.run(&csr, 5));
+
+        for (std::size_t threads : {1, 3, 8}) {
+            ThreadPool pool(threads);
+            for (double delta : {0.0, 0.5, 50.0}) {
+                ParallelDeltaStepping<Vertex> stepping(delta, pool, 32);
+                REQUIRE(stepping.run(csr, 5));
+                bool same = true;
+                for (int v = 0; v < csr.getVertexCount(); ++v) {
+                    same = same && stepping.getDistance(v) == dijkstra.getWorkspace().getDistance(v);
+                }
+                CHECK(same);
+                CHECK(stepping.getBucketCount() > 0);
+            }
+        }
+
+        AdjacencyList<Vertex, Directed, Weighted, std::uint32_t> integral;
+        fillRandom(integral, 3000, 20000, 2, [](std::mt19937& rng) { return rng() % 100; });
+        CsrGraph<Vertex, std::uint32_t> integralCsr(integral);
+        Dijkstra<Vertex, std::uint32_t> integralDijkstra;
+        REQUIRE(integralDijkstra.run(&integralCsr, 0));
+        ThreadPool pool(4);
+        ParallelDeltaStepping<Vertex, std::uint32_t> integralStepping(0, pool);
+        REQUIRE(integralStepping.run(integralCsr, 0));
+        CHECK(integralStepping.getDelta() >= 1);
+        bool same = true;
+        for (int v = 0; v < 3000; ++v) same = same && integralStepping.getDistance(v) == integralDijkstra.getWorkspace().getDistance(v);
+        CHECK(same);
+        CHECK_FALSE(integralStepping.run(integralCsr, 3000));
+    }
+
+    /**
+     * @brief Checks that a small delta over heavy integer weights runs on a bounded ring with an overflow list.
+     */
+    TEST_CASE("Small delta over heavy weights") {
+        AdjacencyList<Vertex, Directed, Weighted, std::uint32_t> g;
+        fillRandom(g, 2000, 10000, 11, [](std::mt19937& rng) { return rng() % 1000000000u; });
+        CsrGraph<Vertex, std::uint32_t> csr(g);
+        CHECK(deltaRingSize<std::uint64_t>(1000000000u, 1) == MAX_DELTA_RING);
+
+        Dijkstra<Vertex, std::uint32_t> dijkstra;
+        REQUIRE(dijkstra.run(&csr, 0));
+        DeltaStepping<Vertex, std::uint32_t> stepping(1);
+        REQUIRE(stepping.run(&csr, 0));
+        ThreadPool pool(4);
+        ParallelDeltaStepping<Vertex, std::uint32_t> parallel(1, pool);
+        REQUIRE(parallel.run(csr, 0));
+
+        bool same = true;
+        for (int v = 0; v < 2000; ++v) {
+            same = same && stepping.getWorkspace().getDistance(v) == dijkstra.getWorkspace().getDistance(v)
+                        && parallel.getDistance(v) == dijkstra.getWorkspace().getDistance(v);
+        }
+        CHECK(same);
+    }
+
+    /**
+     * @brief Checks the controller type: the path to the target and its distance are recorded.
+     */
+    TEST_CASE("Controller runs delta-stepping") {
+        AdjacencyList<Vertex> g(false, true);
+        g.addVertices(4);
+        g.addEdge(0, 1, 2.0);
+        g.addEdge(1, 3, 2.0);
+        g.addEdge(0, 2, 1.0);
+        g.addEdge(2, 3, 5.0);
+
+        CHECK(usesTargetVertex(AlgorithmType::DeltaStepping));
+        CHECK(reportsDistances(AlgorithmType::DeltaStepping));
+        AlgorithmController<Vertex> controller;
+        controller.setAlgorithm(AlgorithmType::DeltaStepping);
+        controller.setGraph(&g);
+        AlgoState state;
+        REQUIRE(controller.start(0, 3, state));
+        controller.runToEnd();
+        REQUIRE(controller.seek(controller.getStepCount() - 1, state));
+        std::sort(state.shortestPathEdges.begin(), state.shortestPathEdges.end());
+        CHECK(state.shortestPathEdges == std::vector<EdgeId>{{0, 1}, {1, 3}});
+        CHECK(state.distances[3] == 4.0);
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file DirectionOptimizingBFSTest.cpp
+ * @brief Unit tests for the direction-optimizing BFS, cross-checked against Algorithms::BFS.
+ */
+
+#include "doctest.h"
+#include "DirectionOptimizingBFS.h"
+#include "BFS.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to derive BFS parents and levels from the Tree events of Algorithms::BFS.
+ * @param g The graph to traverse.
+ * @param start The start vertex.
+ * @param parents Receives the parent of each vertex, -1 for the start and unreached vertices.
+ * @param levels Receives the level of each vertex, -1 for unreached vertices.
+ */
+template <typename TGraph>
+static void referenceBfs(const TGraph& g, int start, std::vector<int>& parents, std::vector<int>& levels) {
+    parents.assign(g.getVertexCount(), -1);
+    levels.assign(g.getVertexCount(), -1);
+    levels[start] = 0;
+    BFS<Vertex> bfs;
+    auto record = [&](const AlgorithmEvent& e) {
+        if (e.type != EventType::Tree) return;
+        parents[e.target] = e.vertex;
+        levels[e.target] = levels[e.vertex] + 1;
+    };
+    REQUIRE(bfs.run(&g, start, -1, record));
+}
+
+/**
+ * @brief Test suite for the direction-optimizing BFS.
+ */
+TEST_SUITE("Direction-optimizing BFS") {
+    /**
+     * @brief Checks levels in every mode, exact parents top-down and valid parents otherwise.
+     */
+    TEST_CASE("Levels and parents match BFS") {
+        for (bool directed : {true, false}) {
+            AdjacencyList<Vertex> g(directed, false);
+            fillSocial(g, 3000, 20000, directed ? 5 : 6);
+            g.removeVertex(17);
+            CsrGraph<Vertex> csr(g);
+
+            std::vector<int> parents, levels;
+            referenceBfs(csr, 0, parents, levels);
+            for (BfsDirection direction : {BfsDirection::Adaptive, BfsDirection::TopDown, BfsDirection::BottomUp}) {
+                DirectionOptimizingBFS<Vertex> bfs(direction);
+                REQUIRE(bfs.run(csr, 0));
+                CHECK(bfs.getLevels() == levels);
+                if (direction == BfsDirection::TopDown) CHECK(bfs.getParents() == parents);
+
+                int reached = 0, deepest = 0;
+                for (int v = 0; v < csr.getVertexCount(); ++v) {
+                    if (levels[v] < 0) continue;
+                    ++reached;
+                    deepest = std::max(deepest, levels[v]);
+                    int p = bfs.getParent(v);
+                    if (v == 0) {
+                        CHECK(p == -1);
+                        continue;
+                    }
+                    REQUIRE(p >= 0);
+                    CHECK(levels[p] == levels[v] - 1);
+                    CHECK(csr.hasEdge(p, v));
+                }
+                CHECK(bfs.getReachedCount() == reached);
+                CHECK(bfs.getLevelCount() == deepest + 1);
+                CHECK(bfs.getLevel(17) == -1);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks that the adaptive search goes bottom-up on a low-diameter graph and inspects fewer edges.
+     */
+    TEST_CASE("Adaptive search skips edge inspections") {
+        AdjacencyList<Vertex> g(false, false);
+        std::mt19937 rng(8);
+        const int n = 20000;
+        g.addVertices(n);
+        for (int i = 0; i < 16 * n; ++i) g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+        CsrGraph<Vertex> csr(g);
+
+        DirectionOptimizingBFS<Vertex> adaptive;
+        DirectionOptimizingBFS<Vertex> topDown(BfsDirection::TopDown);
+        REQUIRE(adaptive.run(csr, 3));
+        REQUIRE(topDown.run(csr, 3));
+        CHECK(adaptive.getLevels() == topDown.getLevels());
+        CHECK(adaptive.getBottomUpLevels() > 0);
+        CHECK(topDown.getBottomUpLevels() == 0);
+        CHECK(topDown.getEdgesInspected() == csr.getEdgeCount());
+        CHECK(adaptive.getEdgesInspected() * 2 < topDown.getEdgesInspected());
+    }
+
+    /**
+     * @brief Checks that a small frontier of hubs left by a bottom-up level is weighed by its real out-degree.
+     * * The start reaches 5000 vertices that all lead to 4 hubs, and each hub has 5000 leaves of its own. The
+     * hubs are claimed bottom-up; their 40000 out-edges then outweigh the 20000 unexplored leaf edges, so the
+     * leaves are claimed bottom-up too instead of scanning the hubs top-down.
+     */
+    TEST_CASE("Hubs found bottom-up are expanded bottom-up") {
+        const int middle = 5000, hubs = 4, leaves = 5000;
+        AdjacencyList<Vertex> g(false, false);
+        g.addVertices(1 + middle + hubs + hubs * leaves);
+        for (int b = 1; b <= middle; ++b) g.addEdge(0, b);
+        for (int h = 0; h < hubs; ++h) {
+            int hub = 1 + middle + h;
+            for (int b = 1; b <= middle; ++b) g.addEdge(hub, b);
+            for (int c = 0; c < leaves; ++c) g.addEdge(hub, 1 + middle + hubs + h * leaves + c);
+        }
+        CsrGraph<Vertex> csr(g);
+
+        DirectionOptimizingBFS<Vertex> adaptive;
+        DirectionOptimizingBFS<Vertex> topDown(BfsDirection::TopDown);
+        REQUIRE(adaptive.run(csr, 0));
+        REQUIRE(topDown.run(csr, 0));
+        CHECK(adaptive.getLevels() == topDown.getLevels());
+        CHECK(adaptive.getLevelCount() == 4);
+        CHECK(adaptive.getEdgesInspected() < middle + 2 * hubs * leaves + hubs * middle);
+    }
+
+    /**
+     * @brief Checks the degenerate inputs: a missing start, an isolated start and directed in-edges only.
+     */
+    TEST_CASE("Missing start, isolated start, one-way edges") {
+        AdjacencyList<Vertex> g(true, false);
+        g.addVertices(4);
+        g.addEdge(1, 0);
+        g.addEdge(1, 2);
+        g.addEdge(2, 3);
+        CsrGraph<Vertex> csr(g);
+
+        DirectionOptimizingBFS<Vertex> bfs(BfsDirection::BottomUp);
+        CHECK_FALSE(bfs.run(csr, 9));
+        REQUIRE(bfs.run(csr, 0));
+        CHECK(bfs.getReachedCount() == 1);
+        CHECK(bfs.getLevelCount() == 1);
+        CHECK(bfs.getLevel(1) == -1);
+
+        REQUIRE(bfs.run(csr, 1));
+        CHECK(bfs.getLevels() == std::vector<int>{1, 0, 1, 2});
+        CHECK(bfs.getParents() == std::vector<int>{1, -1, 1, 2});
+        CHECK(bfs.getParent(-4) == -1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+ * @file EdgeIndexTest.cpp
+ * @brief Unit tests for the EdgeIndex hash table and its use in AdjacencyList.
+ */
+
+#include "doctest.h"
+#include "EdgeIndex.h"
+#include "AdjacencyList.h"
+#include "Vertex.h"
+#include "Edge.h"
+#include <memory>
+
+using namespace Core;
+
+/**
+ * @brief Tests insertion, lookup and removal, including reinsertion into tombstoned slots.
+ */
+TEST_CASE("EdgeIndex: insert, find and erase") {
+    EdgeIndex index;
+    CHECK_FALSE(index.contains(0, 1));
+
+    CHECK(index.insert(0, 1, 2.5));
+    CHECK(index.insert(1, 0, 4.0));
+    CHECK_FALSE(index.insert(0, 1, 9.0));
+    CHECK(index.size() == 2);
+
+    REQUIRE(index.find(0, 1) != nullptr);
+    CHECK(*index.find(0, 1) == 2.5);
+    CHECK(*index.find(1, 0) == 4.0);
+
+    CHECK(index.erase(0, 1));
+    CHECK_FALSE(index.erase(0, 1));
+    CHECK_FALSE(index.contains(0, 1));
+    CHECK(index.contains(1, 0));
+
+    CHECK(index.insert(0, 1, 7.0));
+    CHECK(*index.find(0, 1) == 7.0);
+}
+
+/**
+ * @brief Tests that the table stays consistent through growth and heavy churn.
+ */
+TEST_CASE("EdgeIndex: growth and churn") {
+    EdgeIndex index;
+    index.reserve(1000);
+    for (int i = 0; i < 5000; ++i) index.insert(i % 100, i, static_cast<double>(i));
+    CHECK(index.size() == 5000);
+
+    for (int i = 0; i < 5000; i += 2) index.erase(i % 100, i);
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 5000; i += 2) index.insert(i % 100, i, -1.0);
+        for (int i = 0; i < 5000; i += 2) index.erase(i % 100, i);
+    }
+
+    CHECK(index.size() == 2500);
+    CHECK(*index.find(7, 4907) == 4907.0);
+    CHECK_FALSE(index.contains(6, 4906));
+    CHECK(hashEdgeKey(1, 2) != hashEdgeKey(2, 1));
+}
+
+/**
+ * @brief Tests that AdjacencyList answers through the index consistently with its rows.
+ */
+TEST_CASE("EdgeIndex: AdjacencyList keeps the index in sync") {
+    AdjacencyList<Vertex> g(false, true);
+    int a = g.addVertex(std::make_unique<Vertex>("A"));
+    int b = g.addVertex(std::make_unique<Vertex>("B"));
+    g.addEdge(a, b, 3.0);
+
+    g.setEdgeIndexEnabled(true);
+    int c = g.addVertex(std::make_unique<Vertex>("C"));
+    g.reserveEdges(2);
+    g.addEdge(b, c, 5.0);
+    g.addEdge(c, b, 8.0);
+
+    CHECK(g.hasEdge(b, a));
+    CHECK(g.getEdgeWeight(c, b) == 5.0);
+    CHECK(g.getEdgesFrom(c).size() == 1);
+
+    g.removeVertex(b);
+    CHECK_FALSE(g.hasEdge(a, b));
+    CHECK_FALSE(g.hasEdge(c, b));
+
+    int d = g.addVertex(std::make_unique<Vertex>("D"));
+    CHECK_FALSE(g.hasEdge(c, d));
+    g.addEdge(c, d, 1.0);
+    CHECK(g.hasEdge(d, c));
+
+    g.clear();
+    int e = g.addVertex(std::make_unique<Vertex>("E"));
+    int f = g.addVertex(std::make_unique<Vertex>("F"));
+    CHECK_FALSE(g.hasEdge(e, f));
+}
\ No newline at end of file
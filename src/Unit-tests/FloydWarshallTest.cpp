@@ -0,0 +1,154 @@
+/**
+ * @file FloydWarshallTest.cpp
+ * @brief Unit tests for blocked Floyd-Warshall, cross-checked against Dijkstra from every vertex.
+ */
+
+#include "doctest.h"
+#include "FloydWarshall.h"
+#include "Dijkstra.h"
+#include "AdjacencyMatrix.h"
+#include "ThreadPool.h"
+#include "Vertex.h"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to check every distance and path of a solver against Dijkstra.
+ * * A path must start and end at the requested vertices, use existing edges and add up to the distance.
+ * @param g The graph the solver ran on.
+ * @param apsp The solver after run().
+ * @return true If every pair agrees.
+ */
+template <typename TGraph, typename TWeight>
+static bool matchesDijkstra(const TGraph& g, const FloydWarshall<Vertex, TWeight>& apsp) {
+    using Distance = typename WeightTraits<TWeight>::Distance;
+    Dijkstra<Vertex, TWeight> dijkstra;
+    bool same = true;
+    for (int from = 0; from < g.getVertexCount(); ++from) {
+        if (!dijkstra.run(&g, from)) {
+            same = same && apsp.getDistance(from, from) == WeightTraits<TWeight>::infinity();
+            continue;
+        }
+        for (int to = 0; to < g.getVertexCount(); ++to) {
+            Distance expected = dijkstra.getWorkspace().getDistance(to);
+            same = same && apsp.getDistance(from, to) == expected;
+            std::vector<int> path = apsp.getPath(from, to);
+            if (expected == WeightTraits<TWeight>::infinity()) {
+                same = same && path.empty();
+                continue;
+            }
+            Distance length = 0;
+            for (std::size_t i = 1; i < path.size(); ++i) {
+                same = same && g.hasEdge(path[i - 1], path[i]);
+                length += g.getEdgeWeight(path[i - 1], path[i]);
+            }
+            same = same && !path.empty() && path.front() == from && path.back() == to && length == expected;
+        }
+    }
+    return same;
+}
+
+/**
+ * @brief Test suite for blocked Floyd-Warshall.
+ */
+TEST_SUITE("Floyd-Warshall") {
+    /**
+     * @brief Checks distances and paths on graphs spanning several tiles, directed or not, for several pool sizes.
+     */
+    TEST_CASE("Distances and paths match Dijkstra") {
+        for (bool directed : {true, false}) {
+            AdjacencyMatrix<Vertex> g(directed, true);
+            std::mt19937 rng(directed ? 5 : 6);
+            g.addVertices(150);
+            for (int i = 0; i < 900; ++i) {
+                g.addEdge(static_cast<int>(rng() % 150), static_cast<int>(rng() % 150), static_cast<double>(rng() % 1000) / 8.0);
+            }
+            g.removeVertex(70);
+
+            for (std::size_t threads : {1, 4}) {
+                ThreadPool pool(threads);
+                FloydWarshall<Vertex> apsp(pool);
+                apsp.run(g);
+                CHECK(apsp.getVertexCount() == 150);
+                CHECK(matchesDijkstra(g, apsp));
+                CHECK_FALSE(apsp.hasNegativeCycle());
+                CHECK(apsp.getNextHop(70, 70) == -1);
+                CHECK(apsp.getDistance(0, 150) == std::numeric_limits<double>::infinity());
+            }
+        }
+    }
+
+    /**
+     * @brief Checks unweighted matrices, which count edges, and integer weights.
+     */
+    TEST_CASE("Unweighted and integer weights") {
+        AdjacencyMatrix<Vertex, Directed, Unweighted> unweighted;
+        unweighted.addVertices(70);
+        for (int i = 0; i + 1 < 70; ++i) unweighted.addEdge(i, i + 1);
+        unweighted.addEdge(69, 0);
+        FloydWarshall<Vertex> hops;
+        hops.run(unweighted);
+        CHECK(hops.getDistance(0, 69) == 69.0);
+        CHECK(hops.getDistance(69, 68) == 69.0);
+        CHECK(hops.getPath(68, 1) == std::vector<int>{68, 69, 0, 1});
+
+        AdjacencyMatrix<Vertex, Directed, Weighted, std::uint32_t> integral;
+        std::mt19937 rng(9);
+        integral.addVertices(100);
+        for (int i = 0; i < 500; ++i) integral.addEdge(static_cast<int>(rng() % 100), static_cast<int>(rng() % 100), rng() % 50);
+        FloydWarshall<Vertex, std::uint32_t> apsp;
+        apsp.run(integral);
+        CHECK(matchesDijkstra(integral, apsp));
+    }
+
+    /**
+     * @brief Checks negative edges and the detection of a negative cycle.
+     */
+    TEST_CASE("Negative weights") {
+        AdjacencyMatrix<Vertex, Directed, Weighted, int> g;
+        g.addVertices(4);
+        g.addEdge(0, 1, 4);
+        g.addEdge(0, 2, 1);
+        g.addEdge(2, 1, -3);
+        g.addEdge(1, 3, 2);
+        FloydWarshall<Vertex, int> apsp;
+        apsp.run(g);
+        CHECK(apsp.getDistance(0, 3) == 0);
+        CHECK(apsp.getPath(0, 3) == std::vector<int>{0, 2, 1, 3});
+        CHECK(apsp.getDistance(3, 0) == WeightTraits<int>::infinity());
+        CHECK_FALSE(apsp.hasNegativeCycle());
+
+        g.addEdge(1, 2, 1);
+        apsp.run(g);
+        CHECK(apsp.hasNegativeCycle());
+    }
+
+    /**
+     * @brief Checks the state that highlights one pair's path.
+     */
+    TEST_CASE("Path state") {
+        AdjacencyMatrix<Vertex> g(false, true);
+        g.addVertices(5);
+        g.addEdge(0, 1, 2.0);
+        g.addEdge(1, 3, 2.0);
+        g.addEdge(0, 2, 1.0);
+        g.addEdge(2, 3, 5.0);
+        FloydWarshall<Vertex> apsp;
+        apsp.run(g);
+
+        AlgoState state = apsp.getPathState(3, 0);
+        CHECK(state.shortestPathEdges == std::vector<EdgeId>{{3, 1}, {1, 0}});
+        CHECK(state.currentVertex == 0);
+        CHECK(state.distances == std::vector<double>{4.0, 2.0, 5.0, 0.0, std::numeric_limits<double>::infinity()});
+
+        AlgoState none = apsp.getPathState(0, 4);
+        CHECK(none.shortestPathEdges.empty());
+        CHECK(none.distances.size() == 5);
+        CHECK(apsp.getPathState(7, 0).distances.empty());
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file GraphNotifierTest.cpp
+ * @brief Unit tests for batched graph modifications and coalesced observer notifications.
+ */
+
+#include "doctest.h"
+#include "AdjacencyList.h"
+#include "AdjacencyMatrix.h"
+#include "GraphNotifier.h"
+#include "Vertex.h"
+#include "Edge.h"
+#include <memory>
+#include <vector>
+
+using namespace Core;
+
+/**
+ * @brief Helper function to create a dynamically allocated Vertex.
+ * @param name The string representation of the vertex name.
+ * @return std::unique_ptr<Vertex> containing the created vertex.
+ */
+static std::unique_ptr<Vertex> makeVertex(const std::string& name) {
+    return std::make_unique<Vertex>(name);
+}
+
+/**
+ * @brief Observer that counts individual notifications and keeps the last batch.
+ */
+class RecordingObserver : public GraphObserver {
+public:
+    int vertexAdded = 0;
+    int vertexRemoved = 0;
+    int edgeAdded = 0;
+    int edgeRemoved = 0;
+    int cleared = 0;
+    int batches = 0;
+    GraphBatch lastBatch;
+
+    void onVertexAdded(int) override { ++vertexAdded; }
+    void onVertexRemoved(int) override { ++vertexRemoved; }
+    void onEdgeAdded(int, int, double) override { ++edgeAdded; }
+    void onEdgeRemoved(int, int) override { ++edgeRemoved; }
+    void onGraphCleared() override { ++cleared; }
+    void onBatchApplied(const GraphBatch& batch) override {
+        ++batches;
+        lastBatch = batch;
+    }
+};
+
+/**
+ * @brief Tests that bulk additions inside a batch produce exactly one batch event.
+ */
+TEST_CASE("GraphNotifier: bulk additions are delivered as one batch") {
+    AdjacencyList<Vertex> g(true, true);
+    RecordingObserver obs;
+    g.addObserver(&obs);
+
+    g.beginBatch();
+    std::vector<int> ids = g.addVertices(3);
+    std::vector<Edge> edges{{ids[0], ids[1], 2.0}, {ids[1], ids[2], 3.0}, {ids[0], ids[1], 9.0}};
+    g.addEdges(edges);
+    CHECK(obs.batches == 0);
+    g.endBatch();
+
+    CHECK(obs.batches == 1);
+    CHECK(obs.vertexAdded == 0);
+    CHECK(obs.edgeAdded == 0);
+    CHECK(obs.lastBatch.addedVertices == ids);
+    REQUIRE(obs.lastBatch.addedEdges.size() == 2);
+    CHECK(obs.lastBatch.addedEdges[0].m_weight == 2.0);
+    CHECK(g.getEdgeWeight(ids[0], ids[1]) == 2.0);
+}
+
+/**
+ * @brief Tests that changes undone within a batch cancel out and nested batches flush once.
+ */
+TEST_CASE("GraphNotifier: cancelled changes and nested batches") {
+    AdjacencyMatrix<Vertex> g(false);
+    int a = g.addVertex(makeVertex("A"));
+    int b = g.addVertex(makeVertex("B"));
+    g.addEdge(a, b);
+
+    RecordingObserver obs;
+    g.addObserver(&obs);
+
+    g.beginBatch();
+    int c = g.addVertex(makeVertex("C"));
+    g.addEdge(a, c);
+    g.beginBatch();
+    g.removeVertex(c);
+    g.removeEdge(a, b);
+    g.endBatch();
+    CHECK(obs.batches == 0);
+    g.endBatch();
+
+    CHECK(obs.batches == 1);
+    CHECK(obs.lastBatch.addedVertices.empty());
+    CHECK(obs.lastBatch.addedEdges.empty());
+    CHECK(obs.lastBatch.removedVertices.empty());
+    CHECK(obs.lastBatch.removedEdges.size() == 2);
+}
+
+/**
+ * @brief Tests that notifications outside a batch stay immediate and the default handler replays batches.
+ */
+TEST_CASE("GraphNotifier: immediate delivery and default replay") {
+    GraphNotifier notifier;
+    RecordingObserver obs;
+    notifier.addObserver(&obs);
+
+    notifier.vertexAdded(0);
+    CHECK(obs.vertexAdded == 1);
+
+    GraphBatch batch;
+    batch.cleared = true;
+    batch.addedVertices = {0, 1};
+    batch.addedEdges.emplace_back(0, 1, 1.0);
+    obs.GraphObserver::onBatchApplied(batch);
+    CHECK(obs.cleared == 1);
+    CHECK(obs.vertexAdded == 3);
+    CHECK(obs.edgeAdded == 1);
+
+    notifier.beginBatch();
+    notifier.endBatch();
+    CHECK(obs.batches == 0);
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+/**
+ * @file MinPlusTest.cpp
+ * @brief Unit tests for the min-plus matrix product and the shortest distances built on it.
+ */
+
+#include "doctest.h"
+#include "MinPlusMatrix.h"
+#include "MinPlusPaths.h"
+#include "Dijkstra.h"
+#include "AdjacencyMatrix.h"
+#include "ThreadPool.h"
+#include "Vertex.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Helper function to fill a matrix with random values, leaving about a third of the cells unreached.
+ * @param m The matrix to fill.
+ * @param seed The random seed.
+ */
+template <typename T>
+static void fillRandom(MinPlusMatrix<T>& m, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int i = 0; i < m.getSize(); ++i) {
+        for (int j = 0; j < m.getSize(); ++j) {
+            if (rng() % 3 != 0) m.set(i, j, static_cast<T>(rng() % 1000) - static_cast<T>(std::is_signed_v<T> ? 100 : 0));
+        }
+    }
+}
+
+/**
+ * @brief Helper function to check a product against the textbook triple loop.
+ * @param size The matrix size.
+ * @param pool The pool that computes the product.
+ * @return true If every cell agrees.
+ */
+template <typename T>
+static bool productMatchesNaive(int size, ThreadPool& pool) {
+    using Matrix = MinPlusMatrix<T>;
+    Matrix a(size), b(size), c;
+    fillRandom(a, size * 2 + 1);
+    fillRandom(b, size * 2 + 2);
+    Matrix::multiply(a, b, c, pool);
+
+    bool same = c.getSize() == size;
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
+            T best = Matrix::UNREACHED;
+            for (int k = 0; k < size; ++k) {
+                if (a.get(i, k) == Matrix::UNREACHED || b.get(k, j) == Matrix::UNREACHED) continue;
+                best = std::min<T>(best, a.get(i, k) + b.get(k, j));
+            }
+            same = same && c.get(i, j) == best;
+        }
+    }
+    return same;
+}
+
+/**
+ * @brief Helper function to compute hop-bounded distances from one vertex by k rounds of Bellman-Ford.
+ * @param g The graph.
+ * @param from The source vertex ID.
+ * @param hops The hop limit.
+ * @return The distance of each vertex, infinity if out of reach.
+ */
+template <typename TGraph>
+static std::vector<double> boundedBellmanFord(const TGraph& g, int from, int hops) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<double> distances(g.getVertexCount(), infinity);
+    distances[from] = 0;
+    for (int round = 0; round < hops; ++round) {
+        std::vector<double> next = distances;
+        for (int u = 0; u < g.getVertexCount(); ++u) {
+            if (!g.hasVertex(u) || distances[u] == infinity) continue;
+            g.forEachEdgeFrom(u, [&](int v, double w) { next[v] = std::min(next[v], distances[u] + w); });
+        }
+        distances = next;
+    }
+    return distances;
+}
+
+/**
+ * @brief Test suite for min-plus products and paths.
+ */
+TEST_SUITE("Min-plus") {
+    /**
+     * @brief Checks the product for sizes around the block sizes, several element types and pool sizes.
+     */
+    TEST_CASE("Product matches the triple loop") {
+        for (std::size_t threads : {1, 4}) {
+            ThreadPool pool(threads);
+            for (int size : {0, 1, 7, 37, 300}) {
+                CHECK(productMatchesNaive<double>(size, pool));
+                CHECK(productMatchesNaive<std::int64_t>(size, pool));
+                CHECK(productMatchesNaive<std::int32_t>(size, pool));
+                CHECK(productMatchesNaive<float>(size, pool));
+            }
+        }
+        MinPlusMatrix<double> m(9);
+        CHECK(m.getStride() == 16);
+        CHECK(m.get(8, 8) == std::numeric_limits<double>::infinity());
+    }
+
+    /**
+     * @brief Checks repeated squaring against Dijkstra, for double and integer weights.
+     */
+    TEST_CASE("All pairs match Dijkstra") {
+        for (bool directed : {true, false}) {
+            AdjacencyMatrix<Vertex> g(directed, true);
+            std::mt19937 rng(directed ? 21 : 22);
+            g.addVertices(130);
+            for (int i = 0; i < 500; ++i) {
+                g.addEdge(static_cast<int>(rng() % 130), static_cast<int>(rng() % 130), static_cast<double>(rng() % 1000) / 4.0);
+            }
+            g.removeVertex(17);
+
+            ThreadPool pool(3);
+            MinPlusPaths<Vertex> paths(pool);
+            paths.run(g);
+            CHECK(paths.getHopLimit() == -1);
+            CHECK(paths.getProductCount() <= 8);
+            CHECK_FALSE(paths.hasNegativeCycle());
+            Dijkstra<Vertex> dijkstra;
+            bool same = true;
+            for (int from = 0; from < 130; ++from) {
+                if (!dijkstra.run(&g, from)) {
+                    same = same && paths.getDistance(from, from) == std::numeric_limits<double>::infinity();
+                    continue;
+                }
+                for (int to = 0; to < 130; ++to) same = same && paths.getDistance(from, to) == dijkstra.getWorkspace().getDistance(to);
+            }
+            CHECK(same);
+        }
+
+        AdjacencyMatrix<Vertex, Directed, Weighted, std::uint32_t> integral;
+        std::mt19937 rng(23);
+        integral.addVertices(90);
+        for (int i = 0; i < 400; ++i) integral.addEdge(static_cast<int>(rng() % 90), static_cast<int>(rng() % 90), rng() % 40);
+        MinPlusPaths<Vertex, std::uint32_t> paths;
+        paths.run(integral);
+        Dijkstra<Vertex, std::uint32_t> dijkstra;
+        bool same = true;
+        for (int from = 0; from < 90; ++from) {
+            REQUIRE(dijkstra.run(&integral, from));
+            for (int to = 0; to < 90; ++to) same = same && paths.getDistance(from, to) == dijkstra.getWorkspace().getDistance(to);
+        }
+        CHECK(same);
+        CHECK(paths.getDistance(0, 90) == WeightTraits<std::uint32_t>::infinity());
+    }
+
+    /**
+     * @brief Checks hop-bounded distances against Bellman-Ford limited to the same number of rounds.
+     */
+    TEST_CASE("Bounded hops match limited Bellman-Ford") {
+        AdjacencyMatrix<Vertex> g(true, true);
+        std::mt19937 rng(31);
+        g.addVertices(80);
+        for (int i = 0; i < 400; ++i) {
+            g.addEdge(static_cast<int>(rng() % 80), static_cast<int>(rng() % 80), static_cast<double>(rng() % 100) - 10.0 * (i % 50 == 0));
+        }
+
+        MinPlusPaths<Vertex> paths;
+        for (int hops : {0, 1, 2, 3, 6, 13, 200}) {
+            paths.runBoundedHops(g, hops);
+            CHECK(paths.getHopLimit() == hops);
+            bool same = true;
+            for (int from = 0; from < 80; ++from) {
+                std::vector<double> expected = boundedBellmanFord(g, from, hops);
+                for (int to = 0; to < 80; ++to) same = same && paths.getDistance(from, to) == expected[to];
+            }
+            CHECK(same);
+        }
+    }
+
+    /**
+     * @brief Checks a route that gets cheaper with more hops, and the detection of a negative cycle.
+     */
+    TEST_CASE("Cheapest route within a hop limit") {
+        AdjacencyMatrix<Vertex, Directed, Weighted, int> g;
+        g.addVertices(5);
+        g.addEdge(0, 4, 100);
+        g.addEdge(0, 1, 10);
+        g.addEdge(1, 4, 50);
+        g.addEdge(1, 2, 5);
+        g.addEdge(2, 3, 5);
+        g.addEdge(3, 4, 5);
+
+        MinPlusPaths<Vertex, int> paths;
+        paths.runBoundedHops(g, 1);
+        CHECK(paths.getDistance(0, 4) == 100);
+        paths.runBoundedHops(g, 2);
+        CHECK(paths.getDistance(0, 4) == 60);
+        CHECK(paths.getDistance(0, 3) == WeightTraits<int>::infinity());
+        paths.runBoundedHops(g, 4);
+        CHECK(paths.getDistance(0, 4) == 25);
+        paths.runBoundedHops(g, 0);
+        CHECK(paths.getDistance(2, 2) == 0);
+        CHECK(paths.getDistance(0, 4) == WeightTraits<int>::infinity());
+        paths.run(g);
+        CHECK(paths.getDistance(0, 4) == 25);
+        CHECK_FALSE(paths.hasNegativeCycle());
+
+        g.addEdge(3, 1, -20);
+        paths.run(g);
+        CHECK(paths.hasNegativeCycle());
+        paths.runBoundedHops(g, 3);
+        CHECK(paths.getDistance(1, 1) == -10);
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file MultiSourceBFSTest.cpp
+ * @brief Unit tests for the multi-source bit-parallel BFS, cross-checked against single-source searches.
+ */
+
+#include "doctest.h"
+#include "MultiSourceBFS.h"
+#include "DirectionOptimizingBFS.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <algorithm>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Test suite for the multi-source BFS.
+ */
+TEST_SUITE("Multi-source BFS") {
+    /**
+     * @brief Checks every row of the level matrix against a single-source BFS, across several batches.
+     */
+    TEST_CASE("Level matrix matches single-source BFS") {
+        for (bool directed : {true, false}) {
+            AdjacencyList<Vertex> g(directed, false);
+            fillSocial(g, 1500, 6000, directed ? 21 : 22);
+            g.removeVertex(4);
+            CsrGraph<Vertex> csr(g);
+
+            std::vector<int> sources;
+            for (int s = 0; s < 300; ++s) sources.push_back((s * 37) % 1500 == 4 ? 5 : (s * 37) % 1500);
+            sources.push_back(sources.front());
+
+            MultiSourceBFS<Vertex> narrow;
+            MultiSourceBFS<Vertex, double, 4> wide;
+            REQUIRE(narrow.run(csr, sources));
+            REQUIRE(wide.run(csr, sources));
+            CHECK(wide.getLevels() == narrow.getLevels());
+
+            DirectionOptimizingBFS<Vertex> single(BfsDirection::TopDown);
+            std::size_t separateScans = 0;
+            bool same = true;
+            for (std::size_t i = 0; i < sources.size(); ++i) {
+                REQUIRE(single.run(csr, sources[i]));
+                separateScans += single.getEdgesInspected();
+                std::span<const int> row = narrow.getRow(i);
+                same = same && std::equal(row.begin(), row.end(), single.getLevels().begin(), single.getLevels().end());
+            }
+            CHECK(same);
+            CHECK(narrow.getLevel(0, sources[0]) == 0);
+            CHECK(narrow.getEdgesScanned() * 5 < separateScans);
+            CHECK(wide.getEdgesScanned() < narrow.getEdgesScanned());
+        }
+    }
+
+    /**
+     * @brief Checks the callback form: one call per reached pair, in level order, usable for eccentricities.
+     */
+    TEST_CASE("Callback reports eccentricities") {
+        AdjacencyList<Vertex> g(false, false);
+        g.addVertices(6);
+        for (int v = 0; v + 1 < 5; ++v) g.addEdge(v, v + 1);
+
+        std::vector<int> sources{0, 2, 4, 5};
+        std::vector<int> eccentricity(sources.size(), 0), reached(sources.size(), 0), lastLevel(sources.size(), 0);
+        bool ordered = true;
+        MultiSourceBFS<Vertex> bfs;
+        CsrGraph<Vertex> csr(g);
+        REQUIRE(bfs.run(csr, sources, [&](std::size_t source, int, int level) {
+            ordered = ordered && level >= lastLevel[source];
+            lastLevel[source] = level;
+            eccentricity[source] = std::max(eccentricity[source], level);
+            ++reached[source];
+        }));
+        CHECK(ordered);
+        CHECK(eccentricity == std::vector<int>{4, 2, 4, 0});
+        CHECK(reached == std::vector<int>{5, 5, 5, 1});
+
+        std::vector<int> bad{1, 9};
+        CHECK_FALSE(bfs.run(csr, bad));
+        CHECK(bfs.getRow(0).empty());
+        CHECK(bfs.getLevel(0, 1) == -1);
+    }
+}
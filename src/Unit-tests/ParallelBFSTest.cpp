@@ -0,0 +1,98 @@
+/**
+ * @file ParallelBFSTest.cpp
+ * @brief Unit tests for the thread pool and the parallel level-synchronous BFS.
+ */
+
+#include "doctest.h"
+#include "ParallelBFS.h"
+#include "DirectionOptimizingBFS.h"
+#include "ThreadPool.h"
+#include "AdjacencyList.h"
+#include "CsrGraph.h"
+#include "Vertex.h"
+#include "TestGraphs.h"
+#include <atomic>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Test suite for the thread pool and the parallel BFS.
+ */
+TEST_SUITE("Parallel BFS") {
+    /**
+     * @brief Checks that every index is run exactly once, by a valid participant, for small and large ranges.
+     */
+    TEST_CASE("Thread pool covers every index once") {
+        ThreadPool pool(4);
+        CHECK(pool.getThreadCount() == 4);
+        for (std::size_t count : {0, 1, 7, 1000, 100003}) {
+            std::vector<std::atomic<int>> hits(count);
+            std::atomic<bool> badParticipant{false};
+            pool.parallelFor(count, 64, [&](std::size_t begin, std::size_t end, std::size_t participant) {
+                if (participant >= pool.getThreadCount() || end - begin > 64) badParticipant = true;
+                for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1);
+            });
+            bool once = true;
+            for (auto& hit : hits) once = once && hit.load() == 1;
+            CHECK(once);
+            CHECK_FALSE(badParticipant.load());
+        }
+    }
+
+    /**
+     * @brief Checks levels against the sequential engine and that every parent is a valid tree parent.
+     */
+    TEST_CASE("Levels match the sequential BFS") {
+        for (bool directed : {true, false}) {
+            AdjacencyList<Vertex> g(directed, false);
+            fillSocial(g, 20000, 120000, directed ? 11 : 12);
+            g.removeVertex(5);
+            CsrGraph<Vertex> csr(g);
+
+            DirectionOptimizingBFS<Vertex> sequential(BfsDirection::TopDown);
+            REQUIRE(sequential.run(csr, 0));
+
+            for (std::size_t threads : {1, 3, 8}) {
+                ThreadPool pool(threads);
+                ParallelBFS<Vertex> bfs(pool, 16);
+                for (int repeat = 0; repeat < 3; ++repeat) {
+                    REQUIRE(bfs.run(csr, 0));
+                    CHECK(bfs.getLevels() == sequential.getLevels());
+                    CHECK(bfs.getReachedCount() == sequential.getReachedCount());
+                    CHECK(bfs.getLevelCount() == sequential.getLevelCount());
+
+                    bool valid = bfs.getParent(0) == -1;
+                    for (int v = 1; v < csr.getVertexCount(); ++v) {
+                        int p = bfs.getParent(v);
+                        if (bfs.getLevel(v) < 0) {
+                            valid = valid && p == -1;
+                            continue;
+                        }
+                        valid = valid && p >= 0 && bfs.getLevel(p) == bfs.getLevel(v) - 1 && csr.hasEdge(p, v);
+                    }
+                    CHECK(valid);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Checks a missing start and a start without out-edges.
+     */
+    TEST_CASE("Missing and isolated start") {
+        AdjacencyList<Vertex> g(true, false);
+        g.addVertices(3);
+        g.addEdge(1, 0);
+        CsrGraph<Vertex> csr(g);
+
+        ParallelBFS<Vertex> bfs;
+        CHECK_FALSE(bfs.run(csr, 7));
+        REQUIRE(bfs.run(csr, 0));
+        CHECK(bfs.getReachedCount() == 1);
+        CHECK(bfs.getLevelCount() == 1);
+        CHECK(bfs.getLevels() == std::vector<int>{0, -1, -1});
+        CHECK(bfs.getParent(3) == -1);
+    }
+}
@@ -0,0 +1,264 @@
+/**
+ * @file PriorityQueueTest.cpp
+ * @brief Unit tests for the vertex priority queues and Dijkstra's algorithm built on each of them.
+ */
+
+#include "doctest.h"
+#include "PriorityQueues.h"
+#include "Dijkstra.h"
+#include "AdjacencyList.h"
+#include "Vertex.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Pops every entry of an indexed heap, checking that keys come out in non-decreasing order.
+ * @param heap The heap to empty.
+ * @param keys The expected key of each vertex, compared with the popped key.
+ * @return The popped vertex IDs, in order.
+ */
+template <typename Heap>
+static std::vector<int> popAll(Heap& heap, const std::vector<int>& keys) {
+    std::vector<int> order;
+    int previous = -1;
+    while (!heap.empty()) {
+        auto entry = heap.pop();
+        CHECK(entry.key >= previous);
+        CHECK(entry.key == keys[entry.id]);
+        previous = entry.key;
+        order.push_back(entry.id);
+    }
+    return order;
+}
+
+/**
+ * @brief Test suite for the indexed d-ary heap.
+ */
+TEST_SUITE("IndexedDaryHeap") {
+    /**
+     * @brief Checks decrease-key, the one-entry-per-vertex bound and ignored increases.
+     */
+    TEST_CASE("Decrease-key keeps one entry per vertex") {
+        IndexedDaryHeap<int> heap;
+        heap.reset(5);
+        heap.push(0, 50);
+        heap.push(1, 40);
+        heap.push(2, 30);
+        heap.push(0, 10);
+        heap.push(2, 35);
+        CHECK(heap.size() == 3);
+        CHECK(heap.contains(0));
+        CHECK_FALSE(heap.contains(3));
+
+        std::vector<int> keys{10, 40, 30, 0, 0};
+        CHECK(popAll(heap, keys) == std::vector<int>{0, 2, 1});
+        CHECK_FALSE(heap.contains(0));
+    }
+
+    /**
+     * @brief Compares random pushes and decreases against the expected minimum order for several arities.
+     */
+    TEST_CASE("Random operations for several arities") {
+        auto check = [](auto heap) {
+            std::mt19937 rng(3);
+            const int n = 300;
+            std::vector<int> keys(n, -1);
+            heap.reset(n);
+            for (int i = 0; i < 2000; ++i) {
+                int id = static_cast<int>(rng() % n);
+                int key = static_cast<int>(rng() % 1000);
+                heap.push(id, key);
+                if (keys[id] < 0 || key < keys[id]) keys[id] = key;
+            }
+            std::size_t queued = 0;
+            for (int key : keys) queued += key >= 0;
+            CHECK(heap.size() == queued);
+            CHECK(popAll(heap, keys).size() == queued);
+        };
+        check(IndexedDaryHeap<int, 2>());
+        check(IndexedDaryHeap<int, 4>());
+        check(IndexedDaryHeap<int, 8>());
+    }
+
+    /**
+     * @brief Checks that reset() forgets vertices left in the heap by an interrupted run.
+     */
+    TEST_CASE("Reset after an early stop") {
+        IndexedDaryHeap<int> heap;
+        heap.reset(4);
+        heap.push(1, 5);
+        heap.push(2, 7);
+        heap.pop();
+        heap.reset(8);
+        CHECK(heap.empty());
+        CHECK_FALSE(heap.contains(2));
+        heap.push(2, 9);
+        heap.push(7, 1);
+        CHECK(heap.pop().id == 7);
+        CHECK(heap.pop().key == 9);
+    }
+}
+
+/**
+ * @brief Drives a queue the way Dijkstra does, pushing keys at most @p maxStep above the last popped one,
+ * and checks that it pops the same keys as a lazy binary heap.
+ * @param queue The monotone queue under test.
+ * @param maxStep The largest gap between a pushed key and the last popped key.
+ * @param seed Seed of the random operations.
+ */
+template <typename Queue>
+static void checkMonotone(Queue& queue, std::int64_t maxStep, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    LazyBinaryHeap<std::int64_t> reference;
+    queue.reset(0);
+    reference.reset(0);
+    std::int64_t last = 0;
+    bool ordered = true;
+    for (int round = 0; round < 3000; ++round) {
+        int pushes = static_cast<int>(rng() % 4);
+        for (int i = 0; i < pushes; ++i) {
+            std::int64_t key = last + static_cast<std::int64_t>(rng() % static_cast<std::uint64_t>(maxStep + 1));
+            queue.push(round, key);
+            reference.push(round, key);
+        }
+        if (rng() % 3 != 0 && !reference.empty()) {
+            std::int64_t key = queue.pop().key;
+            ordered = ordered && key == reference.pop().key && key >= last;
+            last = key;
+        }
+        CHECK(queue.size() == reference.size());
+    }
+    while (!reference.empty()) ordered = ordered && queue.pop().key == reference.pop().key;
+    CHECK(ordered);
+    CHECK(queue.empty());
+}
+
+/**
+ * @brief Test suite for the bucket queues of integer keys.
+ */
+TEST_SUITE("Bucket queues") {
+    /**
+     * @brief Checks Dial's queue with small gaps and with gaps that force the ring to grow.
+     */
+    TEST_CASE("Dial's queue") {
+        DialQueue<std::int64_t> dial;
+        checkMonotone(dial, 10, 1);
+        std::size_t buckets = dial.getBucketCount();
+        CHECK(buckets == 64);
+        checkMonotone(dial, 5000, 2);
+        CHECK(dial.getBucketCount() >= 5001);
+        CHECK((dial.getBucketCount() & (dial.getBucketCount() - 1)) == 0);
+
+        dial.reset(0);
+        dial.push(3, 100000);
+        dial.push(4, 100002);
+        CHECK(dial.getSpan(100002) == 100003);
+        CHECK(dial.pop().id == 3);
+        CHECK(dial.getSpan(100002) == 3);
+        CHECK(dial.getSpan(99999) == SIZE_MAX);
+        dial.reset(0);
+        CHECK(dial.empty());
+        dial.push(5, 7);
+        CHECK(dial.pop().key == 7);
+    }
+
+    /**
+     * @brief Checks the radix heap with small and very large gaps.
+     */
+    TEST_CASE("Radix heap") {
+        RadixHeap<std::int64_t> radix;
+        checkMonotone(radix, 10, 3);
+        checkMonotone(radix, std::int64_t(1) << 40, 4);
+
+        RadixHeap<std::uint64_t> wide;
+        wide.reset(0);
+        wide.push(1, UINT64_MAX - 1);
+        wide.push(2, 5);
+        CHECK(wide.pop().id == 2);
+        CHECK(wide.pop().key == UINT64_MAX - 1);
+    }
+
+    /**
+     * @brief Checks that the combined queue switches to the radix heap only for large gaps.
+     */
+    TEST_CASE("Automatic choice between Dial's queue and the radix heap") {
+        MonotoneIntegerQueue<std::int64_t, 256> queue;
+        checkMonotone(queue, 200, 5);
+        CHECK_FALSE(queue.usesRadixHeap());
+        checkMonotone(queue, 100000, 6);
+        CHECK(queue.usesRadixHeap());
+        queue.reset(0);
+        CHECK_FALSE(queue.usesRadixHeap());
+    }
+}
+
+/**
+ * @brief Tests that Dijkstra gives the same distances and paths with every queue.
+ */
+TEST_CASE("Dijkstra: queue variants agree") {
+    AdjacencyList<Vertex> g(true, true);
+    std::mt19937 rng(5);
+    const int n = 200;
+    g.addVertices(n);
+    for (int i = 0; i < 3000; ++i) {
+        g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n), 1.0 + (rng() % 1000) / 10.0);
+    }
+
+    std::vector<AlgorithmEvent> lazyPath, heapPath;
+    auto pathOf = [](std::vector<AlgorithmEvent>& path) {
+        return [&path](const AlgorithmEvent& e) { if (e.type == EventType::Path) path.push_back(e); };
+    };
+
+    Dijkstra<Vertex, double, LazyBinaryHeap<double>> lazy;
+    Dijkstra<Vertex> indexed;
+    Dijkstra<Vertex, double, IndexedDaryHeap<double, 2>> binary;
+    REQUIRE(lazy.run(&g, 0, n - 1, pathOf(lazyPath)));
+    REQUIRE(indexed.run(&g, 0, n - 1, pathOf(heapPath)));
+    REQUIRE(binary.run(&g, 0));
+    REQUIRE(lazyPath.size() == heapPath.size());
+    for (std::size_t i = 0; i < lazyPath.size(); ++i) {
+        CHECK(lazyPath[i].vertex == heapPath[i].vertex);
+        CHECK(lazyPath[i].target == heapPath[i].target);
+    }
+
+    REQUIRE(lazy.run(&g, 0));
+    for (int v = 0; v < n; ++v) {
+        CHECK(binary.getWorkspace().getDistance(v) == lazy.getWorkspace().getDistance(v));
+    }
+}
+
+/**
+ * @brief Tests that Dijkstra on integer weights gives the same distances with the bucket queues as with a heap.
+ */
+TEST_CASE("Dijkstra: integer weights on bucket queues") {
+    for (std::uint32_t maxWeight : {9u, 1000000u}) {
+        AdjacencyList<Vertex, Directed, Weighted, std::uint32_t> g;
+        std::mt19937 rng(maxWeight);
+        const int n = 300;
+        g.addVertices(n);
+        for (int i = 0; i < 2000; ++i) {
+            g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n), 1 + rng() % maxWeight);
+        }
+
+        Dijkstra<Vertex, std::uint32_t> automatic;
+        Dijkstra<Vertex, std::uint32_t, DialQueue<std::uint64_t>> dial;
+        Dijkstra<Vertex, std::uint32_t, RadixHeap<std::uint64_t>> radix;
+        Dijkstra<Vertex, std::uint32_t, IndexedDaryHeap<std::uint64_t>> heap;
+        for (int source : {0, 17}) {
+            REQUIRE(automatic.run(&g, source));
+            REQUIRE(dial.run(&g, source));
+            REQUIRE(radix.run(&g, source));
+            REQUIRE(heap.run(&g, source));
+            for (int v = 0; v < n; ++v) {
+                std::uint64_t expected = heap.getWorkspace().getDistance(v);
+                CHECK(automatic.getWorkspace().getDistance(v) == expected);
+                CHECK(dial.getWorkspace().getDistance(v) == expected);
+                CHECK(radix.getWorkspace().getDistance(v) == expected);
+            }
+        }
+    }
+}
\ No newline at end of file
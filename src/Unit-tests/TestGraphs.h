@@ -0,0 +1,69 @@
+/**
+ * @file TestGraphs.h
+ * @brief Seeded graph generators shared by the algorithm tests.
+ */
+
+#pragma once
+#include <random>
+
+/**
+ * @brief Fills a graph with edges between uniformly random vertices.
+ * @param g The graph to fill.
+ * @param n The number of vertices.
+ * @param edges The number of edges.
+ * @param seed The random seed.
+ * @param weight A distribution, or any callable taking the std::mt19937, that draws each edge weight.
+ */
+template <typename TGraph, typename WeightFn>
+void fillRandom(TGraph& g, int n, int edges, unsigned seed, WeightFn weight) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    g.addVertices(n);
+    for (int i = 0; i < edges; ++i) {
+        int from = pick(rng);
+        int to = pick(rng);
+        g.addEdge(from, to, weight(rng));
+    }
+}
+
+/**
+ * @brief Fills a graph with a side x side grid of positioned vertices joined to their right and lower neighbours.
+ * * Vertex row * side + col is placed at (col, row), so neighbours are one unit apart.
+ * @param g The graph to fill.
+ * @param side The number of vertices per row and column.
+ * @param seed The random seed.
+ * @param weight A distribution, or any callable taking the std::mt19937, that draws each edge weight.
+ */
+template <typename TGraph, typename WeightFn>
+void fillGrid(TGraph& g, int side, unsigned seed, WeightFn weight) {
+    std::mt19937 rng(seed);
+    g.addVertices(side * side);
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            int id = row * side + col;
+            g.getVertex(id)->setPosition(col, row);
+            if (col + 1 < side) g.addEdge(id, id + 1, weight(rng));
+            if (row + 1 < side) g.addEdge(id, id + side, weight(rng));
+        }
+    }
+}
+
+/**
+ * @brief Fills a graph with mostly short-range edges plus random shortcuts.
+ * * Three edges in four go to one of the next eight IDs and the rest anywhere, so searches see a long
+ * local chain that shortcuts collapse into few levels, as in a small-world network.
+ * @param g The graph to fill.
+ * @param n The number of vertices.
+ * @param edges The number of edges.
+ * @param seed The random seed.
+ */
+template <typename TGraph>
+void fillSocial(TGraph& g, int n, int edges, unsigned seed) {
+    std::mt19937 rng(seed);
+    g.addVertices(n);
+    for (int i = 0; i < edges; ++i) {
+        int from = static_cast<int>(rng() % n);
+        int to = rng() % 4 == 0 ? static_cast<int>(rng() % n) : static_cast<int>((from + 1 + rng() % 8) % n);
+        g.addEdge(from, to);
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file TraversalWorkspaceTest.cpp
+ * @brief Unit tests for the epoch-stamped TraversalWorkspace and its use by the algorithms.
+ */
+
+#include "doctest.h"
+#include "TraversalWorkspace.h"
+#include "BFS.h"
+#include "DFS.h"
+#include "Dijkstra.h"
+#include "AdjacencyList.h"
+#include "Vertex.h"
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace Core;
+using namespace Algorithms;
+
+/**
+ * @brief Tests that a reset forgets every vertex without touching the arrays.
+ */
+TEST_CASE("TraversalWorkspace: reset and growth") {
+    TraversalWorkspace<double> ws;
+    ws.reset(4);
+    CHECK_FALSE(ws.isReached(2));
+    CHECK(ws.reach(2));
+    CHECK_FALSE(ws.reach(2));
+    ws.setDistance(3, 1.5, 2);
+    CHECK(ws.getDistance(3) == 1.5);
+    CHECK(ws.getPrevious(3) == 2);
+    CHECK(ws.getDistance(2) == std::numeric_limits<double>::infinity());
+    CHECK(ws.getReachedCount() == 2);
+
+    std::size_t footprint = ws.getMemoryFootprint();
+    std::uint32_t epoch = ws.getEpoch();
+    ws.reset(4);
+    CHECK(ws.getEpoch() == epoch + 1);
+    CHECK(ws.getMemoryFootprint() == footprint);
+    CHECK_FALSE(ws.isReached(2));
+    CHECK_FALSE(ws.isReached(3));
+    CHECK(ws.getDistance(3) == std::numeric_limits<double>::infinity());
+    CHECK(ws.getPrevious(3) == -1);
+    CHECK(ws.getReachedCount() == 0);
+
+    ws.reset(10);
+    CHECK_FALSE(ws.isReached(9));
+    CHECK(ws.reach(9));
+}
+
+/**
+ * @brief Tests that algorithms sharing one workspace give the same results as with their own, run after run.
+ */
+TEST_CASE("TraversalWorkspace: shared between algorithms") {
+    AdjacencyList<Vertex> g(false, true);
+    for (int i = 0; i < 6; ++i) g.addVertex(std::make_unique<Vertex>(""));
+    g.addEdge(0, 1, 4.0);
+    g.addEdge(0, 2, 1.0);
+    g.addEdge(2, 1, 1.0);
+    g.addEdge(1, 3, 2.0);
+    g.addEdge(4, 5, 1.0);
+
+    TraversalWorkspace<double> shared;
+    Dijkstra<Vertex> dijkstra;
+    dijkstra.setWorkspace(&shared);
+    BFS<Vertex> bfs;
+    bfs.setWorkspace(&shared);
+    DFS<Vertex> dfs;
+    dfs.setWorkspace(&shared);
+
+    for (int round = 0; round < 3; ++round) {
+        REQUIRE(dijkstra.run(&g, 0));
+        CHECK(&dijkstra.getWorkspace() == &shared);
+        CHECK(shared.getDistance(1) == 2.0);
+        CHECK(shared.getDistance(3) == 4.0);
+        CHECK(shared.getPrevious(1) == 2);
+        CHECK_FALSE(shared.isReached(4));
+
+        std::vector<int> visited;
+        auto record = [&](const AlgorithmEvent& e) { if (e.type == EventType::Visiting) visited.push_back(e.vertex); };
+        REQUIRE(bfs.run(&g, 4, -1, record));
+        CHECK(visited == std::vector<int>{4, 5});
+        CHECK(shared.getReachedCount() == 2);
+
+        visited.clear();
+        REQUIRE(dfs.run(&g, 3, -1, record));
+        CHECK(visited.size() == 4);
+    }
+
+    Dijkstra<Vertex> own;
+    REQUIRE(own.run(&g, 0));
+    CHECK(&own.getWorkspace() != &shared);
+    CHECK(own.getWorkspace().getDistance(3) == 4.0);
+}
\ No newline at end of file